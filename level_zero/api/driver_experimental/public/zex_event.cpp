@@ -7,10 +7,14 @@
 
 #include "level_zero/driver_experimental/zex_event.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/in_order_cmd_helpers.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/utilities/completion_reactor.h"
 
+#include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
 #include "level_zero/core/source/context/context_imp.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/driver/driver_handle.h"
@@ -181,4 +185,73 @@ ZE_APIEXPORT ze_result_t ZE_APICALL zexCounterBasedEventCloseIpcHandle(ze_event_
     return Event::fromHandle(hEvent)->destroy();
 }
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout, ze_bool_t waitAll, uint32_t *pSignaledEventIndex) {
+    if (numEvents == 0 || !phEvents) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    StackVec<Event *, 32> events;
+    events.reserve(numEvents);
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto event = Event::fromHandle(toInternalType(phEvents[i]));
+        if (!event) {
+            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+        events.push_back(event);
+    }
+
+    return Event::hostSynchronizeMultiple(numEvents, events.begin(), timeout, !!waitAll, pSignaledEventIndex);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventSetCompletionCallback(ze_event_handle_t hEvent, zex_event_completion_callback_t pfnCallback, void *pUserData) {
+    auto event = Event::fromHandle(toInternalType(hEvent));
+    if (!event || !pfnCallback) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto callback = [hEvent, pfnCallback, pUserData](bool gpuHangDetected) {
+        pfnCallback(hEvent, gpuHangDetected ? ZE_RESULT_ERROR_DEVICE_LOST : ZE_RESULT_SUCCESS, pUserData);
+    };
+    return event->registerCompletionWatch(std::move(callback), NEO::CompletionWatch::invalidNotificationFd);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventGetCompletionNotificationFd(ze_event_handle_t hEvent, int *pFd) {
+    auto event = Event::fromHandle(toInternalType(hEvent));
+    if (!event || !pFd) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto notificationFd = NEO::CompletionReactor::createNotificationFd();
+    if (notificationFd == NEO::CompletionWatch::invalidNotificationFd) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    *pFd = notificationFd;
+    return event->registerCompletionWatch(nullptr, notificationFd);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandQueueGetCompletionNotificationFd(ze_command_queue_handle_t hCommandQueue, int *pFd) {
+    auto commandQueue = static_cast<CommandQueueImp *>(CommandQueue::fromHandle(toInternalType(hCommandQueue)));
+    if (!commandQueue || !pFd) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto notificationFd = NEO::CompletionReactor::createNotificationFd();
+    if (notificationFd == NEO::CompletionWatch::invalidNotificationFd) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    auto csr = commandQueue->getCsr();
+    auto watch = NEO::CompletionReactor::createTaskCountWatch(*csr, commandQueue->getTaskCount());
+    watch.notificationFd = notificationFd;
+    csr->peekExecutionEnvironment().getCompletionReactor()->registerWatch(std::move(watch));
+
+    *pFd = notificationFd;
+    return ZE_RESULT_SUCCESS;
+}
+
 } // namespace L0
@@ -108,6 +108,7 @@ NEO::GraphicsAllocation *CommandList::getAllocationFromHostPtrMap(const void *bu
             auto alloc = allocation.get();
             alloc->hostPtrTaskCountAssignment++;
             csr->getInternalAllocationStorage()->storeAllocationWithTaskCount(std::move(allocation), NEO::AllocationUsage::TEMPORARY_ALLOCATION, csr->peekTaskCount());
+            this->temporaryAllocationStored = true;
             return alloc;
         }
     }
@@ -127,6 +128,7 @@ NEO::GraphicsAllocation *CommandList::getHostPtrAlloc(const void *buffer, uint64
         alloc->hostPtrTaskCountAssignment++;
         auto csr = getCsr(copyOffload);
         csr->getInternalAllocationStorage()->storeAllocationWithTaskCount(std::unique_ptr<NEO::GraphicsAllocation>(alloc), NEO::AllocationUsage::TEMPORARY_ALLOCATION, csr->peekTaskCount());
+        this->temporaryAllocationStored = true;
     } else if (alloc->getAllocationType() == NEO::AllocationType::externalHostPtr) {
         hostPtrMap.insert(std::make_pair(buffer, alloc));
     } else {
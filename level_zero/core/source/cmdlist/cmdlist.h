@@ -405,6 +405,7 @@ struct CommandList : _ze_command_list_handle_t {
     }
 
     virtual bool skipInOrderNonWalkerSignalingAllowed(ze_event_handle_t signalEvent) const { return false; }
+    virtual void flushDeferredAppendsForHostWait() {}
 
     bool getCmdListBatchBufferFlag() const {
         return dispatchCmdListBatchBufferAsPrimary;
@@ -549,6 +550,7 @@ struct CommandList : _ze_command_list_handle_t {
     bool localDispatchSupport = false;
     bool l3FlushAfterPostSyncRequired = false;
     bool textureCacheFlushPending = false;
+    bool temporaryAllocationStored = false;
     bool closedCmdList = false;
 };
 
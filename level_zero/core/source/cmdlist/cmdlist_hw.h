@@ -13,6 +13,8 @@
 #include "shared/source/helpers/pipe_control_args.h"
 #include "shared/source/helpers/vec.h"
 #include "shared/source/kernel/kernel_arg_descriptor.h"
+#include "shared/source/utilities/kernel_timing_trace.h"
+#include "shared/source/utilities/local_work_size_autotuner.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_imp.h"
 
@@ -23,6 +25,7 @@ enum class MemoryPool;
 enum class ImageType;
 struct EncodeDispatchKernelArgs;
 struct KernelDescriptor;
+class WaitListCompactor;
 
 } // namespace NEO
 
@@ -69,6 +72,13 @@ struct CmdListEventOperation {
     bool isTimestmapEvent = false;
 };
 
+struct SubmittedInOrderWait {
+    NEO::CommandStreamReceiver *csr = nullptr;
+    uint64_t timelineId = 0;
+    uint64_t waitValue = 0;
+    uint32_t offset = 0;
+};
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 struct CommandListCoreFamily : public CommandListImp {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
@@ -393,7 +403,9 @@ struct CommandListCoreFamily : public CommandListImp {
     virtual bool isRelaxedOrderingDispatchAllowed(uint32_t numWaitEvents, bool copyOffload) { return false; }
     virtual void setupFlushMethod(const NEO::RootDeviceEnvironment &rootDeviceEnvironment) {}
     bool canSkipInOrderEventWait(Event &event, bool ignorCbEventBoundToCmdList) const;
+    void compactCounterBasedWaitEvents(NEO::WaitListCompactor &compactor, uint32_t numEvents, ze_event_handle_t *phEvent);
     bool handleInOrderImplicitDependencies(bool relaxedOrderingAllowed, bool dualStreamCopyOffloadOperation);
+    NEO::CommandStreamReceiver *getCsrForInOrderWaitElision(const NEO::InOrderExecInfo &waitInOrderExecInfo, CommandToPatchContainer *outListCommands, bool relaxedOrderingAllowed, bool noopDispatch, bool dualStreamCopyOffloadOperation) const;
     bool isQwordInOrderCounter() const { return GfxFamily::isQwordInOrderCounter; }
     bool isInOrderNonWalkerSignalingRequired(const Event *event) const;
     bool hasInOrderDependencies() const;
@@ -419,8 +431,15 @@ struct CommandListCoreFamily : public CommandListImp {
     void dispatchInOrderPostOperationBarrier(Event *signalOperation, bool dcFlushRequired, bool copyOperation);
     NEO::GraphicsAllocation *getDeviceCounterAllocForResidency(NEO::GraphicsAllocation *counterDeviceAlloc);
     bool isHighPriorityImmediateCmdList() const;
+    NEO::TagNodeBase *borrowWalkerPostSyncForTimestamps(NEO::TagNodeBase *borrowedNode, uint64_t &eventAddress, bool &isTimestampEvent);
 
     NEO::InOrderPatchCommandsContainer<GfxFamily> inOrderPatchCmds;
+    std::vector<NEO::KernelTimingRecord> kernelTimingRecords;
+    std::vector<NEO::LocalWorkSizeAutotuneRecord> lwsAutotuneRecords;
+    std::vector<SubmittedInOrderWait> pendingInOrderWaits;
+    NEO::KernelTimingTrace *kernelTimingTrace = nullptr;
+    NEO::LocalWorkSizeAutotuner *localWorkSizeAutotuner = nullptr;
+    uint32_t kernelTimingQueueId = 0;
 
     bool latestOperationHasOptimizedCbEvent = false;
     bool latestOperationRequiredNonWalkerInOrderCmdsChaining = false;
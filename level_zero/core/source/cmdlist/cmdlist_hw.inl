@@ -29,6 +29,7 @@
 #include "shared/source/helpers/register_offsets.h"
 #include "shared/source/helpers/state_base_address_helper.h"
 #include "shared/source/helpers/surface_format_info.h"
+#include "shared/source/helpers/wait_list_compaction.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
@@ -266,6 +267,14 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::initialize(Device *device, NEO
     this->compactL3FlushEventPacket = L0GfxCoreHelper::useCompactL3FlushEventPacket(hwInfo, this->l3FlushAfterPostSyncRequired);
     this->useAdditionalBlitProperties = productHelper.useAdditionalBlitProperties();
 
+    if (isImmediateType() && !this->internalUsage) {
+        this->kernelTimingTrace = neoDevice->getExecutionEnvironment()->getKernelTimingTrace();
+        if (this->kernelTimingTrace) {
+            this->kernelTimingQueueId = this->kernelTimingTrace->getNextQueueId();
+        }
+        this->localWorkSizeAutotuner = neoDevice->getExecutionEnvironment()->getLocalWorkSizeAutotuner();
+    }
+
     if (NEO::debugManager.flags.OverrideThreadArbitrationPolicy.get() != -1) {
         this->defaultPipelinedThreadArbitrationPolicy = NEO::debugManager.flags.OverrideThreadArbitrationPolicy.get();
     }
@@ -1494,6 +1503,20 @@ bool CommandListCoreFamily<gfxCoreFamily>::isHighPriorityImmediateCmdList() cons
     return (this->isImmediateType() && getCsr(false)->getOsContext().isHighPriority());
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+NEO::TagNodeBase *CommandListCoreFamily<gfxCoreFamily>::borrowWalkerPostSyncForTimestamps(NEO::TagNodeBase *borrowedNode, uint64_t &eventAddress, bool &isTimestampEvent) {
+    // walker post sync is not used by the application, all internal users of kernel timestamps share one node
+    if (borrowedNode) {
+        borrowedNode->incRefCount();
+        return borrowedNode;
+    }
+    auto timestampNode = device->getInOrderTimestampAllocator()->getTag();
+    commandContainer.addToResidencyContainer(timestampNode->getBaseGraphicsAllocation()->getGraphicsAllocation(device->getRootDeviceIndex()));
+    eventAddress = timestampNode->getGpuAddress();
+    isTimestampEvent = true;
+    return timestampNode;
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyBlit(uintptr_t dstPtr,
                                                                        NEO::GraphicsAllocation *dstPtrAlloc,
@@ -2880,6 +2903,18 @@ void CommandListCoreFamily<gfxCoreFamily>::appendWaitOnInOrderDependency(std::sh
 
     UNRECOVERABLE_IF(waitValue > static_cast<uint64_t>(std::numeric_limits<uint32_t>::max()) && !isQwordInOrderCounter());
 
+    auto elisionCsr = getCsrForInOrderWaitElision(*inOrderExecInfo, outListCommands, relaxedOrderingAllowed, noopDispatch, dualStreamCopyOffloadOperation);
+    if (elisionCsr && !implicitDependency) {
+        auto satisfiedCounters = elisionCsr->getInOrderSatisfiedCounters();
+        if (satisfiedCounters->isSatisfied(inOrderExecInfo->getTimelineId(), offset, waitValue)) {
+            PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintInOrderSemaphoreWaitElision.get(), stdout, "Elided in-order semaphore wait on 0x%llx, value %llu, elided waits on engine: %llu\n",
+                               inOrderExecInfo->getBaseDeviceAddress() + offset, waitValue, satisfiedCounters->getElidedWaitsCount());
+            return;
+        }
+    }
+
+    bool semaphoreWaitProgrammed = false;
+
     auto deviceAllocForResidency = this->getDeviceCounterAllocForResidency(inOrderExecInfo->getDeviceCounterAllocation());
     if (!skipAddingWaitEventsToResidency) {
         commandContainer.addToResidencyContainer(deviceAllocForResidency);
@@ -2984,11 +3019,34 @@ void CommandListCoreFamily<gfxCoreFamily>::appendWaitOnInOrderDependency(std::sh
                     semaphoreWaitPatch.offset = i * immWriteOffset;
                     semaphoreWaitPatch.inOrderPatchListIndex = inOrderPatchListIndex;
                 }
+
+                semaphoreWaitProgrammed = true;
             }
         }
 
         gpuAddress += immWriteOffset;
     }
+
+    if (elisionCsr && semaphoreWaitProgrammed) {
+        this->pendingInOrderWaits.push_back({elisionCsr, inOrderExecInfo->getTimelineId(), waitValue, offset});
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+NEO::CommandStreamReceiver *CommandListCoreFamily<gfxCoreFamily>::getCsrForInOrderWaitElision(const NEO::InOrderExecInfo &waitInOrderExecInfo, CommandToPatchContainer *outListCommands,
+                                                                                             bool relaxedOrderingAllowed, bool noopDispatch, bool dualStreamCopyOffloadOperation) const {
+    // regular and external counters may be patched or written outside of the driver, their values can't be tracked
+    if (!isImmediateType() || outListCommands || relaxedOrderingAllowed || noopDispatch ||
+        waitInOrderExecInfo.isRegularCmdList() || waitInOrderExecInfo.isExternalMemoryExecInfo()) {
+        return nullptr;
+    }
+
+    auto csr = getCsr(dualStreamCopyOffloadOperation);
+    if (!csr->getInOrderSatisfiedCounters() || csr->directSubmissionRelaxedOrderingEnabled()) {
+        return nullptr;
+    }
+
+    return csr;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -3001,6 +3059,31 @@ bool CommandListCoreFamily<gfxCoreFamily>::canSkipInOrderEventWait(Event &event,
     return false;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::compactCounterBasedWaitEvents(NEO::WaitListCompactor &compactor, uint32_t numEvents, ze_event_handle_t *phEvent) {
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto event = Event::fromHandle(phEvent[i]);
+        auto inOrderExecInfo = event->getInOrderExecInfo().get();
+
+        if (!event->isCounterBased() || !inOrderExecInfo || isCbEventBoundToCmdList(event) ||
+            (isImmediateType() && event->isAlreadyCompleted()) || canSkipInOrderEventWait(*event, this->allowCbWaitEventsNoopDispatch)) {
+            continue;
+        }
+        if (!this->heaplessModeEnabled && event->hasInOrderTimestampNode()) {
+            continue;
+        }
+
+        auto waitValue = !isImmediateType() ? event->getInOrderExecBaseSignalValue() : event->getInOrderExecSignalValueWithSubmissionCounter();
+        if (isImmediateType() && inOrderExecInfo->isCounterAlreadyDone(waitValue)) {
+            compactor.addCompletedWait(i);
+            continue;
+        }
+
+        compactor.addTimelineWait(i, {inOrderExecInfo, event->getInOrderAllocationOffset()}, waitValue);
+    }
+    compactor.compact();
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent, CommandToPatchContainer *outWaitCmds,
                                                                      bool relaxedOrderingAllowed, bool trackDependencies, bool apiRequest, bool skipAddingWaitEventsToResidency, bool skipFlush, bool copyOffloadOperation) {
@@ -3042,6 +3125,12 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t nu
         }
     }
 
+    NEO::WaitListCompactor waitListCompactor(numEvents);
+    if (NEO::WaitListCompactor::isEnabled() && !outWaitCmds && !this->asMutable()) {
+        compactCounterBasedWaitEvents(waitListCompactor, numEvents, phEvent);
+        waitListCompactor.printStats("zeCommandListAppendWaitOnEvents");
+    }
+
     for (uint32_t i = 0; i < numEvents; i++) {
         auto event = Event::fromHandle(phEvent[i]);
 
@@ -3049,7 +3138,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t nu
             return ZE_RESULT_ERROR_INVALID_ARGUMENT; // in-order event not signaled yet
         }
 
-        if ((isImmediateType() && event->isAlreadyCompleted()) ||
+        if (!waitListCompactor.isRequired(i) ||
+            (isImmediateType() && event->isAlreadyCompleted()) ||
             canSkipInOrderEventWait(*event, this->allowCbWaitEventsNoopDispatch)) {
             continue;
         }
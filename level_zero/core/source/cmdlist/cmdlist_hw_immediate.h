@@ -12,7 +12,9 @@
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw.h"
 
+#include <array>
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <mutex>
 
@@ -30,6 +32,15 @@ struct EventPool;
 struct Event;
 inline constexpr size_t commonImmediateCommandSize = 4 * MemoryConstants::kiloByte;
 
+enum class DeferredFlushReason : uint32_t {
+    appendCountLimit = 0,
+    sizeLimit,
+    timeLimit,
+    hostSynchronize,
+    dependency,
+    count
+};
+
 struct CpuMemCopyInfo {
     void *const dstPtr;
     void *const srcPtr;
@@ -61,6 +72,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     using ComputeFlushMethodType = NEO::CompletionStamp (CommandListCoreFamilyImmediate<gfxCoreFamily>::*)(NEO::LinearStream &, size_t, bool, bool, NEO::AppendOperations, bool);
 
     CommandListCoreFamilyImmediate(uint32_t numIddsPerBlock);
+    ~CommandListCoreFamilyImmediate() override;
 
     ze_result_t appendLaunchKernel(ze_kernel_handle_t kernelHandle,
                                    const ze_group_count_t &threadGroupDimensions,
@@ -185,6 +197,7 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
                                                uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) override;
 
     ze_result_t hostSynchronize(uint64_t timeout) override;
+    ze_result_t reset() override;
 
     ze_result_t close() override {
         return ZE_RESULT_SUCCESS;
@@ -230,6 +243,10 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     bool isBarrierRequired();
     bool isRelaxedOrderingDispatchAllowed(uint32_t numWaitEvents, bool copyOffload) override;
     bool skipInOrderNonWalkerSignalingAllowed(ze_event_handle_t signalEvent) const override;
+    void flushDeferredAppendsForHostWait() override;
+
+    uint64_t getDeferredFlushCount(DeferredFlushReason reason) const { return deferredFlushCounters[static_cast<size_t>(reason)]; }
+    uint32_t getDeferredAppendsCount() const { return deferredAppendsCount; }
 
   protected:
     using BaseClass::inOrderExecInfo;
@@ -244,11 +261,21 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void handleInOrderNonWalkerSignaling(Event *event, bool &hasStallingCmds, bool &relaxedOrderingDispatch, ze_result_t &result);
     CommandQueue *getCmdQImmediate(CopyOffloadMode copyOffloadMode) const;
     NEO::LinearStream *getOptionalEpilogueCmdStream(NEO::LinearStream *taskCmdStream, NEO::AppendOperations appendOperation);
+    bool isFlushDeferralAllowed(NEO::AppendOperations appendOperation, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, Event *signalEvent, bool requireTaskCountUpdate, MutexLock *outerLock) const;
+    DeferredFlushReason getDeferredFlushLimitReason() const;
+    void recordDeferredFlush(DeferredFlushReason reason);
+    ze_result_t flushDeferredAppends(DeferredFlushReason reason);
 
     MOCKABLE_VIRTUAL void checkAssert();
     ComputeFlushMethodType computeFlushMethod = nullptr;
+    std::array<uint64_t, static_cast<size_t>(DeferredFlushReason::count)> deferredFlushCounters = {};
+    std::chrono::steady_clock::time_point firstDeferredAppendTime;
+    std::recursive_mutex deferredAppendsMutex;
     uint64_t relaxedOrderingCounter = 0;
     std::atomic<bool> dependenciesPresent{false};
+    uint32_t deferredAppendsCount = 0;
+    bool appendInProgress = false;
+    bool registeredForDeferredAppends = false;
     bool latestFlushIsHostVisible = false;
     bool latestFlushIsDualCopyOffload = false;
     bool keepRelaxedOrderingEnabled = false;
@@ -24,6 +24,7 @@
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/utilities/tag_allocator.h"
 #include "shared/source/utilities/wait_util.h"
 
 #include "level_zero/core/source/cmdlist/cmdlist_hw_immediate.h"
@@ -49,10 +50,28 @@ CommandListCoreFamilyImmediate<gfxCoreFamily>::CommandListCoreFamilyImmediate(ui
     computeFlushMethod = &CommandListCoreFamilyImmediate<gfxCoreFamily>::flushRegularTask;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+CommandListCoreFamilyImmediate<gfxCoreFamily>::~CommandListCoreFamilyImmediate() {
+    if (this->registeredForDeferredAppends) {
+        static_cast<DriverHandleImp *>(this->device->getDriverHandle())->removeCmdListWithDeferredAppends(this);
+    }
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies, size_t commandSize, bool requestCommandBufferInLocalMem) {
+    if (NEO::debugManager.flags.EnableImmediateCmdListDeferredFlush.get() == 1) {
+        // commands of this append are not complete until its flush, host waits of other threads must not submit them
+        std::lock_guard<std::recursive_mutex> lock(this->deferredAppendsMutex);
+        this->appendInProgress = true;
+    }
+
     this->commandContainer.fillReusableAllocationLists();
 
+    if (hasRelaxedOrderingDependencies) {
+        // relaxed ordering dispatch has to start at the beginning of the submitted batch
+        flushDeferredAppends(DeferredFlushReason::dependency);
+    }
+
     // Command container might have two command buffers - one in local mem (mainly for relaxed ordering and any other specific purposes) and one in system mem for copying into ring buffer.
     // If relaxed ordering is needed in given dispatch or if we need to force Local mem usage, and current command stream is in system memory, swap of command streams is required to ensure local memory.
     // If relaxed ordering is not needed and command buffer is in local mem, then also we need to swap.
@@ -70,6 +89,7 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t
     }
 
     if (swapStreams) {
+        flushDeferredAppends(DeferredFlushReason::dependency);
         if (this->commandContainer.swapStreams()) {
             this->cmdListCurrentStartOffset = this->commandContainer.getCommandStream()->getUsed();
         }
@@ -77,6 +97,7 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t
 
     size_t semaphoreSize = NEO::EncodeSemaphore<GfxFamily>::getSizeMiSemaphoreWait() * numEvents;
     if (this->commandContainer.getCommandStream()->getAvailableSpace() < commandSize + semaphoreSize) {
+        flushDeferredAppends(DeferredFlushReason::sizeLimit);
         bool requireSystemMemoryCommandBuffer = !hasRelaxedOrderingDependencies && !requestCommandBufferInLocalMem;
 
         auto alloc = this->commandContainer.reuseExistingCmdBuffer(requireSystemMemoryCommandBuffer);
@@ -1115,7 +1136,13 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendSignalExternalS
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint64_t timeout, bool handlePostWaitOperations) {
-    ze_result_t status = ZE_RESULT_SUCCESS;
+    ze_result_t status = flushDeferredAppends(DeferredFlushReason::hostSynchronize);
+    if (status != ZE_RESULT_SUCCESS) {
+        return status;
+    }
+    if (NEO::debugManager.flags.EnableImmediateCmdListDeferredFlush.get() == 1) {
+        static_cast<DriverHandleImp *>(this->device->getDriverHandle())->flushDeferredCmdListAppends();
+    }
 
     auto waitQueue = this->cmdQImmediate;
 
@@ -1218,6 +1245,99 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint6
     return hostSynchronize(timeout, true);
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::reset() {
+    flushDeferredAppends(DeferredFlushReason::hostSynchronize);
+    return BaseClass::reset();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isFlushDeferralAllowed(NEO::AppendOperations appendOperation, bool hasStallingCmds, bool hasRelaxedOrderingDependencies, Event *signalEvent,
+                                                                           bool requireTaskCountUpdate, MutexLock *outerLock) const {
+    if (NEO::debugManager.flags.EnableImmediateCmdListDeferredFlush.get() != 1) {
+        return false;
+    }
+
+    // only independent appends are deferred, anything observable from host or other lists is submitted immediately
+    if (appendOperation != NEO::AppendOperations::kernel || hasStallingCmds || hasRelaxedOrderingDependencies || signalEvent || requireTaskCountUpdate || outerLock) {
+        return false;
+    }
+
+    // temporary allocations are stored with CSR task count known at append time and must be submitted with it
+    if (this->isSyncModeQueue || isInOrderExecutionEnabled() || this->kernelWithAssertAppended || this->temporaryAllocationStored) {
+        return false;
+    }
+
+    // stream state is programmed once per submission, only stateless flush allows mixing kernels in one batch
+    return !isCopyOnly(false) && !isDualStreamCopyOffloadOperation(isCopyOffloadEnabled()) &&
+           this->computeFlushMethod == &CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediateRegularTaskStateless;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+DeferredFlushReason CommandListCoreFamilyImmediate<gfxCoreFamily>::getDeferredFlushLimitReason() const {
+    int32_t maxAppends = 32;
+    if (NEO::debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.get() != -1) {
+        maxAppends = NEO::debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.get();
+    }
+    if (static_cast<int64_t>(this->deferredAppendsCount) + 1 >= maxAppends) {
+        return DeferredFlushReason::appendCountLimit;
+    }
+
+    int64_t maxBytes = 64 * MemoryConstants::kiloByte;
+    if (NEO::debugManager.flags.ImmediateCmdListDeferredFlushMaxBytes.get() != -1) {
+        maxBytes = NEO::debugManager.flags.ImmediateCmdListDeferredFlushMaxBytes.get();
+    }
+    if (static_cast<int64_t>(this->commandContainer.getCommandStream()->getUsed() - this->cmdListCurrentStartOffset) >= maxBytes) {
+        return DeferredFlushReason::sizeLimit;
+    }
+
+    if (this->deferredAppendsCount > 0) {
+        int64_t timeoutUs = 100;
+        if (NEO::debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.get() != -1) {
+            timeoutUs = NEO::debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.get();
+        }
+        auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - this->firstDeferredAppendTime).count();
+        if (elapsedUs >= timeoutUs) {
+            return DeferredFlushReason::timeLimit;
+        }
+    }
+
+    return DeferredFlushReason::count;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::recordDeferredFlush(DeferredFlushReason reason) {
+    this->deferredFlushCounters[static_cast<size_t>(reason)]++;
+
+    constexpr const char *reasonNames[] = {"append count limit", "size limit", "time limit", "host synchronize", "dependency"};
+    PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintImmediateCmdListDeferredFlush.get(), stdout, "Immediate command list deferred flush: %u appends pending, reason: %s\n",
+                       this->deferredAppendsCount, reasonNames[static_cast<size_t>(reason)]);
+
+    this->deferredAppendsCount = 0;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushDeferredAppends(DeferredFlushReason reason) {
+    std::lock_guard<std::recursive_mutex> lock(this->deferredAppendsMutex);
+    if (this->deferredAppendsCount == 0) {
+        return ZE_RESULT_SUCCESS;
+    }
+    recordDeferredFlush(reason);
+
+    constexpr bool requireTaskCountUpdate = true;
+    return flushImmediate(ZE_RESULT_SUCCESS, true, false, false, NEO::AppendOperations::kernel, false, nullptr, requireTaskCountUpdate, nullptr, nullptr);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::flushDeferredAppendsForHostWait() {
+    std::unique_lock<std::recursive_mutex> lock(this->deferredAppendsMutex, std::try_to_lock);
+    // append in progress checks flush bounds itself once its commands are complete
+    if (!lock.owns_lock() || this->appendInProgress) {
+        return;
+    }
+    flushDeferredAppends(DeferredFlushReason::hostSynchronize);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 CommandQueue *CommandListCoreFamilyImmediate<gfxCoreFamily>::getCmdQImmediate(CopyOffloadMode copyOffloadMode) const {
     return (copyOffloadMode == CopyOffloadModes::dualStream) ? this->cmdQImmediateCopyOffload : this->cmdQImmediate;
@@ -1246,10 +1366,32 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
     auto queue = getCmdQImmediate(copyOffloadModeForOperation);
     this->latestFlushIsDualCopyOffload = (copyOffloadModeForOperation == CopyOffloadModes::dualStream);
 
-    if (NEO::debugManager.flags.DeferStateInitSubmissionToFirstRegularUsage.get() == 1) {
+    if (NEO::Device::isStateInitSubmissionDeferred()) {
         static_cast<CommandQueueImp *>(queue)->getCsr()->ensurePrimaryCsrInitialized(*this->device->getNEODevice());
     }
 
+    if (inputRet == ZE_RESULT_SUCCESS && this->isFlushTaskSubmissionEnabled) {
+        if (isFlushDeferralAllowed(appendOperation, hasStallingCmds, hasRelaxedOrderingDependencies, signalEvent, requireTaskCountUpdate, outerLock)) {
+            auto limitReason = getDeferredFlushLimitReason();
+            if (limitReason == DeferredFlushReason::count) {
+                std::lock_guard<std::recursive_mutex> lock(this->deferredAppendsMutex);
+                if (this->deferredAppendsCount == 0) {
+                    this->firstDeferredAppendTime = std::chrono::steady_clock::now();
+                }
+                if (!this->registeredForDeferredAppends) {
+                    static_cast<DriverHandleImp *>(this->device->getDriverHandle())->addCmdListWithDeferredAppends(this);
+                    this->registeredForDeferredAppends = true;
+                }
+                this->deferredAppendsCount++;
+                this->appendInProgress = false;
+                return inputRet;
+            }
+            recordDeferredFlush(limitReason);
+        } else if (this->deferredAppendsCount > 0) {
+            recordDeferredFlush(DeferredFlushReason::dependency);
+        }
+    }
+
     if (inputRet == ZE_RESULT_SUCCESS) {
         if (this->isFlushTaskSubmissionEnabled) {
             if (signalEvent && (NEO::debugManager.flags.TrackNumCsrClientsOnSyncPoints.get() != 0)) {
@@ -1260,6 +1402,44 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediate(ze_res
         } else {
             inputRet = executeCommandListImmediate(performMigration);
         }
+        this->temporaryAllocationStored = false;
+    }
+
+    if (!this->pendingInOrderWaits.empty()) {
+        auto csr = static_cast<CommandQueueImp *>(queue)->getCsr();
+        // semaphores are known to engine only after submission, ordering of relaxed dispatch is not guaranteed
+        if (inputRet == ZE_RESULT_SUCCESS && !hasRelaxedOrderingDependencies) {
+            for (auto &wait : this->pendingInOrderWaits) {
+                if (wait.csr == csr) {
+                    csr->getInOrderSatisfiedCounters()->markSatisfied(wait.timelineId, wait.offset, wait.waitValue);
+                }
+            }
+        }
+        this->pendingInOrderWaits.clear();
+    }
+
+    if (!this->kernelTimingRecords.empty()) {
+        auto csr = static_cast<CommandQueueImp *>(queue)->getCsr();
+        if (inputRet == ZE_RESULT_SUCCESS) {
+            this->kernelTimingTrace->submit(*this->device->getNEODevice(), *csr, csr->peekTaskCount(), this->kernelTimingQueueId, std::move(this->kernelTimingRecords));
+        } else {
+            for (auto &record : this->kernelTimingRecords) {
+                record.timestampNode->returnTag();
+            }
+        }
+        this->kernelTimingRecords.clear();
+    }
+
+    if (!this->lwsAutotuneRecords.empty()) {
+        auto csr = static_cast<CommandQueueImp *>(queue)->getCsr();
+        if (inputRet == ZE_RESULT_SUCCESS) {
+            this->localWorkSizeAutotuner->submit(*csr, csr->peekTaskCount(), std::move(this->lwsAutotuneRecords));
+        } else {
+            for (auto &record : this->lwsAutotuneRecords) {
+                record.timestampNode->returnTag();
+            }
+        }
+        this->lwsAutotuneRecords.clear();
     }
 
     this->latestFlushIsHostVisible = !this->dcFlushSupport;
@@ -1752,7 +1932,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendCommandLists(ui
 
     bool copyEngineExecution = isCopyOnly(copyOffloadOperation);
 
-    auto ret = ZE_RESULT_SUCCESS;
+    auto ret = flushDeferredAppends(DeferredFlushReason::dependency);
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
     checkAvailableSpace(numWaitEvents,
                         relaxedOrderingDispatch,
                         commonImmediateCommandSize,
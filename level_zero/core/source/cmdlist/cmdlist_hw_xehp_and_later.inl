@@ -374,6 +374,33 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         isFlushL3ForExternalAllocationRequired = true;
         isFlushL3ForHostUsmRequired = false;
     }
+    bool inOrderSignalMovedFromWalker = false;
+    if (!launchParams.makeKernelCommandView && (eventAddress == 0) && !compactEvent) {
+        NEO::TagNodeBase *borrowedTimestampNode = nullptr;
+        if (this->kernelTimingTrace) {
+            borrowedTimestampNode = borrowWalkerPostSyncForTimestamps(borrowedTimestampNode, eventAddress, isTimestampEvent);
+            borrowedTimestampNode->setPacketsUsed(this->partitionCount);
+            this->kernelTimingRecords.push_back({borrowedTimestampNode, kernelDescriptor.kernelMetadata.kernelName, this->kernelTimingTrace->getNextApiCallId()});
+            if (inOrderExecInfo) {
+                // walker post sync writes timestamps, in-order counter is signaled once the walker completes
+                inOrderExecInfo = nullptr;
+                inOrderCounterValue = 0;
+                inOrderIncrementGpuAddress = 0;
+                inOrderIncrementValue = 0;
+                isCounterBasedEvent = false;
+                inOrderSignalMovedFromWalker = true;
+            }
+        }
+        if (this->localWorkSizeAutotuner && !launchParams.isIndirect && !inOrderExecInfo && (this->partitionCount == 1)) {
+            // measure candidate local work size suggested by autotuner
+            auto lwsAutotuneTrial = kernelImp->getLocalWorkSizeAutotuneTrial(threadGroupDimensions);
+            if (lwsAutotuneTrial) {
+                borrowedTimestampNode = borrowWalkerPostSyncForTimestamps(borrowedTimestampNode, eventAddress, isTimestampEvent);
+                this->lwsAutotuneRecords.push_back({borrowedTimestampNode, *lwsAutotuneTrial});
+            }
+        }
+    }
+
     NEO::EncodeKernelArgsExt dispatchKernelArgsExt = {};
 
     NEO::EncodeDispatchKernelArgs dispatchKernelArgs{
@@ -502,6 +529,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
                     this->latestOperationHasOptimizedCbEvent = true;
                 }
             }
+        } else if (inOrderSignalMovedFromWalker) {
+            launchParams.skipInOrderNonWalkerSignaling = false;
+            appendSignalInOrderDependencyCounter(eventForInOrderExec, false, true, textureFlushRequired);
+            textureFlushRequired = false;
         } else {
             launchParams.skipInOrderNonWalkerSignaling = false;
             UNRECOVERABLE_IF(!dispatchKernelArgs.outWalkerPtr);
@@ -151,6 +151,10 @@ NEO::SubmissionStatus CommandQueueImp::submitBatchBuffer(size_t offset, NEO::Res
 }
 
 ze_result_t CommandQueueImp::synchronize(uint64_t timeout) {
+    if (NEO::debugManager.flags.EnableImmediateCmdListDeferredFlush.get() == 1) {
+        static_cast<DriverHandleImp *>(device->getDriverHandle())->flushDeferredCmdListAppends();
+    }
+
     if ((timeout == std::numeric_limits<uint64_t>::max()) && useKmdWaitFunction) {
         auto &waitPair = buffers.getCurrentFlushStamp();
         const auto waitStatus = csr->waitForTaskCountWithKmdNotifyFallback(waitPair.first, waitPair.second, false, NEO::QueueThrottle::MEDIUM);
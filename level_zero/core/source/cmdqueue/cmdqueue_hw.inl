@@ -70,7 +70,7 @@ ze_result_t CommandQueueHw<gfxCoreFamily>::executeCommandLists(
 
     this->device->activateMetricGroups();
 
-    if (NEO::debugManager.flags.DeferStateInitSubmissionToFirstRegularUsage.get() == 1) {
+    if (NEO::Device::isStateInitSubmissionDeferred()) {
         this->csr->ensurePrimaryCsrInitialized(*this->device->getNEODevice());
     }
 
@@ -1637,6 +1637,9 @@ void DeviceImp::releaseResources() {
 
     UNRECOVERABLE_IF(neoDevice == nullptr);
 
+    // pending completion watches may return timestamp tags to allocators of this device
+    neoDevice->getExecutionEnvironment()->drainCompletionReactor();
+
     if (this->globalTimestampAllocation) {
         driverHandle->getSvmAllocsManager()->freeSVMAlloc(this->globalTimestampAllocation);
     }
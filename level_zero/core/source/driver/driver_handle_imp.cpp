@@ -27,6 +27,7 @@
 #include "shared/source/utilities/logger.h"
 
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
+#include "level_zero/core/source/cmdlist/cmdlist.h"
 #include "level_zero/core/source/context/context_imp.h"
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/driver/driver_imp.h"
@@ -41,6 +42,7 @@
 
 #include "driver_version.h"
 
+#include <algorithm>
 #include <cstdarg>
 #include <cstdlib>
 #include <cstring>
@@ -1059,6 +1061,28 @@ uint32_t DriverHandleImp::getEventMaxKernelCount(uint32_t numDevices, ze_device_
     return maxCount;
 }
 
+void DriverHandleImp::addCmdListWithDeferredAppends(CommandList *commandList) {
+    std::lock_guard<std::recursive_mutex> lock(this->cmdListsWithDeferredAppendsMutex);
+    this->cmdListsWithDeferredAppends.push_back(commandList);
+}
+
+void DriverHandleImp::removeCmdListWithDeferredAppends(CommandList *commandList) {
+    std::lock_guard<std::recursive_mutex> lock(this->cmdListsWithDeferredAppendsMutex);
+    auto it = std::find(this->cmdListsWithDeferredAppends.begin(), this->cmdListsWithDeferredAppends.end(), commandList);
+    if (it != this->cmdListsWithDeferredAppends.end()) {
+        this->cmdListsWithDeferredAppends.erase(it);
+    }
+}
+
+void DriverHandleImp::flushDeferredCmdListAppends() {
+    // command lists are removed on destruction only, lock is held so none of them can be destroyed meanwhile
+    std::lock_guard<std::recursive_mutex> lock(this->cmdListsWithDeferredAppendsMutex);
+    auto cmdLists = this->cmdListsWithDeferredAppends;
+    for (auto cmdList : cmdLists) {
+        cmdList->flushDeferredAppendsForHostWait();
+    }
+}
+
 int DriverHandleImp::setErrorDescription(const std::string &str) {
     return this->devices[0]->getNEODevice()->getExecutionEnvironment()->setErrorDescription(str);
 }
@@ -19,12 +19,14 @@
 #include <map>
 #include <mutex>
 #include <unordered_map>
+#include <vector>
 
 namespace L0 {
 class HostPointerManager;
 struct FabricVertex;
 struct FabricEdge;
 struct Image;
+struct CommandList;
 class ExternalSemaphoreController;
 
 #pragma pack(1)
@@ -125,6 +127,11 @@ struct DriverHandleImp : public DriverHandle {
     void initHostUsmAllocPool();
     void initDeviceUsmAllocPool(NEO::Device &device);
 
+    // Immediate command lists which deferred appends, pending ones are submitted by any host wait of the driver.
+    void addCmdListWithDeferredAppends(CommandList *commandList);
+    void removeCmdListWithDeferredAppends(CommandList *commandList);
+    void flushDeferredCmdListAppends();
+
     std::unique_ptr<HostPointerManager> hostPointerManager;
 
     std::mutex sharedMakeResidentAllocationsLock;
@@ -155,6 +162,9 @@ struct DriverHandleImp : public DriverHandle {
     std::unique_ptr<ExternalSemaphoreController> externalSemaphoreController;
     std::mutex externalSemaphoreControllerMutex;
 
+    std::vector<CommandList *> cmdListsWithDeferredAppends;
+    std::recursive_mutex cmdListsWithDeferredAppendsMutex;
+
     uint32_t numDevices = 0;
 
     std::map<uint64_t, IpcHandleTracking *> ipcHandles;
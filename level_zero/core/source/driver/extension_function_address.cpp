@@ -58,6 +58,10 @@ void *ExtensionFunctionAddressHelper::getExtensionFunctionAddress(const std::str
     RETURN_FUNC_PTR_IF_EXIST(zexCounterBasedEventGetIpcHandle);
     RETURN_FUNC_PTR_IF_EXIST(zexCounterBasedEventOpenIpcHandle);
     RETURN_FUNC_PTR_IF_EXIST(zexCounterBasedEventCloseIpcHandle);
+    RETURN_FUNC_PTR_IF_EXIST(zexEventHostSynchronizeMultiple);
+    RETURN_FUNC_PTR_IF_EXIST(zexEventSetCompletionCallback);
+    RETURN_FUNC_PTR_IF_EXIST(zexEventGetCompletionNotificationFd);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandQueueGetCompletionNotificationFd);
 
     RETURN_FUNC_PTR_IF_EXIST(zeMemGetPitchFor2dImage);
     RETURN_FUNC_PTR_IF_EXIST(zeImageGetDeviceOffsetExp);
@@ -20,6 +20,7 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
+#include "shared/source/utilities/completion_reactor.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/timestamp_pool_allocator.h"
 #include "shared/source/utilities/wait_util.h"
@@ -34,6 +35,8 @@
 #include "level_zero/core/source/event/event_impl.inl"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 
+#include <algorithm>
+#include <map>
 #include <set>
 
 namespace L0 {
@@ -141,16 +144,32 @@ ze_result_t EventPool::initialize(DriverHandle *driver, Context *context, uint32
         }
     } else {
         this->isHostVisibleEventPoolAllocation = true;
-        NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), this->eventPoolSize, allocationType, systemMemoryBitfield};
-        allocationProperties.alignment = eventAlignment;
 
-        eventPoolPtr = driver->getMemoryManager()->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndices,
-                                                                                                   allocationProperties,
-                                                                                                   *eventPoolAllocations);
-        if (isIpcPoolFlagSet()) {
-            this->isShareableEventMemory = eventPoolAllocations->getDefaultGraphicsAllocation()->isShareableHostMemory();
+        auto &hostTimestampPoolAllocator = neoDevice->getHostTimestampPoolAllocator();
+        if (hostTimestampPoolAllocator.isEnabled() &&
+            rootDeviceIndices.size() == 1 &&
+            !isIpcPoolFlagSet()) {
+            auto sharedTsAlloc = hostTimestampPoolAllocator.requestGraphicsAllocationForTimestamp(this->eventPoolSize);
+            if (sharedTsAlloc) {
+                this->sharedTimestampAllocation.reset(sharedTsAlloc);
+                eventPoolAllocations->addAllocation(this->sharedTimestampAllocation->getGraphicsAllocation());
+                eventPoolPtr = ptrOffset(this->sharedTimestampAllocation->getGraphicsAllocation()->getUnderlyingBuffer(), this->sharedTimestampAllocation->getOffset());
+                allocatedMemory = true;
+            }
+        }
+
+        if (!allocatedMemory) {
+            NEO::AllocationProperties allocationProperties{*rootDeviceIndices.begin(), this->eventPoolSize, allocationType, systemMemoryBitfield};
+            allocationProperties.alignment = eventAlignment;
+
+            eventPoolPtr = driver->getMemoryManager()->createMultiGraphicsAllocationInSystemMemoryPool(rootDeviceIndices,
+                                                                                                       allocationProperties,
+                                                                                                       *eventPoolAllocations);
+            if (isIpcPoolFlagSet()) {
+                this->isShareableEventMemory = eventPoolAllocations->getDefaultGraphicsAllocation()->isShareableHostMemory();
+            }
+            allocatedMemory = (nullptr != eventPoolPtr);
         }
-        allocatedMemory = (nullptr != eventPoolPtr);
     }
 
     if (!allocatedMemory) {
@@ -175,7 +194,8 @@ EventPool::~EventPool() {
     }
     if (this->sharedTimestampAllocation) {
         auto neoDevice = devices[0]->getNEODevice();
-        neoDevice->getDeviceTimestampPoolAllocator().freeSharedTimestampAllocation(this->sharedTimestampAllocation.release());
+        auto &timestampPoolAllocator = this->isDeviceEventPoolAllocation ? neoDevice->getDeviceTimestampPoolAllocator() : neoDevice->getHostTimestampPoolAllocator();
+        timestampPoolAllocator.freeSharedTimestampAllocation(this->sharedTimestampAllocation.release());
     }
 }
 
@@ -526,6 +546,201 @@ ze_result_t EventPool::openEventPoolIpcHandle(const ze_ipc_event_pool_handle_t &
     return ZE_RESULT_SUCCESS;
 }
 
+void Event::flushDeferredCmdListAppends() {
+    if (NEO::debugManager.flags.EnableImmediateCmdListDeferredFlush.get() == 1) {
+        static_cast<DriverHandleImp *>(this->device->getDriverHandle())->flushDeferredCmdListAppends();
+    }
+}
+
+ze_result_t Event::hostSynchronizeMultiple(uint32_t numEvents, Event **events, uint64_t timeout, bool waitAll, uint32_t *signaledEventIndex) {
+    if (numEvents == 0 || events == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    for (uint32_t i = 0; i < numEvents; i++) {
+        if (events[i] == nullptr) {
+            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+    events[0]->flushDeferredCmdListAppends();
+
+    // aub csr completes waits only through its own host synchronization, events are waited one by one then
+    auto isAubCsrUsed = [](Event *event) { return event->csrs[0]->getType() == NEO::CommandStreamReceiverType::aub; };
+    if (numEvents == 1 || std::any_of(events, events + numEvents, isAubCsrUsed)) {
+        if (!waitAll) {
+            // an already signaled event completes the wait, otherwise the first event on aub csr which signals once polled
+            auto signaledEvent = std::find_if(events, events + numEvents, [](Event *event) { return event->queryStatus() == ZE_RESULT_SUCCESS; });
+            if (signaledEvent == events + numEvents) {
+                signaledEvent = std::find_if(events, events + numEvents, isAubCsrUsed);
+            }
+            if (signaledEvent == events + numEvents) {
+                signaledEvent = events;
+            }
+            auto ret = (*signaledEvent)->hostSynchronize(timeout);
+            if (ret == ZE_RESULT_SUCCESS && signaledEventIndex) {
+                *signaledEventIndex = static_cast<uint32_t>(signaledEvent - events);
+            }
+            return ret;
+        }
+        for (uint32_t i = 0; i < numEvents; i++) {
+            auto ret = events[i]->hostSynchronize(timeout);
+            if (ret != ZE_RESULT_SUCCESS) {
+                return ret;
+            }
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
+    if (NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get() != -1) {
+        timeout = NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get();
+    }
+
+    // Counter based events signaled by the same csr through the same counter memory are polled once,
+    // using the latest (wait all) or the earliest (wait any) signal value
+    StackVec<uint32_t, 32> eventsToPoll;
+    std::map<std::pair<const NEO::CommandStreamReceiver *, const uint64_t *>, size_t> pollIndexForCounter;
+    StackVec<NEO::CommandStreamReceiver *, 4> csrsForHangCheck;
+    bool userFenceWaitForAll = true;
+
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto event = events[i];
+
+        if (std::find(csrsForHangCheck.begin(), csrsForHangCheck.end(), event->csrs[0]) == csrsForHangCheck.end()) {
+            csrsForHangCheck.push_back(event->csrs[0]);
+        }
+        userFenceWaitForAll &= event->isKmdWaitModeEnabled() && event->isCounterBased() && event->csrs[0]->waitUserFenceSupported();
+
+        if (event->isCounterBased() && event->inOrderExecInfo && !event->isAlreadyCompleted()) {
+            const auto counterKey = std::make_pair(event->csrs[0], ptrOffset(event->inOrderExecInfo->getBaseHostAddress(), event->getInOrderAllocationOffset()));
+            auto counterIt = pollIndexForCounter.find(counterKey);
+            if (counterIt != pollIndexForCounter.end()) {
+                auto &polledIndex = eventsToPoll[counterIt->second];
+                auto signalValue = event->getInOrderExecSignalValueWithSubmissionCounter();
+                auto polledSignalValue = events[polledIndex]->getInOrderExecSignalValueWithSubmissionCounter();
+                if (waitAll ? (signalValue > polledSignalValue) : (signalValue < polledSignalValue)) {
+                    polledIndex = i;
+                }
+                continue;
+            }
+            pollIndexForCounter[counterKey] = eventsToPoll.size();
+        }
+        eventsToPoll.push_back(i);
+    }
+
+    const auto waitStartTime = std::chrono::high_resolution_clock::now();
+    auto lastHangCheckTime = waitStartTime;
+    auto remainingTimeout = [&]() -> uint64_t {
+        if (timeout == std::numeric_limits<uint64_t>::max()) {
+            return timeout;
+        }
+        uint64_t timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - waitStartTime).count();
+        return timeDiff < timeout ? timeout - timeDiff : 0;
+    };
+
+    if (waitAll && userFenceWaitForAll && csrsForHangCheck.size() == 1) {
+        for (auto &polledIndex : eventsToPoll) {
+            auto ret = events[polledIndex]->hostSynchronize(remainingTimeout());
+            if (ret != ZE_RESULT_SUCCESS) {
+                return ret;
+            }
+        }
+        eventsToPoll.clear();
+    }
+
+    while (!eventsToPoll.empty()) {
+        for (size_t i = 0; i < eventsToPoll.size();) {
+            auto polledIndex = eventsToPoll[i];
+            if (events[polledIndex]->queryStatus() != ZE_RESULT_SUCCESS) {
+                i++;
+                continue;
+            }
+            if (!waitAll) {
+                if (signaledEventIndex) {
+                    *signaledEventIndex = polledIndex;
+                }
+                return events[polledIndex]->hostSynchronize(remainingTimeout());
+            }
+            eventsToPoll[i] = eventsToPoll[eventsToPoll.size() - 1];
+            eventsToPoll.pop_back();
+        }
+
+        if (eventsToPoll.empty()) {
+            break;
+        }
+
+        auto currentTime = std::chrono::high_resolution_clock::now();
+        auto elapsedTimeSinceGpuHangCheck = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastHangCheckTime);
+        if (elapsedTimeSinceGpuHangCheck.count() >= events[0]->gpuHangCheckPeriod.count()) {
+            lastHangCheckTime = currentTime;
+            for (auto &csr : csrsForHangCheck) {
+                if (csr->isGpuHangDetected()) {
+                    return ZE_RESULT_ERROR_DEVICE_LOST;
+                }
+            }
+        }
+
+        if (remainingTimeout() == 0) {
+            return ZE_RESULT_NOT_READY;
+        }
+
+        // back off between polling rounds, after the waitpkg threshold this pauses the core instead of spinning
+        const auto timeElapsedSinceWaitStarted = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count();
+        NEO::WaitUtils::waitFunction(nullptr, 0u, timeElapsedSinceWaitStarted);
+    }
+
+    // all events are completed, finalize synchronization (printf, asserts, L3 flush, timestamps) for each of them
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto ret = events[i]->hostSynchronize(remainingTimeout());
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t Event::registerCompletionWatch(std::function<void(bool gpuHangDetected)> &&callback, int notificationFd) {
+    if (!completionWatchToken) {
+        completionWatchToken = std::make_shared<NEO::CompletionWatchToken>();
+    }
+
+    NEO::CompletionWatch watch;
+    watch.csr = csrs[0];
+    watch.notificationFd = notificationFd;
+    watch.cancellationToken = completionWatchToken;
+
+    if (isCounterBased() && inOrderExecInfo) {
+        watch.pollAddress = ptrOffset(inOrderExecInfo->getBaseHostAddress(), this->inOrderAllocationOffset);
+        watch.waitValue = getInOrderExecSignalValueWithSubmissionCounter();
+        watch.partitionCount = inOrderExecInfo->getNumHostPartitionsToWait();
+        watch.partitionOffset = device->getL0GfxCoreHelper().getImmediateWritePostSyncOffset();
+        if (inOrderExecInfo->isExternalMemoryExecInfo()) {
+            watch.pollAllocation = inOrderExecInfo->getExternalHostAllocation();
+        } else {
+            watch.pollAllocation = inOrderExecInfo->isHostStorageDuplicated() ? inOrderExecInfo->getHostCounterAllocation() : inOrderExecInfo->getDeviceCounterAllocation();
+        }
+        // counter storage must outlive the watch, even if event is reused in the meantime
+        watch.callback = [counterStorage = this->inOrderExecInfo, callback = std::move(callback)](bool gpuHangDetected) {
+            if (callback) {
+                callback(gpuHangDetected);
+            }
+        };
+    } else {
+        // event is accessed only while cancellation token is not cancelled, destroy() and reset() cancel it
+        watch.completionCheck = [this]() { return this->queryStatus() == ZE_RESULT_SUCCESS; };
+        watch.callback = std::move(callback);
+    }
+
+    device->getNEODevice()->getExecutionEnvironment()->getCompletionReactor()->registerWatch(std::move(watch));
+    return ZE_RESULT_SUCCESS;
+}
+
+void Event::cancelCompletionWatches() {
+    if (completionWatchToken) {
+        completionWatchToken->cancel();
+        completionWatchToken.reset();
+    }
+}
+
 void Event::releaseTempInOrderTimestampNodes() {
     if (inOrderExecInfo) {
         inOrderExecInfo->releaseNotUsedTempTimestampNodes(false);
@@ -533,6 +748,7 @@ void Event::releaseTempInOrderTimestampNodes() {
 }
 
 ze_result_t Event::destroy() {
+    cancelCompletionWatches();
     resetInOrderTimestampNode(nullptr, 0);
     releaseTempInOrderTimestampNodes();
     resetAdditionalTimestampNode(nullptr, 0);
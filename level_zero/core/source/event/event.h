@@ -37,6 +37,7 @@ class GraphicsAllocation;
 class MultiGraphicsAllocation;
 struct RootDeviceEnvironment;
 class InOrderExecInfo;
+class CompletionWatchToken;
 } // namespace NEO
 
 namespace L0 {
@@ -146,6 +147,10 @@ struct Event : _ze_event_handle_t {
 
     ze_result_t getCounterBasedIpcHandle(IpcCounterBasedEventData &ipcData);
 
+    static ze_result_t hostSynchronizeMultiple(uint32_t numEvents, Event **events, uint64_t timeout, bool waitAll, uint32_t *signaledEventIndex);
+    ze_result_t registerCompletionWatch(std::function<void(bool gpuHangDetected)> &&callback, int notificationFd);
+    void cancelCompletionWatches();
+
     inline ze_event_handle_t toHandle() { return this; }
 
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation *getAllocation(Device *device) const;
@@ -349,6 +354,7 @@ struct Event : _ze_event_handle_t {
 
     void unsetCmdQueue();
     void releaseTempInOrderTimestampNodes();
+    void flushDeferredCmdListAppends();
     virtual void clearTimestampTagData(uint32_t partitionCount, NEO::TagNodeBase *newNode) = 0;
 
     EventPool *eventPool = nullptr;
@@ -387,6 +393,7 @@ struct Event : _ze_event_handle_t {
     std::weak_ptr<Kernel> kernelWithPrintf = std::weak_ptr<Kernel>{};
     std::mutex *kernelWithPrintfDeviceMutex = nullptr;
     std::shared_ptr<NEO::InOrderExecInfo> inOrderExecInfo;
+    std::shared_ptr<NEO::CompletionWatchToken> completionWatchToken;
     CommandQueue *latestUsedCmdQueue = nullptr;
     std::vector<NEO::TagNodeBase *> inOrderTimestampNode;
     std::vector<NEO::TagNodeBase *> additionalTimestampNode;
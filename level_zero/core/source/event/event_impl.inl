@@ -724,6 +724,8 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
         UNRECOVERABLE_IF(!this->isSignalScope(ZE_EVENT_SCOPE_FLAG_HOST));
     }
 
+    this->flushDeferredCmdListAppends();
+
     if (this->csrs[0]->getType() == NEO::CommandStreamReceiverType::aub) {
         this->csrs[0]->pollForAubCompletion();
         return ZE_RESULT_SUCCESS;
@@ -828,6 +830,7 @@ ze_result_t EventImp<TagSizeT>::reset() {
         hostSynchronize(std::numeric_limits<uint64_t>::max());
     }
 
+    this->cancelCompletionWatches();
     unsetInOrderExecInfo();
     unsetCmdQueue();
     this->resetCompletionStatus();
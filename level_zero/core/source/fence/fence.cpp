@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,8 +8,11 @@
 #include "level_zero/core/source/fence/fence.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 
 #include "level_zero/core/source/cmdqueue/cmdqueue_imp.h"
+#include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/driver/driver_handle_imp.h"
 
 namespace L0 {
 namespace FenceDefinition {
@@ -53,6 +56,10 @@ ze_result_t Fence::hostSynchronize(uint64_t timeout) {
     ze_result_t ret = ZE_RESULT_NOT_READY;
     const auto csr = cmdQueue->getCsr();
 
+    if (NEO::debugManager.flags.EnableImmediateCmdListDeferredFlush.get() == 1) {
+        static_cast<DriverHandleImp *>(cmdQueue->getDevice()->getDriverHandle())->flushDeferredCmdListAppends();
+    }
+
     if (csr->getType() == NEO::CommandStreamReceiverType::aub) {
         return ZE_RESULT_SUCCESS;
     }
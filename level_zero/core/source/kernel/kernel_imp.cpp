@@ -444,6 +444,51 @@ ze_result_t KernelImp::setGroupSize(uint32_t groupSizeX, uint32_t groupSizeY,
 ze_result_t KernelImp::suggestGroupSize(uint32_t globalSizeX, uint32_t globalSizeY,
                                         uint32_t globalSizeZ, uint32_t *groupSizeX,
                                         uint32_t *groupSizeY, uint32_t *groupSizeZ) {
+    auto result = suggestDefaultGroupSize(globalSizeX, globalSizeY, globalSizeZ, groupSizeX, groupSizeY, groupSizeZ);
+    if (result != ZE_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto neoDevice = module->getDevice()->getNEODevice();
+    auto autotuner = neoDevice->getExecutionEnvironment()->getLocalWorkSizeAutotuner();
+    const auto &kernelDescriptor = this->getImmutableData()->getDescriptor();
+    if (autotuner == nullptr ||
+        static_cast<ModuleImp *>(module)->getModuleType() == ModuleType::builtin ||
+        kernelDescriptor.kernelAttributes.requiredWorkgroupSize[0] != 0) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    Vec3<size_t> globalSize = {globalSizeX, globalSizeY, globalSizeZ};
+    Vec3<size_t> defaultGroupSize = {*groupSizeX, *groupSizeY, *groupSizeZ};
+    auto key = NEO::LocalWorkSizeAutotuner::createKey(*this->getImmutableData()->getKernelInfo(), neoDevice->getHardwareInfo(), globalSize);
+    bool measurementRequired = false;
+    auto groupSize = autotuner->selectLocalWorkSize(key, defaultGroupSize, module->getMaxGroupSize(kernelDescriptor), kernelDescriptor.kernelAttributes.simdSize, measurementRequired);
+
+    *groupSizeX = static_cast<uint32_t>(groupSize.x);
+    *groupSizeY = static_cast<uint32_t>(groupSize.y);
+    *groupSizeZ = static_cast<uint32_t>(groupSize.z);
+    return ZE_RESULT_SUCCESS;
+}
+
+std::optional<NEO::LocalWorkSizeAutotuneTrial> KernelImp::getLocalWorkSizeAutotuneTrial(const ze_group_count_t &groupCount) const {
+    // suggestGroupSize may be called from several threads, so any launch using a candidate still being tuned is measured
+    auto neoDevice = module->getDevice()->getNEODevice();
+    auto autotuner = neoDevice->getExecutionEnvironment()->getLocalWorkSizeAutotuner();
+    if (autotuner == nullptr ||
+        static_cast<ModuleImp *>(module)->getModuleType() == ModuleType::builtin ||
+        this->getImmutableData()->getDescriptor().kernelAttributes.requiredWorkgroupSize[0] != 0) {
+        return std::nullopt;
+    }
+
+    Vec3<size_t> groupSize = {this->groupSize[0], this->groupSize[1], this->groupSize[2]};
+    Vec3<size_t> globalSize = {groupCount.groupCountX * groupSize.x, groupCount.groupCountY * groupSize.y, groupCount.groupCountZ * groupSize.z};
+    auto key = NEO::LocalWorkSizeAutotuner::createKey(*this->getImmutableData()->getKernelInfo(), neoDevice->getHardwareInfo(), globalSize);
+    return autotuner->getPendingTrial(key, groupSize);
+}
+
+ze_result_t KernelImp::suggestDefaultGroupSize(uint32_t globalSizeX, uint32_t globalSizeY,
+                                               uint32_t globalSizeZ, uint32_t *groupSizeX,
+                                               uint32_t *groupSizeY, uint32_t *groupSizeZ) {
     size_t retGroupSize[3] = {};
     const auto &kernelDescriptor = this->getImmutableData()->getDescriptor();
     auto maxWorkGroupSize = module->getMaxGroupSize(kernelDescriptor);
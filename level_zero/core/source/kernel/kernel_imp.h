@@ -12,6 +12,7 @@
 #include "shared/source/kernel/dispatch_kernel_encoder_interface.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/unified_memory/unified_memory.h"
+#include "shared/source/utilities/local_work_size_autotuner.h"
 
 #include "level_zero/core/source/kernel/kernel.h"
 #include "level_zero/core/source/module/module.h"
@@ -19,6 +20,7 @@
 
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <vector>
 
 namespace L0 {
@@ -239,9 +241,14 @@ struct KernelImp : Kernel {
         return kernelArgInfos;
     }
 
+    std::optional<NEO::LocalWorkSizeAutotuneTrial> getLocalWorkSizeAutotuneTrial(const ze_group_count_t &groupCount) const;
+
   protected:
     KernelImp() = default;
 
+    ze_result_t suggestDefaultGroupSize(uint32_t globalSizeX, uint32_t globalSizeY, uint32_t globalSizeZ,
+                                        uint32_t *groupSizeX, uint32_t *groupSizeY, uint32_t *groupSizeZ);
+
     void patchWorkgroupSizeInCrossThreadData(uint32_t x, uint32_t y, uint32_t z);
 
     NEO::GraphicsAllocation *privateMemoryGraphicsAllocation = nullptr;
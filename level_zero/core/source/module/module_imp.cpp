@@ -414,16 +414,24 @@ ze_result_t ModuleTranslationUnit::processUnpackedBinary() {
     }
 
     auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
+    NEO::MemoryTransfers globalsInitTransfers;
     auto globalConstDataSize = programInfo.globalConstants.size + programInfo.globalConstants.zeroInitSize;
     if (globalConstDataSize != 0) {
         this->globalConstBuffer = NEO::allocateGlobalsSurface(svmAllocsManager, *device->getNEODevice(), globalConstDataSize,
-                                                              programInfo.globalConstants.zeroInitSize, true, programInfo.linkerInput.get(), programInfo.globalConstants.initData);
+                                                              programInfo.globalConstants.zeroInitSize, true, programInfo.linkerInput.get(), programInfo.globalConstants.initData,
+                                                              &globalsInitTransfers);
     }
 
     auto globalVariablesDataSize = programInfo.globalVariables.size + programInfo.globalVariables.zeroInitSize;
     if (globalVariablesDataSize != 0) {
         this->globalVarBuffer = NEO::allocateGlobalsSurface(svmAllocsManager, *device->getNEODevice(), globalVariablesDataSize,
-                                                            programInfo.globalVariables.zeroInitSize, false, programInfo.linkerInput.get(), programInfo.globalVariables.initData);
+                                                            programInfo.globalVariables.zeroInitSize, false, programInfo.linkerInput.get(), programInfo.globalVariables.initData,
+                                                            &globalsInitTransfers);
+    }
+
+    if (!globalsInitTransfers.empty()) {
+        auto success = NEO::MemoryTransferHelper::transferMemoryToAllocations(*device->getNEODevice(), globalsInitTransfers);
+        UNRECOVERABLE_IF(!success);
     }
 
     for (auto &kernelInfo : this->programInfo.kernelInfos) {
@@ -641,6 +649,8 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
             kernelImmData->setIsaCopiedToAllocation();
         }
     } else {
+        // ISA of all kernels is uploaded together, transfers using blitter share a single BCS flush
+        NEO::MemoryTransfers isaTransfers;
         for (auto &kernelImmData : kernelImmDatas) {
             if (nullptr == kernelImmData->getIsaGraphicsAllocation() || kernelImmData->isIsaCopiedToAllocation()) {
                 continue;
@@ -649,14 +659,13 @@ void ModuleImp::transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NE
             kernelImmData->getIsaGraphicsAllocation()->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
 
             auto [kernelHeapPtr, kernelHeapSize] = this->getKernelHeapPointerAndSize(kernelImmData, isaSegmentsForPatching);
-            NEO::MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation()),
-                                                                  *neoDevice,
-                                                                  kernelImmData->getIsaGraphicsAllocation(),
-                                                                  0u,
-                                                                  kernelHeapPtr,
-                                                                  kernelHeapSize);
+            isaTransfers.push_back({kernelImmData->getIsaGraphicsAllocation(), 0u, kernelHeapPtr, kernelHeapSize,
+                                    productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelImmData->getIsaGraphicsAllocation())});
             kernelImmData->setIsaCopiedToAllocation();
         }
+        if (!isaTransfers.empty()) {
+            NEO::MemoryTransferHelper::transferMemoryToAllocations(*neoDevice, isaTransfers);
+        }
     }
 }
 
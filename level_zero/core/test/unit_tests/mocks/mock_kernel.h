@@ -73,6 +73,7 @@ struct WhiteBox<::L0::KernelImp> : public ::L0::KernelImp {
     using ::L0::KernelImp::requiredWorkgroupOrder;
     using ::L0::KernelImp::setAssertBuffer;
     using ::L0::KernelImp::slmArgsTotalSize;
+    using ::L0::KernelImp::suggestDefaultGroupSize;
     using ::L0::KernelImp::suggestGroupSizeCache;
     using ::L0::KernelImp::surfaceStateHeapData;
     using ::L0::KernelImp::surfaceStateHeapDataSize;
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/cpu_overhead_benchmark.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "level_zero/core/test/unit_tests/fixtures/module_fixture.h"
+#include <level_zero/ze_api.h>
+
+#include <limits>
+
+namespace L0 {
+namespace ult {
+
+struct ApiPerfTests : public Test<ModuleFixture> {
+    template <typename FamilyType>
+    uint64_t getCsrOwnershipsCount() {
+        uint64_t ownershipsCount = 0;
+        for (auto &engine : neoDevice->getAllEngines()) {
+            ownershipsCount += static_cast<NEO::UltCommandStreamReceiver<FamilyType> *>(engine.commandStreamReceiver)->recursiveLockCounter.load();
+        }
+        return ownershipsCount;
+    }
+
+    const size_t allocationSize = MemoryConstants::pageSize;
+};
+
+HWTEST_F(ApiPerfTests, givenImmediateCommandListWhenAppendLaunchKernelIsCalledThenCpuOverheadIsReported) {
+    createKernel();
+
+    ze_command_queue_desc_t queueDesc = {ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    queueDesc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+    ze_command_list_handle_t commandList = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreateImmediate(context, device, &queueDesc, &commandList));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    auto result = NEO::CpuOverheadBenchmark::measure([&]() { return getCsrOwnershipsCount<FamilyType>(); }, [&]() {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendLaunchKernel(commandList, kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    });
+    NEO::CpuOverheadBenchmark::record(result);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListHostSynchronize(commandList, std::numeric_limits<uint64_t>::max()));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+}
+
+HWTEST_F(ApiPerfTests, givenRegularCommandListWhenAppendLaunchKernelIsCalledThenCpuOverheadIsReported) {
+    createKernel();
+
+    ze_command_list_desc_t commandListDesc = {ZE_STRUCTURE_TYPE_COMMAND_LIST_DESC};
+    ze_command_list_handle_t commandList = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zeCommandListCreate(context, device, &commandListDesc, &commandList));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    auto result = NEO::CpuOverheadBenchmark::measure([&]() { return getCsrOwnershipsCount<FamilyType>(); }, [&]() {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListAppendLaunchKernel(commandList, kernel->toHandle(), &groupCount, nullptr, 0, nullptr));
+    });
+    NEO::CpuOverheadBenchmark::record(result);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeCommandListDestroy(commandList));
+}
+
+HWTEST_F(ApiPerfTests, givenEventPoolWhenEventIsCreatedAndDestroyedThenCpuOverheadIsReported) {
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 1;
+    ze_event_pool_handle_t eventPool = nullptr;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, zeEventPoolCreate(context, &eventPoolDesc, 0, nullptr, &eventPool));
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    auto result = NEO::CpuOverheadBenchmark::measure([&]() { return getCsrOwnershipsCount<FamilyType>(); }, [&]() {
+        ze_event_handle_t event = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventCreate(eventPool, &eventDesc, &event));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventDestroy(event));
+    });
+    NEO::CpuOverheadBenchmark::record(result);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeEventPoolDestroy(eventPool));
+}
+
+HWTEST_F(ApiPerfTests, givenContextWhenHostMemoryIsAllocatedAndFreedThenCpuOverheadIsReported) {
+    ze_host_mem_alloc_desc_t hostDesc = {ZE_STRUCTURE_TYPE_HOST_MEM_ALLOC_DESC};
+
+    auto result = NEO::CpuOverheadBenchmark::measure([&]() { return getCsrOwnershipsCount<FamilyType>(); }, [&]() {
+        void *ptr = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocHost(context, &hostDesc, allocationSize, 0, &ptr));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, ptr));
+    });
+    NEO::CpuOverheadBenchmark::record(result);
+}
+
+HWTEST_F(ApiPerfTests, givenContextWhenDeviceMemoryIsAllocatedAndFreedThenCpuOverheadIsReported) {
+    ze_device_mem_alloc_desc_t deviceDesc = {ZE_STRUCTURE_TYPE_DEVICE_MEM_ALLOC_DESC};
+
+    auto result = NEO::CpuOverheadBenchmark::measure([&]() { return getCsrOwnershipsCount<FamilyType>(); }, [&]() {
+        void *ptr = nullptr;
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemAllocDevice(context, &deviceDesc, allocationSize, 0, device, &ptr));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, zeMemFree(context, ptr));
+    });
+    NEO::CpuOverheadBenchmark::record(result);
+}
+
+} // namespace ult
+} // namespace L0
@@ -1500,6 +1500,163 @@ HWTEST_F(CommandListAppendLaunchKernel, givenImmediateCommandListWhenAppendLaunc
     EXPECT_EQ(ZE_RESULT_SUCCESS, returnValue);
 }
 
+struct ImmediateCmdListDeferredFlushTest : public Test<ModuleFixture> {
+    void SetUp() override {
+        debugManager.flags.EnableImmediateCmdListDeferredFlush.set(1);
+        Test<ModuleFixture>::SetUp();
+        createKernel();
+
+        ze_command_queue_desc_t queueDesc = {};
+        queue = std::make_unique<Mock<CommandQueue>>(device, device->getNEODevice()->getDefaultEngine().commandStreamReceiver, &queueDesc);
+    }
+
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    void initializeCmdList(MockCommandListImmediateHw<gfxCoreFamily> &cmdList, bool statelessFlush) {
+        cmdList.isFlushTaskSubmissionEnabled = true;
+        cmdList.cmdListType = CommandList::CommandListType::typeImmediate;
+        cmdList.cmdQImmediate = queue.get();
+        cmdList.initialize(device, NEO::EngineGroupType::renderCompute, 0u);
+        cmdList.commandContainer.setImmediateCmdListCsr(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+        if (statelessFlush) {
+            cmdList.computeFlushMethod = &L0::CommandListCoreFamilyImmediate<gfxCoreFamily>::flushImmediateRegularTaskStateless;
+        }
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<Mock<CommandQueue>> queue;
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+};
+
+HWTEST_F(ImmediateCmdListDeferredFlushTest, givenDeferredFlushEnabledWhenIndependentKernelsAreAppendedThenTheyAreFlushedTogetherAtAppendCountLimit) {
+    debugManager.flags.ImmediateCmdListDeferredFlushMaxAppends.set(3);
+
+    MockCommandListImmediateHw<FamilyType::gfxCoreFamily> cmdList;
+    initializeCmdList(cmdList, true);
+
+    for (uint32_t i = 0; i < 2; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+    }
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(2u, cmdList.getDeferredAppendsCount());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+    EXPECT_EQ(1u, cmdList.getDeferredFlushCount(DeferredFlushReason::appendCountLimit));
+}
+
+HWTEST_F(ImmediateCmdListDeferredFlushTest, givenDeferredAppendsWhenAppendingBarrierThenPendingAppendsAreFlushedWithBarrier) {
+    MockCommandListImmediateHw<FamilyType::gfxCoreFamily> cmdList;
+    initializeCmdList(cmdList, true);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendBarrier(nullptr, 0, nullptr, false));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+    EXPECT_EQ(1u, cmdList.getDeferredFlushCount(DeferredFlushReason::dependency));
+}
+
+HWTEST_F(ImmediateCmdListDeferredFlushTest, givenDeferredAppendsWhenTimeLimitIsReachedThenNextAppendIsFlushed) {
+    debugManager.flags.ImmediateCmdListDeferredFlushTimeoutUs.set(0);
+
+    MockCommandListImmediateHw<FamilyType::gfxCoreFamily> cmdList;
+    initializeCmdList(cmdList, true);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, cmdList.getDeferredFlushCount(DeferredFlushReason::timeLimit));
+}
+
+HWTEST_F(ImmediateCmdListDeferredFlushTest, givenDeferredAppendsWhenHostSynchronizingEventThenPendingAppendsAreFlushed) {
+    MockCommandListImmediateHw<FamilyType::gfxCoreFamily> cmdList;
+    initializeCmdList(cmdList, true);
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    eventPoolDesc.count = 1;
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+    eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, event);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSignal(false));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->hostSynchronize(0));
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+    EXPECT_EQ(1u, cmdList.getDeferredFlushCount(DeferredFlushReason::hostSynchronize));
+}
+
+HWTEST_F(ImmediateCmdListDeferredFlushTest, givenDeferredAppendsWhenOtherCommandListIsHostSynchronizedThenPendingAppendsAreFlushed) {
+    MockCommandListImmediateHw<FamilyType::gfxCoreFamily> cmdList;
+    initializeCmdList(cmdList, true);
+    MockCommandListImmediateHw<FamilyType::gfxCoreFamily> otherCmdList;
+    initializeCmdList(otherCmdList, true);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+
+    otherCmdList.hostSynchronize(0);
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+    EXPECT_EQ(0u, otherCmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+}
+
+HWTEST_F(ImmediateCmdListDeferredFlushTest, givenAppendInProgressWhenHostWaitFlushesDeferredAppendsThenPendingAppendsAreNotSubmitted) {
+    MockCommandListImmediateHw<FamilyType::gfxCoreFamily> cmdList;
+    initializeCmdList(cmdList, true);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+    EXPECT_FALSE(cmdList.appendInProgress);
+
+    cmdList.appendInProgress = true;
+    static_cast<DriverHandleImp *>(device->getDriverHandle())->flushDeferredCmdListAppends();
+    EXPECT_EQ(0u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(1u, cmdList.getDeferredAppendsCount());
+
+    cmdList.appendInProgress = false;
+    static_cast<DriverHandleImp *>(device->getDriverHandle())->flushDeferredCmdListAppends();
+    EXPECT_EQ(1u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+}
+
+HWTEST_F(ImmediateCmdListDeferredFlushTest, givenCommandListWithDeferredAppendsWhenDestroyedThenItIsRemovedFromDriverHandle) {
+    auto driverHandleImp = static_cast<DriverHandleImp *>(device->getDriverHandle());
+    {
+        MockCommandListImmediateHw<FamilyType::gfxCoreFamily> cmdList;
+        initializeCmdList(cmdList, true);
+
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+        ASSERT_EQ(1u, driverHandleImp->cmdListsWithDeferredAppends.size());
+        EXPECT_EQ(&cmdList, driverHandleImp->cmdListsWithDeferredAppends[0]);
+    }
+    EXPECT_TRUE(driverHandleImp->cmdListsWithDeferredAppends.empty());
+}
+
+HWTEST_F(ImmediateCmdListDeferredFlushTest, givenFlushWithStreamStatesWhenAppendingKernelsThenFlushIsNotDeferred) {
+    MockCommandListImmediateHw<FamilyType::gfxCoreFamily> cmdList;
+    initializeCmdList(cmdList, false);
+
+    for (uint32_t i = 0; i < 2; i++) {
+        EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+    }
+    EXPECT_EQ(2u, cmdList.executeCommandListImmediateWithFlushTaskCalledCount);
+    EXPECT_EQ(0u, cmdList.getDeferredAppendsCount());
+}
+
 HWTEST_F(CommandListAppendLaunchKernel, GivenImmCmdListAndKernelWithImageWriteArgAndPlatformRequiresFlushWhenLaunchingKernelThenPipeControlWithTextureCacheInvalidationIsAdded) {
     if (!device->getProductHelper().isPostImageWriteFlushRequired()) {
         GTEST_SKIP();
@@ -18,10 +18,12 @@
 #include "shared/source/helpers/state_base_address_helper.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/kernel_timing_trace.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_command_encoder.h"
+#include "shared/test/common/mocks/mock_completion_reactor.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/test_macros/hw_test.h"
 
@@ -3050,5 +3052,142 @@ HWTEST2_F(CommandListAppendLaunchKernel,
     EXPECT_EQ(kernelAllocationIt, cmdlistResidency.end());
 }
 
+struct KernelTimingTraceCmdListFixture : public ModuleMutableCommandListFixture {
+    void setUp() {
+        debugManager.flags.EnableKernelTimingTrace.set(1);
+        ModuleMutableCommandListFixture::setUp();
+
+        reactor = new MockCompletionReactor;
+        reactor->drainTimeout = std::chrono::milliseconds(0);
+        neoDevice->getExecutionEnvironment()->completionReactor.reset(reactor);
+    }
+
+    template <typename FamilyType>
+    uint64_t getWalkerPostSyncAddress(LinearStream &cmdStream, size_t offset) {
+        GenCmdList cmdList;
+        EXPECT_TRUE(FamilyType::Parse::parseCommandBuffer(cmdList, ptrOffset(cmdStream.getCpuBase(), offset), cmdStream.getUsed() - offset));
+
+        auto itorWalkers = NEO::UnitTestHelper<FamilyType>::findAllWalkerTypeCmds(cmdList.begin(), cmdList.end());
+        EXPECT_EQ(1u, itorWalkers.size());
+        if (itorWalkers.empty()) {
+            return 0;
+        }
+
+        uint64_t postSyncAddress = 0;
+        WalkerVariant walkerVariant = NEO::UnitTestHelper<FamilyType>::getWalkerVariant(*itorWalkers[0]);
+        std::visit([&postSyncAddress](auto &&walker) {
+            postSyncAddress = walker->getPostSync().getDestinationAddress();
+        },
+                   walkerVariant);
+        return postSyncAddress;
+    }
+
+    MockCompletionReactor *reactor = nullptr;
+};
+
+using KernelTimingTraceCmdListTest = Test<KernelTimingTraceCmdListFixture>;
+
+HWTEST2_F(KernelTimingTraceCmdListTest, givenKernelTimingTraceEnabledWhenImmediateCmdListIsCreatedThenTraceIsAssignedOnlyToNonInternalImmediateCmdLists, IsAtLeastXeHpCore) {
+    using ImmediateCmdList = WhiteBox<L0::CommandListCoreFamilyImmediate<FamilyType::gfxCoreFamily>>;
+
+    auto trace = neoDevice->getExecutionEnvironment()->getKernelTimingTrace();
+    ASSERT_NE(nullptr, trace);
+    EXPECT_EQ(trace, static_cast<ImmediateCmdList *>(static_cast<L0::CommandList *>(commandListImmediate.get()))->kernelTimingTrace);
+    EXPECT_EQ(nullptr, static_cast<CommandListCoreFamily<FamilyType::gfxCoreFamily> *>(static_cast<L0::CommandList *>(commandList.get()))->kernelTimingTrace);
+
+    ze_result_t returnValue;
+    ze_command_queue_desc_t queueDesc{ZE_STRUCTURE_TYPE_COMMAND_QUEUE_DESC};
+    std::unique_ptr<L0::CommandList> internalCmdList(CommandList::createImmediate(productFamily, device, &queueDesc, true, engineGroupType, returnValue));
+    ASSERT_NE(nullptr, internalCmdList);
+    EXPECT_EQ(nullptr, static_cast<ImmediateCmdList *>(internalCmdList.get())->kernelTimingTrace);
+}
+
+HWTEST2_F(KernelTimingTraceCmdListTest, givenKernelWithoutEventWhenAppendedToImmediateCmdListThenWalkerPostSyncIsBorrowedAndRecordIsSubmittedToReactorOnFlush, IsAtLeastXeHpCore) {
+    using ImmediateCmdList = WhiteBox<L0::CommandListCoreFamilyImmediate<FamilyType::gfxCoreFamily>>;
+    auto cmdList = static_cast<ImmediateCmdList *>(static_cast<L0::CommandList *>(commandListImmediate.get()));
+    auto csr = static_cast<UltCommandStreamReceiver<FamilyType> *>(cmdList->getCsr(false));
+
+    auto &cmdStream = *cmdList->commandContainer.getCommandStream();
+    auto offset = cmdStream.getUsed();
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+
+    EXPECT_NE(0u, getWalkerPostSyncAddress<FamilyType>(cmdStream, offset));
+    EXPECT_TRUE(cmdList->kernelTimingRecords.empty());
+
+    ASSERT_EQ(1u, reactor->registerList.size());
+    EXPECT_EQ(csr, reactor->registerList[0].csr);
+    EXPECT_EQ(csr->peekTaskCount(), reactor->registerList[0].waitValue);
+
+    reactor->transferRegisterList();
+    *csr->getTagAddress() = csr->peekTaskCount();
+    reactor->processWatches();
+    EXPECT_TRUE(reactor->watches.empty());
+}
+
+HWTEST2_F(KernelTimingTraceCmdListTest, givenKernelWithSignalEventWhenAppendedToImmediateCmdListThenEventPostSyncIsKeptAndNothingIsTraced, IsAtLeastXeHpCore) {
+    using ImmediateCmdList = WhiteBox<L0::CommandListCoreFamilyImmediate<FamilyType::gfxCoreFamily>>;
+    auto cmdList = static_cast<ImmediateCmdList *>(static_cast<L0::CommandList *>(commandListImmediate.get()));
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    eventPoolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+    eventPoolDesc.count = 1;
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+    auto event = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    ASSERT_NE(nullptr, event);
+
+    auto &cmdStream = *cmdList->commandContainer.getCommandStream();
+    auto offset = cmdStream.getUsed();
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel->toHandle(), groupCount, event->toHandle(), 0, nullptr, launchParams));
+
+    EXPECT_EQ(event->getGpuAddress(device), getWalkerPostSyncAddress<FamilyType>(cmdStream, offset));
+    EXPECT_TRUE(cmdList->kernelTimingRecords.empty());
+    EXPECT_TRUE(reactor->registerList.empty());
+}
+
+HWTEST2_F(KernelTimingTraceCmdListTest, givenInOrderImmediateCmdListWhenKernelIsAppendedThenWalkerPostSyncIsBorrowedAndCounterIsSignaledByBarrier, IsAtLeastXeHpCore) {
+    using ImmediateCmdList = WhiteBox<L0::CommandListCoreFamilyImmediate<FamilyType::gfxCoreFamily>>;
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    auto cmdList = static_cast<ImmediateCmdList *>(static_cast<L0::CommandList *>(commandListImmediate.get()));
+    cmdList->enableInOrderExecution();
+
+    auto &cmdStream = *cmdList->commandContainer.getCommandStream();
+    auto offset = cmdStream.getUsed();
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, cmdList->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams));
+
+    uint64_t counterAddress = cmdList->inOrderExecInfo->getBaseDeviceAddress() + cmdList->inOrderExecInfo->getAllocationOffset();
+    auto walkerPostSyncAddress = getWalkerPostSyncAddress<FamilyType>(cmdStream, offset);
+    EXPECT_NE(0u, walkerPostSyncAddress);
+    EXPECT_NE(counterAddress, walkerPostSyncAddress);
+
+    GenCmdList commands;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(commands, ptrOffset(cmdStream.getCpuBase(), offset), cmdStream.getUsed() - offset));
+    auto walkers = NEO::UnitTestHelper<FamilyType>::findAllWalkerTypeCmds(commands.begin(), commands.end());
+    ASSERT_EQ(1u, walkers.size());
+    bool counterSignaledAfterWalker = false;
+    for (auto &pipeControlIt : findAll<PIPE_CONTROL *>(walkers[0], commands.end())) {
+        auto pipeControl = genCmdCast<PIPE_CONTROL *>(*pipeControlIt);
+        if (NEO::UnitTestHelper<FamilyType>::getPipeControlPostSyncAddress(*pipeControl) == counterAddress) {
+            EXPECT_EQ(cmdList->inOrderExecInfo->getCounterValue(), pipeControl->getImmediateData());
+            counterSignaledAfterWalker = true;
+        }
+    }
+    EXPECT_TRUE(counterSignaledAfterWalker);
+
+    EXPECT_TRUE(cmdList->kernelTimingRecords.empty());
+    EXPECT_EQ(1u, reactor->registerList.size());
+}
+
 } // namespace ult
 } // namespace L0
@@ -4788,6 +4788,111 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, InOrderCmdListTests, givenInOrderModeWhenProgrammin
     EXPECT_EQ(3u, events[2]->inOrderExecSignalValue);
 }
 
+HWCMDTEST_F(IGFX_XE_HP_CORE, InOrderCmdListTests, givenCbEventsFromSameCmdListInWaitListWhenAppendingWaitThenOnlyLatestCounterValueIsWaited) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    auto immCmdList1 = createImmCmdList<FamilyType::gfxCoreFamily>();
+    auto immCmdList2 = createImmCmdList<FamilyType::gfxCoreFamily>();
+
+    auto cmdStream = immCmdList2->getCmdContainer().getCommandStream();
+
+    auto eventPool = createEvents<FamilyType>(2, false);
+
+    immCmdList1->appendLaunchKernel(kernel->toHandle(), groupCount, events[0]->toHandle(), 0, nullptr, launchParams);
+    immCmdList1->appendLaunchKernel(kernel->toHandle(), groupCount, events[1]->toHandle(), 0, nullptr, launchParams);
+
+    ze_event_handle_t waitlist[] = {events[1]->toHandle(), events[0]->toHandle()};
+
+    for (int32_t compactionEnabled : {0, 1}) {
+        debugManager.flags.EnableWaitListCompaction.set(compactionEnabled);
+
+        auto offset = cmdStream->getUsed();
+
+        immCmdList2->appendWaitOnEvents(2, waitlist, nullptr, false, false, false, false, false, false);
+
+        GenCmdList cmdList;
+        ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(cmdList,
+                                                          ptrOffset(cmdStream->getCpuBase(), offset),
+                                                          (cmdStream->getUsed() - offset)));
+
+        auto semaphores = findAll<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end());
+        ASSERT_EQ(compactionEnabled ? 1u : 2u, semaphores.size());
+
+        auto semaphoreCmd = genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphores[0]);
+        EXPECT_EQ(immCmdList1->inOrderExecInfo->getBaseDeviceAddress(), semaphoreCmd->getSemaphoreGraphicsAddress());
+        if (!immCmdList1->isQwordInOrderCounter()) {
+            EXPECT_EQ(2u, semaphoreCmd->getSemaphoreDataDword());
+        }
+    }
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, InOrderCmdListTests, givenSatisfiedCountersOnEngineWhenWaitingForAlreadySubmittedCounterValueFromOtherCmdListThenSemaphoreIsSkipped) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    ultCsr->inOrderSatisfiedCounters = std::make_unique<InOrderSatisfiedCounters>();
+
+    auto immCmdList1 = createImmCmdList<FamilyType::gfxCoreFamily>();
+    auto immCmdList2 = createImmCmdList<FamilyType::gfxCoreFamily>();
+    auto immCmdList3 = createImmCmdList<FamilyType::gfxCoreFamily>();
+
+    auto eventPool = createEvents<FamilyType>(3, false);
+
+    immCmdList1->appendLaunchKernel(kernel->toHandle(), groupCount, events[0]->toHandle(), 0, nullptr, launchParams);
+    immCmdList1->appendLaunchKernel(kernel->toHandle(), groupCount, events[1]->toHandle(), 0, nullptr, launchParams);
+
+    auto counterAddress = immCmdList1->inOrderExecInfo->getBaseDeviceAddress();
+
+    auto countCounterWaits = [&](WhiteBox<L0::CommandListCoreFamilyImmediate<FamilyType::gfxCoreFamily>> &immCmdList, Event *waitEvent) {
+        auto cmdStream = immCmdList.getCmdContainer().getCommandStream();
+        auto offset = cmdStream->getUsed();
+        auto eventHandle = waitEvent->toHandle();
+
+        immCmdList.appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 1, &eventHandle, launchParams);
+
+        GenCmdList cmdList;
+        EXPECT_TRUE(FamilyType::Parse::parseCommandBuffer(cmdList, ptrOffset(cmdStream->getCpuBase(), offset), (cmdStream->getUsed() - offset)));
+
+        uint32_t counterWaits = 0;
+        for (auto &semaphore : findAll<MI_SEMAPHORE_WAIT *>(cmdList.begin(), cmdList.end())) {
+            if (genCmdCast<MI_SEMAPHORE_WAIT *>(*semaphore)->getSemaphoreGraphicsAddress() == counterAddress) {
+                counterWaits++;
+            }
+        }
+        return counterWaits;
+    };
+
+    EXPECT_EQ(1u, countCounterWaits(*immCmdList2, events[1].get()));
+    EXPECT_EQ(0u, ultCsr->getInOrderSatisfiedCounters()->getElidedWaitsCount());
+
+    EXPECT_EQ(0u, countCounterWaits(*immCmdList3, events[0].get()));
+    EXPECT_EQ(0u, countCounterWaits(*immCmdList3, events[1].get()));
+    EXPECT_EQ(2u, ultCsr->getInOrderSatisfiedCounters()->getElidedWaitsCount());
+
+    immCmdList1->appendLaunchKernel(kernel->toHandle(), groupCount, events[2]->toHandle(), 0, nullptr, launchParams);
+
+    EXPECT_EQ(1u, countCounterWaits(*immCmdList3, events[2].get()));
+    EXPECT_EQ(2u, ultCsr->getInOrderSatisfiedCounters()->getElidedWaitsCount());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, InOrderCmdListTests, givenSatisfiedCountersOnEngineWhenFlushFailsThenWaitIsNotMarkedAsSatisfied) {
+    auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(device->getNEODevice()->getDefaultEngine().commandStreamReceiver);
+    ultCsr->inOrderSatisfiedCounters = std::make_unique<InOrderSatisfiedCounters>();
+
+    auto immCmdList1 = createImmCmdList<FamilyType::gfxCoreFamily>();
+    auto immCmdList2 = createImmCmdList<FamilyType::gfxCoreFamily>();
+
+    immCmdList1->appendLaunchKernel(kernel->toHandle(), groupCount, nullptr, 0, nullptr, launchParams);
+
+    immCmdList2->appendWaitOnInOrderDependency(immCmdList1->inOrderExecInfo, nullptr, 1, 0, false, false, false, false, false);
+    ASSERT_EQ(1u, immCmdList2->pendingInOrderWaits.size());
+    EXPECT_EQ(ultCsr, immCmdList2->pendingInOrderWaits[0].csr);
+
+    immCmdList2->flushImmediate(ZE_RESULT_ERROR_DEVICE_LOST, false, false, false, NEO::AppendOperations::nonKernel, false, nullptr, false, nullptr, nullptr);
+    EXPECT_TRUE(immCmdList2->pendingInOrderWaits.empty());
+    EXPECT_FALSE(ultCsr->getInOrderSatisfiedCounters()->isSatisfied(immCmdList1->inOrderExecInfo->getTimelineId(), 0, 1));
+}
+
 HWCMDTEST_F(IGFX_XE_HP_CORE, InOrderCmdListTests, givenInOrderModeWhenProgrammingAppendBarrierWithoutWaitlistAndTimestampEventThenSignalSyncAllocation) {
     using MI_STORE_DATA_IMM = typename FamilyType::MI_STORE_DATA_IMM;
 
@@ -1219,6 +1219,10 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
     decltype(&zexCounterBasedEventGetIpcHandle) expectedCounterBasedEventGetIpcHandle = L0::zexCounterBasedEventGetIpcHandle;
     decltype(&zexCounterBasedEventOpenIpcHandle) expectedCounterBasedEventOpenIpcHandle = L0::zexCounterBasedEventOpenIpcHandle;
     decltype(&zexCounterBasedEventCloseIpcHandle) expectedCounterBasedEventCloseIpcHandle = L0::zexCounterBasedEventCloseIpcHandle;
+    decltype(&zexEventHostSynchronizeMultiple) expectedEventHostSynchronizeMultiple = L0::zexEventHostSynchronizeMultiple;
+    decltype(&zexEventSetCompletionCallback) expectedEventSetCompletionCallback = L0::zexEventSetCompletionCallback;
+    decltype(&zexEventGetCompletionNotificationFd) expectedEventGetCompletionNotificationFd = L0::zexEventGetCompletionNotificationFd;
+    decltype(&zexCommandQueueGetCompletionNotificationFd) expectedCommandQueueGetCompletionNotificationFd = L0::zexCommandQueueGetCompletionNotificationFd;
 
     void *funPtr = nullptr;
 
@@ -1278,6 +1282,18 @@ TEST_F(DriverExperimentalApiTest, whenRetrievingApiFunctionThenExpectProperPoint
 
     EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexCounterBasedEventCloseIpcHandle", &funPtr));
     EXPECT_EQ(expectedCounterBasedEventCloseIpcHandle, reinterpret_cast<decltype(&zexCounterBasedEventCloseIpcHandle)>(funPtr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexEventHostSynchronizeMultiple", &funPtr));
+    EXPECT_EQ(expectedEventHostSynchronizeMultiple, reinterpret_cast<decltype(&zexEventHostSynchronizeMultiple)>(funPtr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexEventSetCompletionCallback", &funPtr));
+    EXPECT_EQ(expectedEventSetCompletionCallback, reinterpret_cast<decltype(&zexEventSetCompletionCallback)>(funPtr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexEventGetCompletionNotificationFd", &funPtr));
+    EXPECT_EQ(expectedEventGetCompletionNotificationFd, reinterpret_cast<decltype(&zexEventGetCompletionNotificationFd)>(funPtr));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zeDriverGetExtensionFunctionAddress(driverHandle, "zexCommandQueueGetCompletionNotificationFd", &funPtr));
+    EXPECT_EQ(expectedCommandQueueGetCompletionNotificationFd, reinterpret_cast<decltype(&zexCommandQueueGetCompletionNotificationFd)>(funPtr));
 }
 
 TEST_F(DriverExperimentalApiTest, givenHostPointerApiExistWhenImportingPtrThenExpectProperBehavior) {
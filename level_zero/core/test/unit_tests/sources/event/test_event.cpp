@@ -13,6 +13,7 @@
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/engine_descriptor_helper.h"
 #include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/mocks/mock_completion_reactor.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/mocks/mock_device.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
@@ -1676,6 +1677,57 @@ struct MockL0GfxCoreHelperAlwaysAllocateEventInLocalMemHw : L0::L0GfxCoreHelperH
     bool alwaysAllocateEventInLocalMem() const override { return true; }
 };
 
+TEST_F(EventCreate, GivenEnabledTimestampPoolAllocatorWhenCreatingHostVisibleEventPoolsThenPoolsAreSubAllocatedFromSharedHostAllocation) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableTimestampPoolAllocator.set(1);
+
+    auto &l0GfxCoreHelper = device->getNEODevice()->getRootDeviceEnvironment().getHelper<L0GfxCoreHelper>();
+    if (l0GfxCoreHelper.alwaysAllocateEventInLocalMem()) {
+        GTEST_SKIP();
+    }
+
+    auto &hostTimestampPoolAllocator = device->getNEODevice()->getHostTimestampPoolAllocator();
+    ze_device_handle_t devices[] = {device->toHandle()};
+    ze_event_pool_desc_t eventPoolDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_POOL_DESC,
+        nullptr,
+        ZE_EVENT_POOL_FLAG_HOST_VISIBLE,
+        1};
+    ze_event_desc_t eventDesc = {
+        ZE_STRUCTURE_TYPE_EVENT_DESC,
+        nullptr,
+        0,
+        ZE_EVENT_SCOPE_FLAG_HOST,
+        ZE_EVENT_SCOPE_FLAG_HOST};
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::EventPool> eventPool0(EventPool::create(driverHandle.get(), context, 1, devices, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    std::unique_ptr<L0::EventPool> eventPool1(EventPool::create(driverHandle.get(), context, 1, devices, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, eventPool0);
+    ASSERT_NE(nullptr, eventPool1);
+
+    auto sharedAllocation = eventPool0->getAllocation().getDefaultGraphicsAllocation();
+    EXPECT_TRUE(hostTimestampPoolAllocator.isPoolBuffer(sharedAllocation));
+    EXPECT_EQ(sharedAllocation, eventPool1->getAllocation().getDefaultGraphicsAllocation());
+    EXPECT_EQ(NEO::AllocationType::timestampPacketTagBuffer, sharedAllocation->getAllocationType());
+    EXPECT_NE(eventPool0->getSharedTimestampAllocation()->getOffset(), eventPool1->getSharedTimestampAllocation()->getOffset());
+
+    std::unique_ptr<Event> event0(static_cast<Event *>(l0GfxCoreHelper.createEvent(eventPool0.get(), &eventDesc, device)));
+    std::unique_ptr<Event> event1(static_cast<Event *>(l0GfxCoreHelper.createEvent(eventPool1.get(), &eventDesc, device)));
+    EXPECT_NE(event0->getGpuAddress(device), event1->getGpuAddress(device));
+    EXPECT_NE(event0->getHostAddress(), event1->getHostAddress());
+    EXPECT_EQ(ptrOffset(sharedAllocation->getUnderlyingBuffer(), eventPool1->getSharedTimestampAllocation()->getOffset()), event1->getHostAddress());
+
+    eventPoolDesc.flags |= ZE_EVENT_POOL_FLAG_IPC;
+    std::unique_ptr<L0::EventPool> ipcEventPool(EventPool::create(driverHandle.get(), context, 1, devices, &eventPoolDesc, result));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    ASSERT_NE(nullptr, ipcEventPool);
+    EXPECT_EQ(nullptr, ipcEventPool->getSharedTimestampAllocation());
+    EXPECT_FALSE(hostTimestampPoolAllocator.isPoolBuffer(ipcEventPool->getAllocation().getDefaultGraphicsAllocation()));
+}
+
 HWTEST_F(EventCreate, GivenEnabledTimestampPoolAllocatorAndForcedEventAllocateInLocalMemoryWhenCreatingMultipleEventPoolsForSingleDeviceThenEventsUseSharedAllocationAndHaveUniqueAddresses) {
     DebugManagerStateRestore restorer;
     NEO::debugManager.flags.EnableTimestampPoolAllocator.set(1);
@@ -1976,6 +2028,289 @@ TEST_F(EventSynchronizeTest, givenCallToEventHostSynchronizeWithTimeoutZeroWhenO
     EXPECT_EQ(ZE_RESULT_SUCCESS, result);
 }
 
+TEST_F(EventSynchronizeTest, givenMultipleEventsWhenWaitingForAnyOfThemThenIndexOfSignaledEventIsReturned) {
+    std::unique_ptr<Event> events[3];
+    Event *eventPtrs[3];
+    for (uint32_t i = 0; i < 3; i++) {
+        eventDesc.index = i + 1;
+        events[i] = std::unique_ptr<Event>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device));
+        ASSERT_NE(nullptr, events[i]);
+        events[i]->setUsingContextEndOffset(false);
+        eventPtrs[i] = events[i].get();
+    }
+
+    uint32_t signaledEventIndex = std::numeric_limits<uint32_t>::max();
+    EXPECT_EQ(ZE_RESULT_NOT_READY, Event::hostSynchronizeMultiple(3, eventPtrs, 0, false, &signaledEventIndex));
+    EXPECT_EQ(std::numeric_limits<uint32_t>::max(), signaledEventIndex);
+
+    *static_cast<uint32_t *>(events[2]->getHostAddress()) = Event::STATE_SIGNALED;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(3, eventPtrs, 0, false, &signaledEventIndex));
+    EXPECT_EQ(2u, signaledEventIndex);
+    EXPECT_TRUE(events[2]->isAlreadyCompleted());
+    EXPECT_FALSE(events[0]->isAlreadyCompleted());
+    EXPECT_FALSE(events[1]->isAlreadyCompleted());
+}
+
+TEST_F(EventSynchronizeTest, givenMultipleEventsWhenWaitingForAllOfThemThenSuccessIsReturnedOnlyAfterAllEventsAreSignaled) {
+    std::unique_ptr<Event> events[3];
+    Event *eventPtrs[3];
+    for (uint32_t i = 0; i < 3; i++) {
+        eventDesc.index = i + 1;
+        events[i] = std::unique_ptr<Event>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device));
+        ASSERT_NE(nullptr, events[i]);
+        events[i]->setUsingContextEndOffset(false);
+        eventPtrs[i] = events[i].get();
+    }
+
+    *static_cast<uint32_t *>(events[0]->getHostAddress()) = Event::STATE_SIGNALED;
+    *static_cast<uint32_t *>(events[2]->getHostAddress()) = Event::STATE_SIGNALED;
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, Event::hostSynchronizeMultiple(3, eventPtrs, 10, true, nullptr));
+    EXPECT_TRUE(events[0]->isAlreadyCompleted());
+    EXPECT_FALSE(events[1]->isAlreadyCompleted());
+    EXPECT_TRUE(events[2]->isAlreadyCompleted());
+
+    *static_cast<uint32_t *>(events[1]->getHostAddress()) = Event::STATE_SIGNALED;
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(3, eventPtrs, 0, true, nullptr));
+    for (auto &event : events) {
+        EXPECT_TRUE(event->isAlreadyCompleted());
+    }
+}
+
+TEST_F(EventSynchronizeTest, givenGpuHangWhenWaitingForMultipleEventsThenDeviceLostIsReturned) {
+    const auto csr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    csr->isGpuHangDetectedReturnValue = true;
+
+    eventDesc.index = 1;
+    auto event2 = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device)));
+    ASSERT_NE(nullptr, event2);
+
+    event->csrs[0] = csr.get();
+    event->gpuHangCheckPeriod = 0ms;
+    Event *eventPtrs[] = {event.get(), event2.get()};
+
+    constexpr uint64_t timeout = std::numeric_limits<std::uint64_t>::max();
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, Event::hostSynchronizeMultiple(2, eventPtrs, timeout, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_DEVICE_LOST, Event::hostSynchronizeMultiple(2, eventPtrs, timeout, false, nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenCounterBasedEventsSharingInOrderCounterWhenWaitingForMultipleEventsThenCounterIsPolledOnceWithLatestOrEarliestSignalValue) {
+    MockTagAllocator<DeviceAllocNodeType<true>> deviceTagAllocator(0, neoDevice->getMemoryManager());
+    auto inOrderExecInfo = std::make_shared<NEO::InOrderExecInfo>(deviceTagAllocator.getTag(), nullptr, *neoDevice, 1, false, false);
+    auto counter = inOrderExecInfo->getBaseHostAddress();
+    *counter = 0;
+
+    std::unique_ptr<Event> events[2];
+    Event *eventPtrs[2];
+    for (uint32_t i = 0; i < 2; i++) {
+        eventDesc.index = i + 1;
+        events[i] = std::unique_ptr<Event>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device));
+        ASSERT_NE(nullptr, events[i]);
+        events[i]->enableCounterBasedMode(true, ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_IMMEDIATE);
+        events[i]->updateInOrderExecState(inOrderExecInfo, 2 - i, 0);
+        eventPtrs[i] = events[i].get();
+    }
+
+    // only the latest signal value is polled when waiting for all, event signaled earlier is not checked on its own
+    *counter = 1;
+    EXPECT_EQ(ZE_RESULT_NOT_READY, Event::hostSynchronizeMultiple(2, eventPtrs, 0, true, nullptr));
+    EXPECT_FALSE(events[0]->isAlreadyCompleted());
+    EXPECT_FALSE(events[1]->isAlreadyCompleted());
+
+    // the earliest signal value is polled when waiting for any, even if its event is not first on the list
+    *counter = 2;
+    uint32_t signaledEventIndex = std::numeric_limits<uint32_t>::max();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(2, eventPtrs, 0, false, &signaledEventIndex));
+    EXPECT_EQ(1u, signaledEventIndex);
+    EXPECT_FALSE(events[0]->isAlreadyCompleted());
+    EXPECT_TRUE(events[1]->isAlreadyCompleted());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(2, eventPtrs, 0, true, nullptr));
+    EXPECT_TRUE(events[0]->isAlreadyCompleted());
+    EXPECT_TRUE(events[1]->isAlreadyCompleted());
+}
+
+HWTEST_F(EventSynchronizeTest, givenKmdWaitCounterBasedEventsOnSingleCsrWhenWaitingForAllOfThemThenUserFenceIsWaitedForLatestSignalValueOfSharedCounter) {
+    auto ultCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(event->csrs[0]);
+    ultCsr->isUserFenceWaitSupported = true;
+    ultCsr->waitUserFenceParams.forceRetStatusEnabled = true;
+    ultCsr->waitUserFenceParams.forceRetStatusValue = false;
+
+    MockTagAllocator<DeviceAllocNodeType<true>> deviceTagAllocator(0, neoDevice->getMemoryManager());
+    auto inOrderExecInfo = std::make_shared<NEO::InOrderExecInfo>(deviceTagAllocator.getTag(), nullptr, *neoDevice, 1, false, false);
+    *inOrderExecInfo->getBaseHostAddress() = 0;
+
+    std::unique_ptr<Event> events[2];
+    Event *eventPtrs[2];
+    for (uint32_t i = 0; i < 2; i++) {
+        eventDesc.index = i + 1;
+        events[i] = std::unique_ptr<Event>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device));
+        ASSERT_NE(nullptr, events[i]);
+        ASSERT_EQ(ultCsr, events[i]->csrs[0]);
+        events[i]->enableCounterBasedMode(true, ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_IMMEDIATE);
+        events[i]->enableKmdWaitMode();
+        events[i]->updateInOrderExecState(inOrderExecInfo, i + 1, 0);
+        eventPtrs[i] = events[i].get();
+    }
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, Event::hostSynchronizeMultiple(2, eventPtrs, 0, true, nullptr));
+    EXPECT_EQ(1u, ultCsr->waitUserFenceParams.callCount);
+    EXPECT_EQ(2u, ultCsr->waitUserFenceParams.latestWaitedValue);
+    EXPECT_EQ(castToUint64(inOrderExecInfo->getBaseHostAddress()), ultCsr->waitUserFenceParams.latestWaitedAddress);
+    EXPECT_FALSE(events[0]->isAlreadyCompleted());
+    EXPECT_FALSE(events[1]->isAlreadyCompleted());
+
+    ultCsr->waitUserFenceParams.forceRetStatusValue = true;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(2, eventPtrs, 0, true, nullptr));
+    EXPECT_TRUE(events[0]->isAlreadyCompleted());
+    EXPECT_TRUE(events[1]->isAlreadyCompleted());
+}
+
+TEST_F(EventSynchronizeTest, givenAubCsrUsedByAnyEventWhenWaitingForMultipleEventsThenEventsAreSynchronizedOneByOne) {
+    auto aubCsr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    aubCsr->commandStreamReceiverType = CommandStreamReceiverType::aub;
+
+    eventDesc.index = 1;
+    auto aubEvent = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device)));
+    ASSERT_NE(nullptr, aubEvent);
+    aubEvent->csrs[0] = aubCsr.get();
+
+    event->setUsingContextEndOffset(false);
+    *static_cast<uint32_t *>(event->getHostAddress()) = Event::STATE_SIGNALED;
+    Event *eventPtrs[] = {event.get(), aubEvent.get()};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(2, eventPtrs, 0, true, nullptr));
+}
+
+TEST_F(EventSynchronizeTest, givenAubCsrUsedByLaterEventWhenWaitingForAnyEventThenAubEventIsSynchronizedAndItsIndexIsReturned) {
+    auto aubCsr = std::make_unique<MockCommandStreamReceiver>(*neoDevice->getExecutionEnvironment(), 0, neoDevice->getDeviceBitfield());
+    aubCsr->commandStreamReceiverType = CommandStreamReceiverType::aub;
+
+    eventDesc.index = 1;
+    auto aubEvent = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device)));
+    ASSERT_NE(nullptr, aubEvent);
+    aubEvent->csrs[0] = aubCsr.get();
+
+    event->setUsingContextEndOffset(false);
+    Event *eventPtrs[] = {event.get(), aubEvent.get()};
+
+    uint32_t signaledEventIndex = std::numeric_limits<uint32_t>::max();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(2, eventPtrs, std::numeric_limits<uint64_t>::max(), false, &signaledEventIndex));
+    EXPECT_EQ(1u, signaledEventIndex);
+    EXPECT_FALSE(event->isAlreadyCompleted());
+}
+
+TEST_F(EventSynchronizeTest, givenCounterBasedEventsWithSeparateExecInfosSharingCounterMemoryWhenWaitingForAllThenCounterIsPolledOnce) {
+    uint64_t counter = 1;
+    auto inOrderExecInfo1 = NEO::InOrderExecInfo::createFromExternalAllocation(*neoDevice, nullptr, 0x1, nullptr, &counter, 1, 1, 1);
+    auto inOrderExecInfo2 = NEO::InOrderExecInfo::createFromExternalAllocation(*neoDevice, nullptr, 0x1, nullptr, &counter, 1, 1, 1);
+
+    std::unique_ptr<Event> events[2];
+    Event *eventPtrs[2];
+    for (uint32_t i = 0; i < 2; i++) {
+        eventDesc.index = i + 1;
+        events[i] = std::unique_ptr<Event>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device));
+        ASSERT_NE(nullptr, events[i]);
+        events[i]->enableCounterBasedMode(true, ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_IMMEDIATE);
+        eventPtrs[i] = events[i].get();
+    }
+    events[0]->updateInOrderExecState(inOrderExecInfo1, 1, 0);
+    events[1]->updateInOrderExecState(inOrderExecInfo2, 2, 0);
+
+    // event signaled by the shared counter is not checked on its own, only the latest signal value is polled
+    EXPECT_EQ(ZE_RESULT_NOT_READY, Event::hostSynchronizeMultiple(2, eventPtrs, 0, true, nullptr));
+    EXPECT_FALSE(events[0]->isAlreadyCompleted());
+    EXPECT_FALSE(events[1]->isAlreadyCompleted());
+
+    counter = 2;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, Event::hostSynchronizeMultiple(2, eventPtrs, 0, true, nullptr));
+    EXPECT_TRUE(events[0]->isAlreadyCompleted());
+    EXPECT_TRUE(events[1]->isAlreadyCompleted());
+}
+
+TEST_F(EventSynchronizeTest, givenInvalidArgumentsWhenWaitingForMultipleEventsThenErrorIsReturned) {
+    Event *eventPtrs[] = {event.get(), nullptr};
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, Event::hostSynchronizeMultiple(0, eventPtrs, 0, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, Event::hostSynchronizeMultiple(2, nullptr, 0, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, Event::hostSynchronizeMultiple(2, eventPtrs, 0, true, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(0, nullptr, 0, true, nullptr));
+}
+
+struct EventCompletionCallbackTest : public EventSynchronizeTest {
+    void SetUp() override {
+        EventSynchronizeTest::SetUp();
+        reactor = new NEO::MockCompletionReactor;
+        neoDevice->getExecutionEnvironment()->completionReactor.reset(reactor);
+    }
+
+    static void callback(ze_event_handle_t hEvent, ze_result_t result, void *pUserData) {
+        auto test = static_cast<EventCompletionCallbackTest *>(pUserData);
+        test->callbackCalled++;
+        test->callbackEvent = hEvent;
+        test->callbackResult = result;
+    }
+
+    NEO::MockCompletionReactor *reactor = nullptr;
+    uint32_t callbackCalled = 0;
+    ze_event_handle_t callbackEvent = nullptr;
+    ze_result_t callbackResult = ZE_RESULT_ERROR_UNKNOWN;
+};
+
+TEST_F(EventCompletionCallbackTest, givenInvalidArgumentsWhenSettingCompletionCallbackThenErrorIsReturned) {
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventSetCompletionCallback(nullptr, callback, this));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventSetCompletionCallback(event->toHandle(), nullptr, this));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventGetCompletionNotificationFd(event->toHandle(), nullptr));
+    EXPECT_TRUE(reactor->registerList.empty());
+}
+
+TEST_F(EventCompletionCallbackTest, givenCompletionCallbackWhenEventIsSignaledThenCallbackIsCalledOnce) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventSetCompletionCallback(event->toHandle(), callback, this));
+    EXPECT_EQ(1u, reactor->openThreadCalled);
+
+    reactor->transferRegisterList();
+    reactor->processWatches();
+    EXPECT_EQ(0u, callbackCalled);
+    EXPECT_EQ(1u, reactor->watches.size());
+
+    event->hostSignal(false);
+    reactor->processWatches();
+    EXPECT_EQ(1u, callbackCalled);
+    EXPECT_EQ(event->toHandle(), callbackEvent);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, callbackResult);
+    EXPECT_TRUE(reactor->watches.empty());
+}
+
+TEST_F(EventCompletionCallbackTest, givenPendingCompletionCallbackWhenEventIsDestroyedThenWatchIsDroppedWithoutCallback) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventSetCompletionCallback(event->toHandle(), callback, this));
+    reactor->transferRegisterList();
+
+    event.release()->destroy();
+
+    reactor->processWatches();
+    EXPECT_EQ(0u, callbackCalled);
+    EXPECT_TRUE(reactor->watches.empty());
+}
+
+TEST_F(EventCompletionCallbackTest, givenPendingCompletionCallbackWhenEventIsResetThenWatchIsDroppedWithoutCallback) {
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventSetCompletionCallback(event->toHandle(), callback, this));
+    reactor->transferRegisterList();
+
+    event->reset();
+
+    reactor->processWatches();
+    EXPECT_EQ(0u, callbackCalled);
+    EXPECT_TRUE(reactor->watches.empty());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventSetCompletionCallback(event->toHandle(), callback, this));
+    reactor->transferRegisterList();
+    event->hostSignal(false);
+    reactor->processWatches();
+    EXPECT_EQ(1u, callbackCalled);
+}
+
 TEST_F(EventUsedPacketSignalSynchronizeTest, givenInfiniteTimeoutWhenWaitingForNonTimestampEventCompletionThenReturnOnlyAfterAllEventPacketsAreCompleted) {
     constexpr uint32_t packetsInUse = 2;
     event->setPacketsInUse(packetsInUse);
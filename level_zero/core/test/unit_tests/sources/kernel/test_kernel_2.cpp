@@ -221,6 +221,89 @@ TEST_F(KernelImpTest, WhenSuggestingGroupSizeThenCacheValues) {
     EXPECT_EQ(kernel.suggestGroupSizeCache[0].suggestedGroupSize[2], groupSize[2]);
 }
 
+TEST_F(KernelImpTest, givenLwsAutotuneEnabledWhenSuggestingGroupSizeThenCandidatesAreHandedOutAndLaunchesWithCandidateSizesAreMeasured) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableComputeWorkSizeND.set(false);
+    NEO::debugManager.flags.EnableLocalWorkSizeAutotune.set(1);
+    NEO::debugManager.flags.LocalWorkSizeAutotuneCacheFile.set("");
+
+    NEO::KernelInfo neoKernelInfo;
+    neoKernelInfo.kernelDescriptor.kernelMetadata.kernelName = "kernel";
+    WhiteBox<KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    descriptor.kernelAttributes.simdSize = 32;
+    kernelInfo.kernelDescriptor = &descriptor;
+    kernelInfo.kernelInfo = &neoKernelInfo;
+
+    Mock<Module> module(device, nullptr);
+    Mock<KernelImp> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.module = &module;
+
+    uint32_t defaultGroupSize[3] = {};
+    kernel.suggestDefaultGroupSize(1024, 1, 1, defaultGroupSize, defaultGroupSize + 1, defaultGroupSize + 2);
+
+    uint32_t firstGroupSize[3] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(1024, 1, 1, firstGroupSize, firstGroupSize + 1, firstGroupSize + 2));
+    EXPECT_EQ(defaultGroupSize[0], firstGroupSize[0]);
+    EXPECT_EQ(defaultGroupSize[1], firstGroupSize[1]);
+    EXPECT_EQ(defaultGroupSize[2], firstGroupSize[2]);
+
+    kernel.groupSize[0] = firstGroupSize[0];
+    kernel.groupSize[1] = firstGroupSize[1];
+    kernel.groupSize[2] = firstGroupSize[2];
+    ze_group_count_t groupCount = {1024 / firstGroupSize[0], 1, 1};
+    auto trial = kernel.getLocalWorkSizeAutotuneTrial(groupCount);
+    ASSERT_TRUE(trial.has_value());
+    EXPECT_EQ(Vec3<size_t>(firstGroupSize[0], firstGroupSize[1], firstGroupSize[2]), trial->lws);
+    EXPECT_EQ(Vec3<size_t>(1024, 1, 1), trial->key.gws);
+
+    groupCount.groupCountX *= 2;
+    EXPECT_FALSE(kernel.getLocalWorkSizeAutotuneTrial(groupCount).has_value());
+
+    uint32_t secondGroupSize[3] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(1024, 1, 1, secondGroupSize, secondGroupSize + 1, secondGroupSize + 2));
+    EXPECT_NE(firstGroupSize[0], secondGroupSize[0]);
+
+    groupCount = {1024 / firstGroupSize[0], 1, 1};
+    EXPECT_TRUE(kernel.getLocalWorkSizeAutotuneTrial(groupCount).has_value());
+
+    kernel.groupSize[0] = 3;
+    groupCount = {1, 1, 1};
+    EXPECT_FALSE(kernel.getLocalWorkSizeAutotuneTrial(groupCount).has_value());
+}
+
+TEST_F(KernelImpTest, givenLwsAutotuneEnabledAndBuiltinModuleWhenSuggestingGroupSizeThenDefaultSizeIsReturnedWithoutTrial) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableComputeWorkSizeND.set(false);
+    NEO::debugManager.flags.EnableLocalWorkSizeAutotune.set(1);
+    NEO::debugManager.flags.LocalWorkSizeAutotuneCacheFile.set("");
+
+    NEO::KernelInfo neoKernelInfo;
+    WhiteBox<KernelImmutableData> kernelInfo = {};
+    NEO::KernelDescriptor descriptor;
+    descriptor.kernelAttributes.simdSize = 32;
+    kernelInfo.kernelDescriptor = &descriptor;
+    kernelInfo.kernelInfo = &neoKernelInfo;
+
+    Mock<Module> module(device, nullptr, ModuleType::builtin);
+    Mock<KernelImp> kernel;
+    kernel.kernelImmData = &kernelInfo;
+    kernel.module = &module;
+
+    uint32_t defaultGroupSize[3] = {};
+    kernel.suggestDefaultGroupSize(1024, 1, 1, defaultGroupSize, defaultGroupSize + 1, defaultGroupSize + 2);
+
+    uint32_t groupSize[3] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, kernel.KernelImp::suggestGroupSize(1024, 1, 1, groupSize, groupSize + 1, groupSize + 2));
+    EXPECT_EQ(defaultGroupSize[0], groupSize[0]);
+
+    kernel.groupSize[0] = groupSize[0];
+    kernel.groupSize[1] = groupSize[1];
+    kernel.groupSize[2] = groupSize[2];
+    EXPECT_FALSE(kernel.getLocalWorkSizeAutotuneTrial({1024 / groupSize[0], 1, 1}).has_value());
+}
+
 class KernelImpSuggestGroupSize : public DeviceFixture, public ::testing::TestWithParam<uint32_t> {
   public:
     void SetUp() override {
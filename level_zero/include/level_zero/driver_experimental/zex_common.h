@@ -182,6 +182,11 @@ typedef enum _zex_counter_based_event_exp_flag_t {
 
 } zex_counter_based_event_exp_flag_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Callback called by the driver after event is completed
+/// @details status is ::ZE_RESULT_SUCCESS or ::ZE_RESULT_ERROR_DEVICE_LOST when GPU hang was detected
+typedef void(ZE_APICALL *zex_event_completion_callback_t)(ze_event_handle_t hEvent, ze_result_t status, void *pUserData);
+
 typedef struct _zex_counter_based_event_desc_t {
     ze_structure_type_ext_t stype;             ///< [in] type of this structure
     const void *pNext;                         ///< [in][optional] must be null or a pointer to an extension-specific
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023-2024 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -41,4 +41,28 @@ ZE_APIEXPORT ze_result_t ZE_APICALL zexCounterBasedEventOpenIpcHandle(ze_context
 
 ZE_APIEXPORT ze_result_t ZE_APICALL zexCounterBasedEventCloseIpcHandle(ze_event_handle_t hEvent);
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    uint64_t timeout,
+    ze_bool_t waitAll,
+    uint32_t *pSignaledEventIndex);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventSetCompletionCallback(
+    ze_event_handle_t hEvent,
+    zex_event_completion_callback_t pfnCallback,
+    void *pUserData);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventGetCompletionNotificationFd(
+    ze_event_handle_t hEvent,
+    int *pFd);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandQueueGetCompletionNotificationFd(
+    ze_command_queue_handle_t hCommandQueue,
+    int *pFd);
+
 } // namespace L0
@@ -911,6 +911,7 @@ bool CommandQueue::setupDebugSurface(Kernel *kernel) {
     Buffer::setSurfaceState(&device->getDevice(), surfaceState, false, false, sizeToPatch,
                             addressToPatch, 0, debugSurface, 0, 0,
                             kernel->areMultipleSubDevicesInContext());
+    kernel->markSurfaceStateHeapModified();
     return true;
 }
 
@@ -1415,6 +1416,11 @@ WaitStatus CommandQueue::waitForAllEngines(bool blockedQueue, PrintfHandler *pri
         }
     }
 
+    // Output of non-blocking printf enqueues is printed by completion reactor, it has to be flushed before returning to application
+    if (pendingAsyncPrintfOutputs->waitForAll(getGpgpuCommandStreamReceiver()) == WaitStatus::gpuHang) {
+        return WaitStatus::gpuHang;
+    }
+
     return waitStatus;
 }
 
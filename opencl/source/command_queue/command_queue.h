@@ -24,6 +24,7 @@
 #include "opencl/source/helpers/properties_helper.h"
 
 #include <cstdint>
+#include <memory>
 #include <optional>
 
 namespace NEO {
@@ -38,6 +39,7 @@ class Image;
 class IndirectHeap;
 class Kernel;
 class LinearStream;
+class PendingPrintfOutputs;
 class PerformanceCounters;
 class PrintfHandler;
 enum class WaitStatus;
@@ -497,6 +499,7 @@ class CommandQueue : public BaseObject<_cl_command_queue> {
     std::unique_ptr<TimestampPacketContainer> deferredTimestampPackets;
     std::unique_ptr<TimestampPacketContainer> deferredMultiRootSyncNodes;
     std::unique_ptr<TimestampPacketContainer> timestampPacketContainer;
+    std::shared_ptr<PendingPrintfOutputs> pendingAsyncPrintfOutputs = std::make_shared<PendingPrintfOutputs>();
 
     struct BcsTimestampPacketContainers {
         TimestampPacketContainer lastBarrierToWaitFor;
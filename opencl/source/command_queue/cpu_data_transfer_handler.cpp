@@ -9,6 +9,7 @@
 #include "shared/source/device/device.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/get_info.h"
+#include "shared/source/helpers/strided_copy.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 #include "shared/source/utilities/logger.h"
 
@@ -152,11 +153,11 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             }
             break;
         case CL_COMMAND_READ_BUFFER:
-            memcpy_s(transferProperties.ptr, transferProperties.size[0], transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
+            StridedCopy::copy(transferProperties.ptr, transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0]);
             eventCompleted = true;
             break;
         case CL_COMMAND_WRITE_BUFFER:
-            memcpy_s(transferProperties.getCpuPtrForReadWrite(), transferProperties.size[0], transferProperties.ptr, transferProperties.size[0]);
+            StridedCopy::copy(transferProperties.getCpuPtrForReadWrite(), transferProperties.ptr, transferProperties.size[0]);
             eventCompleted = true;
             modifySimulationFlags = true;
             break;
@@ -21,6 +21,7 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/program/sync_buffer_handler.h"
+#include "shared/source/utilities/local_work_size_autotuner.h"
 #include "shared/source/utilities/range.h"
 #include "shared/source/utilities/tag_allocator.h"
 
@@ -149,7 +150,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
     TagNodeBase *hwTimeStamps = nullptr;
     CommandStreamReceiver &computeCommandStreamReceiver = getGpgpuCommandStreamReceiver();
 
-    if (NEO::debugManager.flags.DeferStateInitSubmissionToFirstRegularUsage.get() == 1) {
+    if (NEO::Device::isStateInitSubmissionDeferred()) {
         computeCommandStreamReceiver.ensurePrimaryCsrInitialized(this->device->getDevice());
     }
 
@@ -450,6 +451,20 @@ cl_int CommandQueueHw<GfxFamily>::enqueueHandler(Surface **surfacesForResidency,
 
     updateFromCompletionStamp(completionStamp, eventBuilder.getEvent());
 
+    if (!blockQueue && timestampPacketContainer && multiDispatchInfo.size() == 1) {
+        auto &lwsAutotuneTrial = multiDispatchInfo.begin()->peekLwsAutotuneTrial();
+        if (lwsAutotuneTrial && !timestampPacketContainer->peekNodes().empty()) {
+            auto timestampNode = timestampPacketContainer->peekNodes()[0];
+            timestampNode->incRefCount();
+            auto &csr = getGpgpuCommandStreamReceiver();
+            csr.peekExecutionEnvironment().getLocalWorkSizeAutotuner()->submit(csr, completionStamp.taskCount, {{timestampNode, *lwsAutotuneTrial}});
+        }
+    }
+
+    if (!blockQueue && !blocking && printfHandler) {
+        PrintfHandler::printEnqueueOutputAsync(std::move(printfHandler), getGpgpuCommandStreamReceiver(), completionStamp.taskCount, pendingAsyncPrintfOutputs);
+    }
+
     if (blockQueue) {
         enqueueBlocked(commandType,
                        surfacesForResidency,
@@ -803,7 +818,9 @@ CompletionStamp CommandQueueHw<GfxFamily>::enqueueNonBlocked(
     auto &csr = getGpgpuCommandStreamReceiver();
 
     if (printfHandler) {
-        blocking = true;
+        if (!printfHandler->isAsyncOutputAllowed()) {
+            blocking = true;
+        }
         printfHandler->makeResident(csr);
     }
 
@@ -1400,7 +1417,7 @@ cl_int CommandQueueHw<GfxFamily>::enqueueBlitSplit(MultiDispatchInfo &dispatchIn
 template <typename GfxFamily>
 template <uint32_t cmdType>
 cl_int CommandQueueHw<GfxFamily>::enqueueBlit(const MultiDispatchInfo &multiDispatchInfo, cl_uint numEventsInWaitList, const cl_event *eventWaitList, cl_event *event, bool blocking, CommandStreamReceiver &bcsCsr, EventBuilder *pExternalEventBuilder) {
-    if (NEO::debugManager.flags.DeferStateInitSubmissionToFirstRegularUsage.get() == 1) {
+    if (NEO::Device::isStateInitSubmissionDeferred()) {
         bcsCsr.ensurePrimaryCsrInitialized(this->device->getDevice());
     }
 
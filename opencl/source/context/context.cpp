@@ -66,6 +66,11 @@ Context::~Context() {
         device.recordPoolsFreed(smallBufferPoolAllocator.getPoolsCount());
         smallBufferPoolAllocator.releasePools();
     }
+    if (smallImagePoolAllocator.getPoolsCount() > 0) {
+        auto &device = this->getDevice(0)->getDevice();
+        device.recordPoolsFreed(smallImagePoolAllocator.getPoolsCount());
+        smallImagePoolAllocator.releasePools();
+    }
 
     cleanupUsmAllocationPools();
 
@@ -710,6 +715,95 @@ Buffer *Context::BufferPoolAllocator::allocateFromPools(const MemoryProperties &
     return nullptr;
 }
 
+bool Context::ImagePoolAllocator::isImagePoolEnabled(Context *context) const {
+    if (debugManager.flags.ExperimentalSmallImagePoolAllocator.get() != -1) {
+        return debugManager.flags.ExperimentalSmallImagePoolAllocator.get() >= 1 && context->isSingleDeviceContext();
+    }
+    return false;
+}
+
+Context::ImagePool::ImagePool(Context *context) : BaseType(context->memoryManager,
+                                                           nullptr,
+                                                           context->getImagePoolAllocator().getParams()) {
+    static constexpr cl_mem_flags flags = CL_MEM_UNCOMPRESSED_HINT_INTEL;
+    [[maybe_unused]] cl_int errcodeRet{};
+    Buffer::AdditionalBufferCreateArgs bufferCreateArgs{};
+    bufferCreateArgs.doNotProvidePerformanceHints = true;
+    bufferCreateArgs.makeAllocationLockable = true;
+    this->mainStorage.reset(Buffer::create(context,
+                                           flags,
+                                           params.aggregatedSmallBuffersPoolSize,
+                                           nullptr,
+                                           bufferCreateArgs,
+                                           errcodeRet));
+    if (this->mainStorage) {
+        this->chunkAllocator.reset(new HeapAllocator(params.startingOffset,
+                                                     params.aggregatedSmallBuffersPoolSize,
+                                                     params.chunkAlignment));
+        context->decRefInternal();
+    }
+}
+
+const StackVec<NEO::GraphicsAllocation *, 1> &Context::ImagePool::getAllocationsVector() {
+    return this->mainStorage->getMultiGraphicsAllocation().getGraphicsAllocations();
+}
+
+Buffer *Context::ImagePool::allocate(size_t requestedSize, cl_int &errcodeRet) {
+    cl_buffer_region bufferRegion{};
+    size_t actualSize = requestedSize;
+    bufferRegion.origin = static_cast<size_t>(this->chunkAllocator->allocate(actualSize));
+    if (bufferRegion.origin == 0) {
+        return nullptr;
+    }
+    bufferRegion.origin -= params.startingOffset;
+    bufferRegion.size = requestedSize;
+    auto bufferFromPool = this->mainStorage->createSubBuffer(CL_MEM_READ_WRITE, 0, &bufferRegion, errcodeRet);
+    bufferFromPool->createFunction = this->mainStorage->createFunction;
+    bufferFromPool->setSizeInPoolAllocator(actualSize);
+    // storage is owned by the image created on top of it, never by the application
+    bufferFromPool->incRefInternal();
+    bufferFromPool->decRefApi();
+    return bufferFromPool;
+}
+
+Buffer *Context::ImagePoolAllocator::allocateStorageForImage(Context *context, size_t requestedSize, cl_int &errcodeRet) {
+    errcodeRet = CL_MEM_OBJECT_ALLOCATION_FAILURE;
+    if (!this->isSizeWithinThreshold(requestedSize)) {
+        return nullptr;
+    }
+
+    auto lock = std::unique_lock<std::mutex>(mutex);
+    auto bufferFromPool = this->allocateFromPools(requestedSize, errcodeRet);
+    if (bufferFromPool != nullptr) {
+        return bufferFromPool;
+    }
+
+    this->drain();
+
+    bufferFromPool = this->allocateFromPools(requestedSize, errcodeRet);
+    if (bufferFromPool != nullptr) {
+        return bufferFromPool;
+    }
+
+    auto &device = context->getDevice(0)->getDevice();
+    if (device.requestPoolCreate(1u)) {
+        this->addNewBufferPool(ImagePool{context});
+        return this->allocateFromPools(requestedSize, errcodeRet);
+    }
+    return nullptr;
+}
+
+Buffer *Context::ImagePoolAllocator::allocateFromPools(size_t requestedSize, cl_int &errcodeRet) {
+    for (auto &imagePool : this->bufferPools) {
+        auto bufferFromPool = imagePool.allocate(requestedSize, errcodeRet);
+        if (bufferFromPool != nullptr) {
+            return bufferFromPool;
+        }
+    }
+
+    return nullptr;
+}
+
 TagAllocatorBase *Context::getMultiRootDeviceTimestampPacketAllocator() {
     return multiRootDeviceTimestampPacketAllocator.get();
 }
@@ -100,6 +100,40 @@ class Context : public BaseObject<_cl_context> {
         Context *context{nullptr};
     };
 
+    struct ImagePool : public AbstractBuffersPool<ImagePool, Buffer, MemObj> {
+        using BaseType = AbstractBuffersPool<ImagePool, Buffer, MemObj>;
+
+        ImagePool(Context *context);
+        Buffer *allocate(size_t requestedSize, cl_int &errcodeRet);
+
+        const StackVec<NEO::GraphicsAllocation *, 1> &getAllocationsVector();
+    };
+    static_assert(NEO::NonCopyable<AbstractBuffersPool<ImagePool, Buffer, MemObj>>);
+
+    // Packs storage of small linear images into shared allocations,
+    // every pooled image is backed by an internal sub-buffer of the pool storage.
+    class ImagePoolAllocator : public AbstractBuffersAllocator<ImagePool, Buffer, MemObj> {
+        using BaseType = AbstractBuffersAllocator<ImagePool, Buffer, MemObj>;
+
+      public:
+        ImagePoolAllocator() : BaseType(getImagePoolParams()) {}
+
+        static SmallBuffersParams getImagePoolParams() {
+            return {
+                .aggregatedSmallBuffersPoolSize = 2 * MemoryConstants::megaByte,
+                .smallBufferThreshold = 64 * MemoryConstants::kiloByte,
+                .chunkAlignment = MemoryConstants::pageSize,
+                .startingOffset = MemoryConstants::pageSize};
+        }
+
+        bool isImagePoolEnabled(Context *context) const;
+        bool isSizeSuitableForPool(size_t size) const { return this->isSizeWithinThreshold(size); }
+        Buffer *allocateStorageForImage(Context *context, size_t requestedSize, cl_int &errcodeRet);
+
+      protected:
+        Buffer *allocateFromPools(size_t requestedSize, cl_int &errcodeRet);
+    };
+
     static const cl_ulong objectMagic = 0xA4234321DC002130LL;
 
     bool createImpl(const cl_context_properties *properties,
@@ -241,6 +275,9 @@ class Context : public BaseObject<_cl_context> {
     BufferPoolAllocator &getBufferPoolAllocator() {
         return smallBufferPoolAllocator;
     }
+    ImagePoolAllocator &getImagePoolAllocator() {
+        return smallImagePoolAllocator;
+    }
     UsmMemAllocPool &getDeviceMemAllocPool() {
         return usmDeviceMemAllocPool;
     }
@@ -303,6 +340,7 @@ class Context : public BaseObject<_cl_context> {
     StackVec<CommandQueue *, 1> specialQueues;
     DriverDiagnostics *driverDiagnostics = nullptr;
     BufferPoolAllocator smallBufferPoolAllocator;
+    ImagePoolAllocator smallImagePoolAllocator;
     UsmDeviceMemAllocPool usmDeviceMemAllocPool;
     UsmHostMemAllocPool usmHostMemAllocPool;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,12 +7,17 @@
 
 #include "opencl/source/event/async_events_handler.h"
 
+#include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/wait_status.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/os_interface/os_thread.h"
 
+#include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/event/event.h"
 
+#include <algorithm>
+#include <functional>
 #include <iterator>
 
 namespace NEO {
@@ -37,6 +42,25 @@ void AsyncEventsHandler::registerEvent(Event *event) {
     asyncCond.notify_one();
 }
 
+bool AsyncEventsHandler::isPending(Event *event) const {
+    return event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE));
+}
+
+bool AsyncEventsHandler::isTrackedByTaskCount(Event *event) {
+    return (event->getCommandQueue() != nullptr) &&
+           !event->isExternallySynchronized() &&
+           (event->peekExecutionStatus() == CL_SUBMITTED) &&
+           (event->peekTaskCount() != CompletionStamp::notReady) &&
+           event->isCompletionSignaledByGpgpuTaskCountOnly();
+}
+
+void AsyncEventsHandler::pushToCompletionHeap(Event *event) {
+    auto &csr = event->getCommandQueue()->getGpgpuCommandStreamReceiver();
+    auto &heap = completionHeaps[&csr];
+    heap.entries.push_back({event->peekTaskCount(), event, ClockType::now()});
+    std::push_heap(heap.entries.begin(), heap.entries.end(), std::greater<PendingCompletion>{});
+}
+
 Event *AsyncEventsHandler::processList() {
     TaskCountType lowestTaskCount = CompletionStamp::notReady;
     Event *sleepCandidate = nullptr;
@@ -44,7 +68,12 @@ Event *AsyncEventsHandler::processList() {
 
     for (auto event : list) {
         event->updateExecutionStatus();
-        if (event->peekHasCallbacks() || (event->isExternallySynchronized() && (event->peekExecutionStatus() > CL_COMPLETE))) {
+        statistics.polledEventUpdates++;
+        if (isPending(event)) {
+            if (isTrackedByTaskCount(event)) {
+                pushToCompletionHeap(event);
+                continue;
+            }
             pendingList.push_back(event);
             if (event->peekTaskCount() < lowestTaskCount) {
                 sleepCandidate = event;
@@ -56,6 +85,59 @@ Event *AsyncEventsHandler::processList() {
     }
 
     list.swap(pendingList);
+    return processCompletionHeaps(sleepCandidate);
+}
+
+Event *AsyncEventsHandler::processCompletionHeaps(Event *sleepCandidate) {
+    TaskCountType lowestTaskCount = sleepCandidate ? sleepCandidate->peekTaskCount() : CompletionStamp::notReady;
+
+    for (auto heapIt = completionHeaps.begin(); heapIt != completionHeaps.end();) {
+        auto &csr = *heapIt->first;
+        auto &heap = heapIt->second;
+
+        while (!heap.entries.empty()) {
+            if (!csr.testTaskCountReady(csr.getTagAddress(), heap.entries.front().taskCount)) {
+                heap.lastNotReadyTime = ClockType::now();
+                break;
+            }
+
+            std::pop_heap(heap.entries.begin(), heap.entries.end(), std::greater<PendingCompletion>{});
+            auto completion = heap.entries.back();
+            heap.entries.pop_back();
+
+            completion.event->updateExecutionStatus();
+
+            auto latency = ClockType::now() - std::max(completion.enqueueTime, heap.lastNotReadyTime);
+            auto latencyNs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(latency).count());
+            statistics.heapCompletedEvents++;
+            statistics.totalCallbackLatencyNs += latencyNs;
+            statistics.maxCallbackLatencyNs = std::max(statistics.maxCallbackLatencyNs, latencyNs);
+
+            if (isPending(completion.event)) {
+                // event is still waiting for an external synchronization, fall back to polling and sleep on it
+                list.push_back(completion.event);
+                if (completion.taskCount < lowestTaskCount) {
+                    sleepCandidate = completion.event;
+                    lowestTaskCount = completion.taskCount;
+                }
+            } else {
+                completion.event->decRefInternal();
+            }
+        }
+
+        if (heap.entries.empty()) {
+            heapIt = completionHeaps.erase(heapIt);
+            continue;
+        }
+
+        auto &top = heap.entries.front();
+        if (top.taskCount < lowestTaskCount) {
+            sleepCandidate = top.event;
+            lowestTaskCount = top.taskCount;
+        }
+        ++heapIt;
+    }
+
     return sleepCandidate;
 }
 
@@ -73,7 +155,7 @@ void *AsyncEventsHandler::asyncProcess(void *arg) {
             self->releaseEvents();
             break;
         }
-        if (self->list.empty()) {
+        if (self->list.empty() && self->completionHeaps.empty()) {
             self->asyncCond.wait(lock);
         }
         lock.unlock();
@@ -98,6 +180,7 @@ void AsyncEventsHandler::closeThread() {
         lock.unlock();
         thread->join();
         thread.reset(nullptr);
+        printStatistics();
     }
 }
 
@@ -110,6 +193,7 @@ void AsyncEventsHandler::openThread() {
 }
 
 void AsyncEventsHandler::transferRegisterList() {
+    statistics.registeredEvents += registerList.size();
     std::move(registerList.begin(), registerList.end(), std::back_inserter(list));
     registerList.clear();
 }
@@ -119,6 +203,19 @@ void AsyncEventsHandler::releaseEvents() {
         event->decRefInternal();
     }
     list.clear();
+    for (auto &heap : completionHeaps) {
+        for (auto &completion : heap.second.entries) {
+            completion.event->decRefInternal();
+        }
+    }
+    completionHeaps.clear();
     UNRECOVERABLE_IF(!registerList.empty()) // transferred before release
 }
+
+void AsyncEventsHandler::printStatistics() const {
+    auto averageLatencyNs = statistics.heapCompletedEvents ? statistics.totalCallbackLatencyNs / statistics.heapCompletedEvents : 0u;
+    PRINT_DEBUG_STRING(debugManager.flags.PrintAsyncEventsHandlerStatistics.get(), stdout,
+                       "AsyncEventsHandler: registered %llu, completed by tag %llu, polled updates %llu, callback latency avg %llu ns, max %llu ns\n",
+                       statistics.registeredEvents, statistics.heapCompletedEvents, statistics.polledEventUpdates, averageLatencyNs, statistics.maxCallbackLatencyNs);
+}
 } // namespace NEO
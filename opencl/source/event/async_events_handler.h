@@ -1,37 +1,74 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
 #pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace NEO {
+class CommandStreamReceiver;
 class Event;
 class Thread;
 
+struct AsyncEventsHandlerStatistics {
+    uint64_t registeredEvents = 0;
+    uint64_t heapCompletedEvents = 0;
+    uint64_t polledEventUpdates = 0;
+    uint64_t totalCallbackLatencyNs = 0;
+    uint64_t maxCallbackLatencyNs = 0;
+};
+
 class AsyncEventsHandler {
   public:
+    using ClockType = std::chrono::steady_clock;
+
     AsyncEventsHandler();
     virtual ~AsyncEventsHandler();
     void registerEvent(Event *event);
     void closeThread();
+    const AsyncEventsHandlerStatistics &getStatistics() const { return statistics; }
 
   protected:
+    struct PendingCompletion {
+        TaskCountType taskCount;
+        Event *event;
+        ClockType::time_point enqueueTime;
+
+        bool operator>(const PendingCompletion &other) const { return taskCount > other.taskCount; }
+    };
+
+    // Min-heap of submitted events ordered by task count, only the top is checked against CSR tag
+    struct CompletionHeap {
+        std::vector<PendingCompletion> entries;
+        ClockType::time_point lastNotReadyTime{};
+    };
+
     Event *processList();
+    Event *processCompletionHeaps(Event *sleepCandidate);
+    void pushToCompletionHeap(Event *event);
+    bool isPending(Event *event) const;
+    static bool isTrackedByTaskCount(Event *event);
     static void *asyncProcess(void *arg);
     void releaseEvents();
+    void printStatistics() const;
     MOCKABLE_VIRTUAL void openThread();
     MOCKABLE_VIRTUAL void transferRegisterList();
     std::vector<Event *> registerList;
     std::vector<Event *> list;
     std::vector<Event *> pendingList;
+    std::unordered_map<CommandStreamReceiver *, CompletionHeap> completionHeaps;
+    AsyncEventsHandlerStatistics statistics;
 
     std::unique_ptr<Thread> thread;
     std::mutex asyncMtx;
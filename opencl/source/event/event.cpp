@@ -29,6 +29,7 @@
 #include "opencl/source/command_queue/command_queue.h"
 #include "opencl/source/context/context.h"
 #include "opencl/source/event/async_events_handler.h"
+#include "opencl/source/event/event_unblock_batch.h"
 #include "opencl/source/helpers/get_info_status_mapper.h"
 #include "opencl/source/helpers/hardware_commands_helper.h"
 #include "opencl/source/helpers/task_information.h"
@@ -231,6 +232,11 @@ bool Event::isBcsEvent() const {
     return bcsState.isValid() && bcsState.taskCount > 0;
 }
 
+bool Event::isCompletionSignaledByGpgpuTaskCountOnly() const {
+    // copy engine and timestamp based completion is not reflected in GPGPU tag
+    return !bcsState.isValid() && !(timestampPacketContainer && isWaitForTimestampsEnabled());
+}
+
 aub_stream::EngineType Event::getBcsEngineType() const {
     return bcsState.engineType;
 }
@@ -586,6 +592,11 @@ void Event::unblockEventsBlockedByThis(int32_t transitionStatus) {
         }
     }
 
+    if (EventUnblockBatch::isEnabled()) {
+        unblockEventsInBatch(taskLevelToPropagate, transitionStatus);
+        return;
+    }
+
     auto childEventRef = childEventsToNotify.detachNodes();
     while (childEventRef != nullptr) {
         auto childEvent = childEventRef->ref;
@@ -599,6 +610,38 @@ void Event::unblockEventsBlockedByThis(int32_t transitionStatus) {
     }
 }
 
+void Event::unblockEventsInBatch(TaskCountType taskLevelToPropagate, int32_t transitionStatus) {
+    std::unique_ptr<EventUnblockBatch> ownedBatch;
+    auto unblockBatch = EventUnblockBatch::getActive();
+    if (!unblockBatch) {
+        ownedBatch = std::make_unique<EventUnblockBatch>();
+        unblockBatch = ownedBatch.get();
+    }
+
+    auto childEventRef = childEventsToNotify.detachNodes();
+    while (childEventRef != nullptr) {
+        this->incRefInternal();
+        unblockBatch->pushUnblock({childEventRef->ref, this, taskLevelToPropagate, transitionStatus});
+
+        auto next = childEventRef->next;
+        delete childEventRef;
+        childEventRef = next;
+    }
+
+    // nested unblocks only extend the worklist, the event which started the cascade drains it
+    if (!ownedBatch) {
+        return;
+    }
+
+    EventUnblockBatch::PendingUnblock unblock;
+    while (unblockBatch->popUnblock(unblock)) {
+        unblock.childEvent->unblockEventBy(*unblock.blockingEvent, unblock.taskLevel, unblock.transitionStatus);
+
+        unblock.childEvent->decRefInternal();
+        unblock.blockingEvent->decRefInternal();
+    }
+}
+
 bool Event::setStatus(cl_int status) {
     int32_t prevStatus = executionStatus;
 
@@ -648,6 +691,10 @@ void Event::submitCommand(bool abortTasks) {
         getCommandQueue()->initializeBcsEngine(getCommandQueue()->isSpecial());
         auto lockCSR = getCommandQueue()->getGpgpuCommandStreamReceiver().obtainUniqueOwnership();
 
+        if (auto unblockBatch = EventUnblockBatch::getActive()) {
+            unblockBatch->deferFlush(getCommandQueue()->getGpgpuCommandStreamReceiver());
+        }
+
         if (this->isProfilingEnabled()) {
             if (timeStampNode) {
                 this->cmdQueue->getGpgpuCommandStreamReceiver().makeResident(*timeStampNode->getBaseGraphicsAllocation());
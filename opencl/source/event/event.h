@@ -97,6 +97,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     void setupBcs(aub_stream::EngineType bcsEngineType);
     TaskCountType peekBcsTaskCountFromCommandQueue();
     bool isBcsEvent() const;
+    bool isCompletionSignaledByGpgpuTaskCountOnly() const;
     aub_stream::EngineType getBcsEngineType() const;
 
     TaskCountType getCompletionStamp() const;
@@ -291,6 +292,10 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
         return this->taskCount;
     }
 
+    TaskCountType peekBcsTaskCount() const {
+        return this->bcsState.taskCount;
+    }
+
     void setQueueTimeStamp();
     void setSubmitTimeStamp();
     void setStartTimeStamp();
@@ -353,6 +358,7 @@ class Event : public BaseObject<_cl_event>, public IDNode<Event> {
     // vector storing events that needs to be notified when this event is ready to go
     IFRefList<Event, true, true> childEventsToNotify;
     void unblockEventsBlockedByThis(int32_t transitionStatus);
+    void unblockEventsInBatch(TaskCountType taskLevelToPropagate, int32_t transitionStatus);
     void submitCommand(bool abortBlockedTasks);
 
     static void setExecutionStatusToAbortedDueToGpuHang(cl_event *first, cl_event *last);
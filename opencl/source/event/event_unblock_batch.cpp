@@ -0,0 +1,68 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/event/event_unblock_batch.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+thread_local EventUnblockBatch *EventUnblockBatch::activeBatch = nullptr;
+
+EventUnblockBatch::EventUnblockBatch() {
+    DEBUG_BREAK_IF(activeBatch != nullptr);
+    activeBatch = this;
+}
+
+EventUnblockBatch::~EventUnblockBatch() {
+    for (auto csr : batchedCsrs) {
+        auto lock = csr->obtainUniqueOwnership();
+        csr->flushBatchedSubmissions();
+        csr->overrideDispatchPolicy(DispatchMode::immediateDispatch);
+    }
+
+    PRINT_DEBUG_STRING(debugManager.flags.PrintEventUnblockBatch.get(), stdout, "Event unblock batch: %u events unblocked, %u submissions deferred on %u CSRs\n",
+                       unblockedEvents, deferredSubmissions, static_cast<uint32_t>(batchedCsrs.size()));
+
+    activeBatch = nullptr;
+}
+
+bool EventUnblockBatch::isEnabled() {
+    return debugManager.flags.EnableEventUnblockBatching.get() == 1;
+}
+
+bool EventUnblockBatch::popUnblock(PendingUnblock &unblock) {
+    if (pendingUnblocks.empty()) {
+        return false;
+    }
+    unblock = pendingUnblocks.front();
+    pendingUnblocks.pop_front();
+    unblockedEvents++;
+    return true;
+}
+
+void EventUnblockBatch::deferFlush(CommandStreamReceiver &csr) {
+    if (std::find(batchedCsrs.begin(), batchedCsrs.end(), &csr) != batchedCsrs.end()) {
+        deferredSubmissions++;
+        return;
+    }
+
+    // batched CSRs are flushed by clFlush/clFinish anyway, direct submission makes each flush cheap
+    if (csr.getDispatchMode() != DispatchMode::immediateDispatch || csr.isAnyDirectSubmissionEnabled()) {
+        return;
+    }
+
+    csr.overrideDispatchPolicy(DispatchMode::batchedDispatch);
+    batchedCsrs.push_back(&csr);
+    deferredSubmissions++;
+}
+
+} // namespace NEO
@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <cstdint>
+#include <deque>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Event;
+
+// Work released by a single event status change.
+// Unblocked events are processed from a worklist instead of recursively, submissions to
+// immediate dispatch CSRs are batched and flushed once the whole cascade is submitted.
+class EventUnblockBatch : NEO::NonCopyableAndNonMovableClass {
+  public:
+    struct PendingUnblock {
+        Event *childEvent = nullptr;
+        Event *blockingEvent = nullptr;
+        TaskCountType taskLevel = 0;
+        int32_t transitionStatus = 0;
+    };
+
+    EventUnblockBatch();
+    ~EventUnblockBatch();
+
+    static bool isEnabled();
+    static EventUnblockBatch *getActive() { return activeBatch; }
+
+    void pushUnblock(const PendingUnblock &unblock) { pendingUnblocks.push_back(unblock); }
+    bool popUnblock(PendingUnblock &unblock);
+    void deferFlush(CommandStreamReceiver &csr);
+
+  protected:
+    static thread_local EventUnblockBatch *activeBatch;
+
+    std::deque<PendingUnblock> pendingUnblocks;
+    StackVec<CommandStreamReceiver *, 4> batchedCsrs;
+    uint32_t unblockedEvents = 0;
+    uint32_t deferredSubmissions = 0;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<EventUnblockBatch>);
+
+} // namespace NEO
@@ -9,6 +9,7 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/helpers/registered_method_dispatcher.h"
 #include "shared/source/helpers/vec.h"
+#include "shared/source/utilities/local_work_size_autotuner.h"
 #include "shared/source/utilities/stackvec.h"
 
 #include "opencl/source/built_ins/builtins_dispatch_builder.h"
@@ -16,6 +17,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 
 namespace NEO {
 class LinearStream;
@@ -63,6 +65,8 @@ class DispatchInfo {
     void setStartOfWorkgroups(const Vec3<size_t> &swgs) { this->swgs = swgs; }
     bool peekCanBePartitioned() const { return canBePartitioned; }
     void setCanBePartitioned(bool canBePartitioned) { this->canBePartitioned = canBePartitioned; }
+    const std::optional<LocalWorkSizeAutotuneTrial> &peekLwsAutotuneTrial() const { return lwsAutotuneTrial; }
+    void setLwsAutotuneTrial(const LocalWorkSizeAutotuneTrial &trial) { this->lwsAutotuneTrial = trial; }
 
     RegisteredMethodDispatcher<DispatchCommandMethodT, EstimateCommandsMethodT> dispatchInitCommands{};
     RegisteredMethodDispatcher<DispatchCommandMethodT, EstimateCommandsMethodT> dispatchEpilogueCommands{};
@@ -71,6 +75,7 @@ class DispatchInfo {
     ClDevice *pClDevice = nullptr;
     bool canBePartitioned = false;
     Kernel *kernel = nullptr;
+    std::optional<LocalWorkSizeAutotuneTrial> lwsAutotuneTrial;
     uint32_t dim = 0;
 
     Vec3<size_t> gws{0, 0, 0};    // global work size
@@ -6,8 +6,11 @@
  */
 
 #pragma once
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/local_work_size.h"
 
+#include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/command_queue/cl_local_work_size.h"
 #include "opencl/source/helpers/dispatch_info.h"
 #include "opencl/source/kernel/kernel.h"
@@ -261,10 +264,14 @@ class DispatchInfoBuilder {
             }
 
             dispatchInfo.setEnqueuedWorkgroupSize(canonizeWorkgroup(dispatchInfo.getEnqueuedWorkgroupSize()));
-            if (dispatchInfo.getLocalWorkgroupSize().x == 0) {
+            auto lwsGenerated = (dispatchInfo.getLocalWorkgroupSize().x == 0);
+            if (lwsGenerated) {
                 dispatchInfo.setLWS(generateWorkgroupSize(dispatchInfo));
             }
             dispatchInfo.setLWS(canonizeWorkgroup(dispatchInfo.getLocalWorkgroupSize()));
+            if (lwsGenerated) {
+                applyLocalWorkSizeAutotune(dispatchInfo);
+            }
             if (dispatchInfo.getTotalNumberOfWorkgroups().x == 0) {
                 dispatchInfo.setTotalNumberOfWorkgroups(generateWorkgroupsNumber(dispatchInfo));
             }
@@ -311,6 +318,27 @@ class DispatchInfoBuilder {
         return (dispatchInfo.getGWS().x % dispatchInfo.getLocalWorkgroupSize().x + dispatchInfo.getGWS().y % dispatchInfo.getLocalWorkgroupSize().y + dispatchInfo.getGWS().z % dispatchInfo.getLocalWorkgroupSize().z != 0);
     }
 
+    static void applyLocalWorkSizeAutotune(DispatchInfo &dispatchInfo) {
+        auto kernel = dispatchInfo.getKernel();
+        if (kernel == nullptr || kernel->isBuiltIn) {
+            return;
+        }
+        auto &device = dispatchInfo.getClDevice().getDevice();
+        auto autotuner = device.getExecutionEnvironment()->getLocalWorkSizeAutotuner();
+        if (autotuner == nullptr || !device.getDefaultEngine().commandStreamReceiver->peekTimestampPacketWriteEnabled()) {
+            return;
+        }
+
+        const auto &kernelInfo = kernel->getKernelInfo();
+        auto key = LocalWorkSizeAutotuner::createKey(kernelInfo, device.getHardwareInfo(), dispatchInfo.getGWS());
+        bool measurementRequired = false;
+        auto lws = autotuner->selectLocalWorkSize(key, dispatchInfo.getLocalWorkgroupSize(), kernel->getMaxKernelWorkGroupSize(), kernelInfo.getMaxSimdSize(), measurementRequired);
+        dispatchInfo.setLWS(lws);
+        if (measurementRequired) {
+            dispatchInfo.setLwsAutotuneTrial({key, lws});
+        }
+    }
+
     static void pushSplit(const DispatchInfo &dispatchInfo, MultiDispatchInfo &outMdi) {
         constexpr auto xMain = SplitDispatch::RegionCoordX::left;
         constexpr auto xRight = SplitDispatch::RegionCoordX::middle;
@@ -143,6 +143,7 @@ struct HardwareCommandsHelper : public HardwareCommandsHelperBase<GfxFamily> {
         uint32_t &interfaceDescriptorIndex);
 
     static bool kernelUsesLocalIds(const Kernel &kernel);
-    static size_t checkForAdditionalBTAndSetBTPointer(IndirectHeap &ssh, const Kernel &kernel);
+    static size_t checkForAdditionalBTAndSetBTPointer(IndirectHeap &ssh, Kernel &kernel);
+    static bool isSurfaceStateBlockReuseEnabled();
 };
 } // namespace NEO
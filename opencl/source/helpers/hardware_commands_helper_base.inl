@@ -370,17 +370,34 @@ bool HardwareCommandsHelper<GfxFamily>::kernelUsesLocalIds(const Kernel &kernel)
 }
 
 template <typename GfxFamily>
-size_t HardwareCommandsHelper<GfxFamily>::checkForAdditionalBTAndSetBTPointer(IndirectHeap &ssh, const Kernel &kernel) {
+size_t HardwareCommandsHelper<GfxFamily>::checkForAdditionalBTAndSetBTPointer(IndirectHeap &ssh, Kernel &kernel) {
     size_t dstBindingTablePointer{0u};
     const auto &kernelInfo = kernel.getKernelInfo();
     if (false == isGTPinInitialized && 0u == kernelInfo.kernelDescriptor.payloadMappings.bindingTable.numEntries) {
         dstBindingTablePointer = 0u;
     } else {
+        auto blockReuseAllowed = isSurfaceStateBlockReuseEnabled() && false == isGTPinInitialized && kernel.getNumberOfBindingTableStates() > 0u;
+        if (blockReuseAllowed) {
+            // every path writing the kernel's surface states bumps its generation,
+            // so a block emitted into the current heap buffer at the same generation is identical
+            auto emittedBlock = kernel.getEmittedSurfaceStateBlock(ssh.getBufferId());
+            if (emittedBlock && emittedBlock->surfaceStateHeapGeneration == kernel.getSurfaceStateHeapGeneration()) {
+                return emittedBlock->surfaceStatesOffset + kernel.getBindingTableOffset();
+            }
+        }
         dstBindingTablePointer = EncodeSurfaceState<GfxFamily>::pushBindingTableAndSurfaceStates(ssh,
                                                                                                  kernel.getSurfaceStateHeap(), kernel.getSurfaceStateHeapSize(),
                                                                                                  kernel.getNumberOfBindingTableStates(), kernel.getBindingTableOffset());
+        if (blockReuseAllowed) {
+            kernel.storeEmittedSurfaceStateBlock(ssh.getBufferId(), dstBindingTablePointer - kernel.getBindingTableOffset());
+        }
     }
     return dstBindingTablePointer;
 }
 
+template <typename GfxFamily>
+bool HardwareCommandsHelper<GfxFamily>::isSurfaceStateBlockReuseEnabled() {
+    return debugManager.flags.EnableSurfaceStateBlockReuse.get() == 1;
+}
+
 } // namespace NEO
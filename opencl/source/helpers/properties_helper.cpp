@@ -9,7 +9,9 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/timestamp_packet.h"
+#include "shared/source/helpers/wait_list_compaction.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
 
@@ -27,10 +29,45 @@ void flushDependentCsr(CommandStreamReceiver &dependentCsr, CsrDependencies &csr
     dependentCsr.updateTagFromWait();
 }
 
+CommandStreamReceiver *getDependentCsr(Event &event) {
+    if (event.isBcsEvent()) {
+        return event.getCommandQueue()->getBcsCommandStreamReceiver(event.getBcsEngineType());
+    }
+    return &event.getCommandQueue()->getGpgpuCommandStreamReceiver();
+}
+
+void EventsRequest::compactWaitList(WaitListCompactor &compactor, CommandStreamReceiver &currentCsr) const {
+    for (cl_uint i = 0; i < this->numEventsInWaitList; i++) {
+        auto event = castToObjectOrAbort<Event>(this->eventWaitList[i]);
+        if (event->isUserEvent() || !event->getCommandQueue() || (CompletionStamp::notReady == event->peekTaskCount())) {
+            continue;
+        }
+        if (event->getCommandQueue()->getClDevice().getRootDeviceIndex() != currentCsr.getRootDeviceIndex()) {
+            continue;
+        }
+
+        auto dependentCsr = getDependentCsr(*event);
+        auto waitValue = event->isBcsEvent() ? event->peekBcsTaskCount() : event->peekTaskCount();
+
+        if (event->peekExecutionStatus() == CL_COMPLETE) {
+            compactor.addCompletedWait(i);
+        } else if (!event->getCommandQueue()->isOOQEnabled()) {
+            compactor.addTimelineWait(i, {event->getCommandQueue(), castToUint64(dependentCsr)}, waitValue);
+        }
+    }
+    compactor.compact();
+}
+
 void EventsRequest::fillCsrDependenciesForTimestampPacketContainer(CsrDependencies &csrDeps, CommandStreamReceiver &currentCsr, CsrDependencies::DependenciesType depsType) const {
+    WaitListCompactor compactor(this->numEventsInWaitList);
+    if (WaitListCompactor::isEnabled()) {
+        compactWaitList(compactor, currentCsr);
+        compactor.printStats("clEnqueue wait list");
+    }
+
     for (cl_uint i = 0; i < this->numEventsInWaitList; i++) {
         auto event = castToObjectOrAbort<Event>(this->eventWaitList[i]);
-        if (event->isUserEvent()) {
+        if (event->isUserEvent() || !compactor.isRequired(i)) {
             continue;
         }
 
@@ -44,12 +81,7 @@ void EventsRequest::fillCsrDependenciesForTimestampPacketContainer(CsrDependenci
             continue;
         }
 
-        CommandStreamReceiver *dependentCsr;
-        if (event->isBcsEvent()) {
-            dependentCsr = event->getCommandQueue()->getBcsCommandStreamReceiver(event->getBcsEngineType());
-        } else {
-            dependentCsr = &event->getCommandQueue()->getGpgpuCommandStreamReceiver();
-        }
+        auto dependentCsr = getDependentCsr(*event);
         const auto sameCsr = (dependentCsr == &currentCsr);
         const auto pushDependency = (CsrDependencies::DependenciesType::onCsr == depsType && sameCsr) ||
                                     (CsrDependencies::DependenciesType::outOfCsr == depsType && !sameCsr) ||
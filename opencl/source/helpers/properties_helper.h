@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -17,6 +17,7 @@ namespace NEO {
 class MemObj;
 class Buffer;
 class GraphicsAllocation;
+class WaitListCompactor;
 
 struct EventsRequest {
     EventsRequest() = delete;
@@ -27,6 +28,7 @@ struct EventsRequest {
     void fillCsrDependenciesForTimestampPacketContainer(CsrDependencies &csrDeps, CommandStreamReceiver &currentCsr, CsrDependencies::DependenciesType depsType) const;
     void fillCsrDependenciesForRootDevices(CsrDependencies &csrDeps, CommandStreamReceiver &currentCsr) const;
     void setupBcsCsrForOutputEvent(CommandStreamReceiver &bcsCsr) const;
+    void compactWaitList(WaitListCompactor &compactor, CommandStreamReceiver &currentCsr) const;
 
     cl_uint numEventsInWaitList;
     const cl_event *eventWaitList;
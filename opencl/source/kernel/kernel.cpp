@@ -129,6 +129,7 @@ inline void patch(const SrcT &src, void *dst, CrossThreadDataOffset dstOffsetByt
 }
 
 void Kernel::patchWithImplicitSurface(uint64_t ptrToPatchInCrossThreadData, GraphicsAllocation &allocation, const ArgDescPointer &arg) {
+    markSurfaceStateHeapModified();
     if ((nullptr != crossThreadData) && isValidOffset(arg.stateless)) {
         auto pp = ptrOffset(crossThreadData, arg.stateless);
         patchWithRequiredSize(pp, arg.pointerSize, ptrToPatchInCrossThreadData);
@@ -866,6 +867,29 @@ void Kernel::resizeSurfaceStateHeap(void *pNewSsh, size_t newSshSize, size_t new
     sshLocalSize = static_cast<uint32_t>(newSshSize);
     numberOfBindingTableStates = newBindingTableCount;
     localBindingTableOffset = newBindingTableOffset;
+    emittedSurfaceStateBlocks.fill({});
+    markSurfaceStateHeapModified();
+}
+
+const Kernel::EmittedSurfaceStateBlock *Kernel::getEmittedSurfaceStateBlock(uint64_t heapBufferId) const {
+    for (const auto &block : emittedSurfaceStateBlocks) {
+        if (block.valid && block.heapBufferId == heapBufferId) {
+            return &block;
+        }
+    }
+    return nullptr;
+}
+
+void Kernel::storeEmittedSurfaceStateBlock(uint64_t heapBufferId, size_t surfaceStatesOffset) {
+    EmittedSurfaceStateBlock emittedBlock = {heapBufferId, surfaceStateHeapGeneration, surfaceStatesOffset, true};
+    for (auto &block : emittedSurfaceStateBlocks) {
+        if (block.valid && block.heapBufferId == heapBufferId) {
+            block = emittedBlock;
+            return;
+        }
+    }
+    emittedSurfaceStateBlocks[nextEmittedSurfaceStateBlock] = emittedBlock;
+    nextEmittedSurfaceStateBlock = (nextEmittedSurfaceStateBlock + 1) % maxEmittedSurfaceStateBlocks;
 }
 
 void Kernel::markArgPatchedAndResolveArgs(uint32_t argIndex) {
@@ -950,6 +974,7 @@ void *Kernel::patchBufferOffset(const ArgDescPointer &argAsPtr, void *svmPtr, Gr
 }
 
 cl_int Kernel::setArgSvm(uint32_t argIndex, size_t svmAllocSize, void *svmPtr, GraphicsAllocation *svmAlloc, cl_mem_flags svmFlags) {
+    markSurfaceStateHeapModified();
     const auto &argAsPtr = getKernelInfo().kernelDescriptor.payloadMappings.explicitArgs[argIndex].as<ArgDescPointer>();
 
     auto patchLocation = ptrOffset(getCrossThreadData(), argAsPtr.stateless);
@@ -984,6 +1009,7 @@ cl_int Kernel::setArgSvm(uint32_t argIndex, size_t svmAllocSize, void *svmPtr, G
 }
 
 cl_int Kernel::setArgSvmAlloc(uint32_t argIndex, void *svmPtr, GraphicsAllocation *svmAlloc, uint32_t allocId) {
+    markSurfaceStateHeapModified();
     DBG_LOG_INPUTS("setArgBuffer svm_alloc", svmAlloc);
 
     const auto &argAsPtr = getKernelInfo().kernelDescriptor.payloadMappings.explicitArgs[argIndex].as<ArgDescPointer>();
@@ -1438,6 +1464,7 @@ cl_int Kernel::setArgLocal(uint32_t argIndexIn,
 cl_int Kernel::setArgBuffer(uint32_t argIndex,
                             size_t argSize,
                             const void *argVal) {
+    markSurfaceStateHeapModified();
 
     if (argSize != sizeof(cl_mem *)) {
         return CL_INVALID_ARG_SIZE;
@@ -1544,6 +1571,7 @@ cl_int Kernel::setArgBuffer(uint32_t argIndex,
 cl_int Kernel::setArgPipe(uint32_t argIndex,
                           size_t argSize,
                           const void *argVal) {
+    markSurfaceStateHeapModified();
 
     if (argSize != sizeof(cl_mem *)) {
         return CL_INVALID_ARG_SIZE;
@@ -1561,6 +1589,7 @@ cl_int Kernel::setArgImage(uint32_t argIndex,
 cl_int Kernel::setArgImageWithMipLevel(uint32_t argIndex,
                                        size_t argSize,
                                        const void *argVal, uint32_t mipLevel) {
+    markSurfaceStateHeapModified();
     auto retVal = CL_INVALID_ARG_VALUE;
     auto rootDeviceIndex = getDevice().getRootDeviceIndex();
 
@@ -1829,6 +1858,7 @@ bool Kernel::usesSyncBuffer() const {
 }
 
 void Kernel::patchSyncBuffer(GraphicsAllocation *gfxAllocation, size_t bufferOffset) {
+    markSurfaceStateHeapModified();
     const auto &syncBuffer = kernelInfo.kernelDescriptor.payloadMappings.implicitArgs.syncBufferAddress;
     auto bufferPatchAddress = ptrOffset(crossThreadData, syncBuffer.stateless);
     patchWithRequiredSize(bufferPatchAddress, syncBuffer.pointerSize,
@@ -22,6 +22,7 @@
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/kernel/kernel_objects_for_aux_translation.h"
 
+#include <array>
 #include <map>
 #include <vector>
 
@@ -165,6 +166,18 @@ class Kernel : public ReferenceTrackedObject<Kernel>, NEO::NonCopyableAndNonMova
 
     void resizeSurfaceStateHeap(void *pNewSsh, size_t newSshSize, size_t newBindingTableCount, size_t newBindingTableOffset);
 
+    struct EmittedSurfaceStateBlock {
+        uint64_t heapBufferId = 0u;
+        uint64_t surfaceStateHeapGeneration = 0u;
+        size_t surfaceStatesOffset = 0u;
+        bool valid = false;
+    };
+    static constexpr size_t maxEmittedSurfaceStateBlocks = 4u;
+    const EmittedSurfaceStateBlock *getEmittedSurfaceStateBlock(uint64_t heapBufferId) const;
+    void storeEmittedSurfaceStateBlock(uint64_t heapBufferId, size_t surfaceStatesOffset);
+    void markSurfaceStateHeapModified() { surfaceStateHeapGeneration++; }
+    uint64_t getSurfaceStateHeapGeneration() const { return surfaceStateHeapGeneration; }
+
     void substituteKernelHeap(void *newKernelHeap, size_t newKernelHeapSize);
     bool isKernelHeapSubstituted() const;
     uint64_t getKernelId() const;
@@ -436,6 +449,10 @@ class Kernel : public ReferenceTrackedObject<Kernel>, NEO::NonCopyableAndNonMova
     size_t numberOfBindingTableStates = 0u;
     size_t localBindingTableOffset = 0u;
 
+    std::array<EmittedSurfaceStateBlock, maxEmittedSurfaceStateBlocks> emittedSurfaceStateBlocks = {};
+    size_t nextEmittedSurfaceStateBlock = 0u;
+    uint64_t surfaceStateHeapGeneration = 0u;
+
     const ExecutionEnvironment &executionEnvironment;
     Program *program;
     ClDevice &clDevice;
@@ -19,6 +19,7 @@
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/local_memory_access_modes.h"
 #include "shared/source/helpers/memory_properties_helpers.h"
+#include "shared/source/helpers/strided_copy.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/host_ptr_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
@@ -759,7 +760,7 @@ void Buffer::transferData(void *dst, void *src, size_t copySize, size_t copyOffs
     DBG_LOG(LogMemoryObject, __FUNCTION__, " hostPtr: ", hostPtr, ", size: ", copySize, ", offset: ", copyOffset, ", memoryStorage: ", memoryStorage);
     auto dstPtr = ptrOffset(dst, copyOffset);
     auto srcPtr = ptrOffset(src, copyOffset);
-    memcpy_s(dstPtr, copySize, srcPtr, copySize);
+    StridedCopy::copy(dstPtr, srcPtr, copySize);
 }
 
 void Buffer::transferDataToHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) {
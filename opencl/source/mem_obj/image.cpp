@@ -20,6 +20,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/strided_copy.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/migration_sync_data.h"
@@ -132,18 +133,21 @@ void Image::transferData(void *dest, size_t destRowPitch, size_t destSlicePitch,
         std::swap(copyRegion[1], copyRegion[2]);
     }
 
-    for (size_t slice = copyOrigin[2]; slice < (copyOrigin[2] + copyRegion[2]); slice++) {
-        auto srcSliceOffset = ptrOffset(src, srcSlicePitch * slice);
-        auto dstSliceOffset = ptrOffset(dest, destSlicePitch * slice);
-
-        for (size_t height = copyOrigin[1]; height < (copyOrigin[1] + copyRegion[1]); height++) {
-            auto srcRowOffset = ptrOffset(srcSliceOffset, srcRowPitch * height);
-            auto dstRowOffset = ptrOffset(dstSliceOffset, destRowPitch * height);
+    auto originOffset = [&](size_t rowPitch, size_t slicePitch) {
+        return copyOrigin[2] * slicePitch + copyOrigin[1] * rowPitch + copyOrigin[0] * pixelSize;
+    };
 
-            memcpy_s(ptrOffset(dstRowOffset, copyOrigin[0] * pixelSize), lineWidth,
-                     ptrOffset(srcRowOffset, copyOrigin[0] * pixelSize), lineWidth);
-        }
-    }
+    StridedCopyRegion region{};
+    region.dst = ptrOffset(dest, originOffset(destRowPitch, destSlicePitch));
+    region.dstRowPitch = destRowPitch;
+    region.dstSlicePitch = destSlicePitch;
+    region.src = ptrOffset(src, originOffset(srcRowPitch, srcSlicePitch));
+    region.srcRowPitch = srcRowPitch;
+    region.srcSlicePitch = srcSlicePitch;
+    region.rowSize = lineWidth;
+    region.rowCount = copyRegion[1];
+    region.sliceCount = copyRegion[2];
+    StridedCopy::copyRegion(region);
 }
 
 Image *Image::create(Context *context,
@@ -225,7 +229,17 @@ Image *Image::create(Context *context,
     AllocationInfoType allocationInfos;
     allocationInfos.resize(maxRootDeviceIndex + 1u);
 
-    bool isParentObject = parentBuffer || parentImage;
+    Buffer *poolStorage = nullptr;
+    if (!parentBuffer && !parentImage && isSuitableForImagePool(*context, memoryProperties, *imageDesc, imgInfo, *surfaceFormat)) {
+        const auto rowPitch = alignUp(imageWidth * surfaceFormat->surfaceFormat.imageElementSizeInBytes, MemoryConstants::cacheLineSize);
+        cl_int poolErrcode = CL_SUCCESS;
+        poolStorage = context->getImagePoolAllocator().allocateStorageForImage(context, rowPitch * imageHeight, poolErrcode);
+        if (poolStorage) {
+            imgInfo.rowPitch = rowPitch;
+        }
+    }
+
+    bool isParentObject = parentBuffer || parentImage || poolStorage;
     auto imageFromBuffer = isImageFromBuffer(*imageDesc, parentBuffer);
 
     // get allocation for image
@@ -246,6 +260,9 @@ Image *Image::create(Context *context,
                 errcodeRet = CL_INVALID_MEM_OBJECT;
                 return nullptr;
             }
+        } else if (poolStorage) {
+            // Image from pool - memory is a sub-allocation of the pool storage owned by the image
+            setAllocationInfoFromPoolStorage(allocationInfo, poolStorage, imgInfo, rootDeviceIndex);
         } else if (parentImage != nullptr) {
             // Image from parent image - reuse allocation from parent image
             allocationInfo.memory = parentImage->getGraphicsAllocation(rootDeviceIndex);
@@ -264,10 +281,13 @@ Image *Image::create(Context *context,
         if (!allocationInfo.memory) {
             errcodeRet = CL_OUT_OF_HOST_MEMORY;
             cleanAllGraphicsAllocations(*context, *memoryManager, allocationInfos, isParentObject);
+            if (poolStorage) {
+                poolStorage->decRefInternal();
+            }
             return nullptr;
         }
 
-        if (parentBuffer == nullptr) {
+        if (parentBuffer == nullptr && poolStorage == nullptr) {
             allocationInfo.memory->setAllocationType(AllocationType::image);
         }
 
@@ -281,7 +301,9 @@ Image *Image::create(Context *context,
                           !memoryProperties.flags.hostReadOnly &&
                           !memoryProperties.flags.hostNoAccess;
 
-        allocationInfo.memory->setMemObjectsAllocationWithWritableFlags(isWritable);
+        if (poolStorage == nullptr) {
+            allocationInfo.memory->setMemObjectsAllocationWithWritableFlags(isWritable);
+        }
         allocationInfo.transferNeeded |= memoryProperties.flags.copyHostPtr;
 
         DBG_LOG(LogMemoryObject, __FUNCTION__, "hostPtr:", hostPtr, "size:", allocationInfo.memory->getUnderlyingBufferSize(),
@@ -298,6 +320,11 @@ Image *Image::create(Context *context,
                                  imageDescriptor, allocationInfos[defaultRootDeviceIndex].zeroCopyAllowed, std::move(multiGraphicsAllocation), false, 0, 0, surfaceFormat);
 
     setImageProperties(image, *imageDesc, imgInfo, parentImage, parentBuffer, hostPtrRowPitch, hostPtrSlicePitch, imageCount, hostPtrMinSize);
+    if (poolStorage) {
+        image->associatedMemObject = poolStorage;
+        // pool storage is shared, CPU accesses have to start at the chunk owned by this image
+        image->memoryStorage = ptrOffset(image->memoryStorage, imgInfo.offset);
+    }
 
     errcodeRet = CL_SUCCESS;
     auto &defaultHwInfo = defaultDevice->getHardwareInfo();
@@ -327,13 +354,13 @@ Image *Image::create(Context *context,
         bool isCpuTransferPreferredInSystemMemory = imgInfo.linearStorage && allocationInSystemMemory;
 
         if (isCpuTransferPreferredInSystemMemory) {
-            void *pDestinationAddress = memory->getUnderlyingBuffer();
+            void *pDestinationAddress = ptrOffset(memory->getUnderlyingBuffer(), imgInfo.offset);
             image->transferData(pDestinationAddress, imgInfo.rowPitch, imgInfo.slicePitch,
                                 const_cast<void *>(hostPtr), hostPtrRowPitch, hostPtrSlicePitch,
                                 copyRegion, copyOrigin);
 
         } else if (isCpuTransferPreferred) {
-            void *pDestinationAddress = context->getMemoryManager()->lockResource(memory);
+            void *pDestinationAddress = ptrOffset(context->getMemoryManager()->lockResource(memory), imgInfo.offset);
             image->transferData(pDestinationAddress, imgInfo.rowPitch, imgInfo.slicePitch,
                                 const_cast<void *>(hostPtr), hostPtrRowPitch, hostPtrSlicePitch,
                                 copyRegion, copyOrigin);
@@ -1202,6 +1229,31 @@ void Image::setAllocationInfoFromParentBuffer(CreateMemObj::AllocationInfo &allo
     imageInfo.offset = parentBuffer->getOffset();
 }
 
+void Image::setAllocationInfoFromPoolStorage(CreateMemObj::AllocationInfo &allocationInfo, Buffer *poolStorage, ImageInfo &imageInfo, uint32_t rootDeviceIndex) {
+    allocationInfo.memory = poolStorage->getGraphicsAllocation(rootDeviceIndex);
+
+    UNRECOVERABLE_IF(imageInfo.rowPitch == 0);
+    imageInfo.slicePitch = imageInfo.rowPitch * imageInfo.imgDesc.imageHeight;
+    imageInfo.size = poolStorage->getSize();
+    imageInfo.qPitch = 0;
+    imageInfo.offset = poolStorage->getOffset();
+}
+
+bool Image::isSuitableForImagePool(Context &context, const MemoryProperties &memoryProperties, const cl_image_desc &imageDesc,
+                                   const ImageInfo &imageInfo, const ClSurfaceFormatInfo &surfaceFormat) {
+    // tiled and compressed images need own GMM resource, only linear storage can be packed
+    return imageInfo.linearStorage &&
+           imageDesc.image_type == CL_MEM_OBJECT_IMAGE2D &&
+           imageDesc.num_mip_levels == 0 &&
+           imageDesc.num_samples <= 1 &&
+           !memoryProperties.flags.useHostPtr &&
+           !memoryProperties.flags.allocHostPtr &&
+           !memoryProperties.flags.forceHostMemory &&
+           !isNV12Image(&surfaceFormat.oclImageFormat) &&
+           !isPackedYuvImage(&surfaceFormat.oclImageFormat) &&
+           context.getImagePoolAllocator().isImagePoolEnabled(&context);
+}
+
 void Image::setAllocationInfoFromHostPtr(CreateMemObj::AllocationInfo &allocationInfo, uint32_t rootDeviceIndex, const HardwareInfo &hwInfo,
                                          const MemoryProperties &memoryProperties, ImageInfo &imageInfo, Context *context, bool preferCompression,
                                          MemoryManager *memoryManager, const void *hostPtr, size_t hostPtrMinSize) {
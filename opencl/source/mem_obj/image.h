@@ -277,6 +277,11 @@ class Image : public MemObj {
     static void setAllocationInfoFromParentBuffer(CreateMemObj::AllocationInfo &allocationInfo, const void *&hostPtr, void *&hostPtrToSet,
                                                   Buffer *parentBuffer, ImageInfo &imageInfo, uint32_t rootDeviceIndex);
 
+    static void setAllocationInfoFromPoolStorage(CreateMemObj::AllocationInfo &allocationInfo, Buffer *poolStorage, ImageInfo &imageInfo, uint32_t rootDeviceIndex);
+
+    static bool isSuitableForImagePool(Context &context, const MemoryProperties &memoryProperties, const cl_image_desc &imageDesc,
+                                       const ImageInfo &imageInfo, const ClSurfaceFormatInfo &surfaceFormat);
+
     static void setAllocationInfoFromHostPtr(CreateMemObj::AllocationInfo &allocationInfo, uint32_t rootDeviceIndex, const HardwareInfo &hwInfo,
                                              const MemoryProperties &memoryProperties, ImageInfo &imageInfo, Context *context, bool preferCompression,
                                              MemoryManager *memoryManager, const void *hostPtr, size_t hostPtrMinSize);
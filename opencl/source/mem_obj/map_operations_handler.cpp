@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,8 @@
 
 #include "shared/source/helpers/ptr_math.h"
 
+#include <algorithm>
+
 using namespace NEO;
 
 size_t MapOperationsHandler::size() const {
@@ -26,10 +28,17 @@ bool MapOperationsHandler::add(void *ptr, size_t ptrLength, cl_map_flags &mapFla
         return false;
     }
 
-    mappedPointers.push_back(mapInfo);
+    mappedPointers.emplace(ptr, mapInfo);
+    maxMappedLength = std::max(maxMappedLength, ptrLength);
     return true;
 }
 
+MapOperationsHandler::MappedPointers::const_iterator MapOperationsHandler::getFirstReachingMapping(const void *ptr) const {
+    auto ptrValue = castToUint64(ptr);
+    auto lowestStartPtr = ptrValue > maxMappedLength ? reinterpret_cast<const void *>(static_cast<uintptr_t>(ptrValue - maxMappedLength)) : nullptr;
+    return mappedPointers.lower_bound(lowestStartPtr);
+}
+
 bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
     if (inputMapInfo.readOnly) {
         return false;
@@ -37,12 +46,11 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
     auto inputStartPtr = inputMapInfo.ptr;
     auto inputEndPtr = ptrOffset(inputStartPtr, inputMapInfo.ptrLength);
 
-    for (auto &mapInfo : mappedPointers) {
-        auto mappedStartPtr = mapInfo.ptr;
-        auto mappedEndPtr = ptrOffset(mappedStartPtr, mapInfo.ptrLength);
+    for (auto it = getFirstReachingMapping(inputStartPtr); it != mappedPointers.end() && it->first <= inputEndPtr; it++) {
+        auto mappedEndPtr = ptrOffset(it->second.ptr, it->second.ptrLength);
 
         // Requested ptr starts before or inside existing ptr range and overlapping end
-        if (inputStartPtr < mappedEndPtr && inputEndPtr >= mappedStartPtr) {
+        if (inputStartPtr < mappedEndPtr) {
             return true;
         }
     }
@@ -52,24 +60,22 @@ bool MapOperationsHandler::isOverlapping(MapInfo &inputMapInfo) {
 bool MapOperationsHandler::find(void *mappedPtr, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        if (mapInfo.ptr == mappedPtr) {
-            outMapInfo = mapInfo;
-            return true;
-        }
+    auto it = mappedPointers.find(mappedPtr);
+    if (it == mappedPointers.end()) {
+        return false;
     }
-    return false;
+    outMapInfo = it->second;
+    return true;
 }
 
 bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size, MapInfo &outMapInfo) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    for (auto &mapInfo : mappedPointers) {
-        void *ptrStart = mapInfo.ptr;
-        void *ptrEnd = ptrOffset(mapInfo.ptr, mapInfo.ptrLength);
+    for (auto it = getFirstReachingMapping(ptr); it != mappedPointers.end() && it->first <= ptr; it++) {
+        void *ptrEnd = ptrOffset(it->second.ptr, it->second.ptrLength);
 
-        if (ptrStart <= ptr && ptrOffset(ptr, size) <= ptrEnd) {
-            outMapInfo = mapInfo;
+        if (ptrOffset(ptr, size) <= ptrEnd) {
+            outMapInfo = it->second;
             return true;
         }
     }
@@ -79,25 +85,32 @@ bool NEO::MapOperationsHandler::findInfoForHostPtr(const void *ptr, size_t size,
 void MapOperationsHandler::remove(void *mappedPtr) {
     std::lock_guard<std::mutex> lock(mtx);
 
-    auto endIter = mappedPointers.end();
-    for (auto it = mappedPointers.begin(); it != endIter; it++) {
-        if (it->ptr == mappedPtr) {
-            std::iter_swap(it, mappedPointers.end() - 1);
-            mappedPointers.pop_back();
-            break;
-        }
+    auto it = mappedPointers.find(mappedPtr);
+    if (it != mappedPointers.end()) {
+        mappedPointers.erase(it);
+    }
+    if (mappedPointers.empty()) {
+        maxMappedLength = 0;
     }
 }
 
+size_t NEO::MapOperationsStorage::getShardIndex(cl_mem memObj) {
+    // memory objects are heap allocated, skip low bits coming from allocation alignment
+    auto key = static_cast<size_t>(castToUint64(memObj));
+    return ((key >> 4) ^ (key >> 10) ^ (key >> 16)) % shardsCount;
+}
+
 MapOperationsHandler &NEO::MapOperationsStorage::getHandler(cl_mem memObj) {
-    std::lock_guard<std::mutex> lock(mutex);
-    return handlers[memObj];
+    auto &shard = getShard(memObj);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    return shard.handlers[memObj];
 }
 
 MapOperationsHandler *NEO::MapOperationsStorage::getHandlerIfExists(cl_mem memObj) {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto iterator = handlers.find(memObj);
-    if (iterator == handlers.end()) {
+    auto &shard = getShard(memObj);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iterator = shard.handlers.find(memObj);
+    if (iterator == shard.handlers.end()) {
         return nullptr;
     }
 
@@ -105,17 +118,20 @@ MapOperationsHandler *NEO::MapOperationsStorage::getHandlerIfExists(cl_mem memOb
 }
 
 bool NEO::MapOperationsStorage::getInfoForHostPtr(const void *ptr, size_t size, MapInfo &outInfo) {
-    std::lock_guard<std::mutex> lock(mutex);
-    for (auto &entry : handlers) {
-        if (entry.second.findInfoForHostPtr(ptr, size, outInfo)) {
-            return true;
+    for (auto &shard : shards) {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        for (auto &entry : shard.handlers) {
+            if (entry.second.findInfoForHostPtr(ptr, size, outInfo)) {
+                return true;
+            }
         }
     }
     return false;
 }
 
 void NEO::MapOperationsStorage::removeHandler(cl_mem memObj) {
-    std::lock_guard<std::mutex> lock(mutex);
-    auto iterator = handlers.find(memObj);
-    handlers.erase(iterator);
+    auto &shard = getShard(memObj);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto iterator = shard.handlers.find(memObj);
+    shard.handlers.erase(iterator);
 }
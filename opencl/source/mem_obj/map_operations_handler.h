@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2021 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,9 +8,10 @@
 #pragma once
 #include "opencl/source/helpers/properties_helper.h"
 
+#include <array>
+#include <map>
 #include <mutex>
 #include <unordered_map>
-#include <vector>
 
 namespace NEO {
 
@@ -25,14 +26,21 @@ class MapOperationsHandler {
     size_t size() const;
 
   protected:
+    using MappedPointers = std::multimap<const void *, MapInfo>;
+
     bool isOverlapping(MapInfo &inputMapInfo);
-    std::vector<MapInfo> mappedPointers;
+    MappedPointers::const_iterator getFirstReachingMapping(const void *ptr) const;
+
+    // ordered by mapped ptr, only mappings starting at most maxMappedLength before given ptr can contain it
+    MappedPointers mappedPointers;
+    size_t maxMappedLength = 0;
     mutable std::mutex mtx;
 };
 
 class MapOperationsStorage {
   public:
     using HandlersMap = std::unordered_map<cl_mem, MapOperationsHandler>;
+    static constexpr size_t shardsCount = 16;
 
     MapOperationsHandler &getHandler(cl_mem memObj);
     MapOperationsHandler *getHandlerIfExists(cl_mem memObj);
@@ -40,8 +48,16 @@ class MapOperationsStorage {
     void removeHandler(cl_mem memObj);
 
   protected:
-    std::mutex mutex;
-    HandlersMap handlers{};
+    // handlers are spread over independently locked shards, so threads mapping different objects do not contend
+    struct Shard {
+        std::mutex mutex;
+        HandlersMap handlers{};
+    };
+
+    static size_t getShardIndex(cl_mem memObj);
+    Shard &getShard(cl_mem memObj) { return shards[getShardIndex(memObj)]; }
+
+    std::array<Shard, shardsCount> shards;
 };
 
 } // namespace NEO
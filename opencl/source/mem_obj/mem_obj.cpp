@@ -75,8 +75,10 @@ MemObj::~MemObj() {
     }
 
     if (!isObjectRedescribed) {
+        const bool ownsMapStorage = !associatedMemObject || isStorageFromImagePool();
+        bool allocationReleasable = true;
         if (peekSharingHandler()) {
-            peekSharingHandler()->releaseReusedGraphicsAllocation();
+            allocationReleasable = peekSharingHandler()->releaseReusedGraphicsAllocation();
         }
 
         needWait |= multiGraphicsAllocation.getGraphicsAllocations().size() > 1u;
@@ -84,7 +86,7 @@ MemObj::~MemObj() {
             auto rootDeviceIndex = graphicsAllocation ? graphicsAllocation->getRootDeviceIndex() : 0;
 
             bool doAsyncDestructions = debugManager.flags.EnableAsyncDestroyAllocations.get() && !this->memoryProperties.flags.useHostPtr;
-            if (graphicsAllocation && !associatedMemObject && !isHostPtrSVM && graphicsAllocation->peekReuseCount() == 0) {
+            if (graphicsAllocation && allocationReleasable && !associatedMemObject && !isHostPtrSVM && graphicsAllocation->peekReuseCount() == 0) {
                 memoryManager->removeAllocationFromHostPtrManager(graphicsAllocation);
                 if (!doAsyncDestructions) {
                     needWait = true;
@@ -95,7 +97,7 @@ MemObj::~MemObj() {
                 destroyGraphicsAllocation(graphicsAllocation, doAsyncDestructions);
                 graphicsAllocation = nullptr;
             }
-            if (!associatedMemObject) {
+            if (ownsMapStorage) {
                 releaseMapAllocation(rootDeviceIndex, doAsyncDestructions);
             }
             if (mcsAllocation) {
@@ -106,15 +108,17 @@ MemObj::~MemObj() {
         if (associatedMemObject) {
             associatedMemObject->decRefInternal();
             context->getBufferPoolAllocator().tryFreeFromPoolBuffer(associatedMemObject, this->offset, this->sizeInPoolAllocator);
+            context->getImagePoolAllocator().tryFreeFromPoolBuffer(associatedMemObject, this->offset, this->sizeInPoolAllocator);
         }
-        if (!associatedMemObject) {
+        if (ownsMapStorage) {
             releaseAllocatedMapPtr();
         }
     }
 
     destructorCallbacks.invoke(this);
 
-    const bool needDecrementContextRefCount = !context->getBufferPoolAllocator().isPoolBuffer(this);
+    const bool needDecrementContextRefCount = !context->getBufferPoolAllocator().isPoolBuffer(this) &&
+                                              !context->getImagePoolAllocator().isPoolBuffer(this);
     if (needDecrementContextRefCount) {
         context->decRefInternal();
     }
@@ -174,7 +178,7 @@ cl_int MemObj::getMemObjectInfo(cl_mem_info paramName,
     case CL_MEM_OFFSET:
         clOffset = this->getOffset();
         if (nullptr != this->associatedMemObject) {
-            if (this->getContext()->getBufferPoolAllocator().isPoolBuffer(this->associatedMemObject)) {
+            if (this->getContext()->getBufferPoolAllocator().isPoolBuffer(this->associatedMemObject) || isStorageFromImagePool()) {
                 clOffset = 0;
             } else {
                 clOffset -= this->associatedMemObject->getOffset();
@@ -185,7 +189,7 @@ cl_int MemObj::getMemObjectInfo(cl_mem_info paramName,
         break;
 
     case CL_MEM_ASSOCIATED_MEMOBJECT:
-        if (this->getContext()->getBufferPoolAllocator().isPoolBuffer(this->associatedMemObject)) {
+        if (this->getContext()->getBufferPoolAllocator().isPoolBuffer(this->associatedMemObject) || isStorageFromImagePool()) {
             clAssociatedMemObject = nullptr;
         }
         srcParamSize = sizeof(clAssociatedMemObject);
@@ -280,6 +284,10 @@ bool MemObj::isMemObjDisplayable() const {
     return this->isDisplayable;
 }
 
+bool MemObj::isStorageFromImagePool() const {
+    return this->associatedMemObject && context->getImagePoolAllocator().isPoolBuffer(this->associatedMemObject->getAssociatedMemObject());
+}
+
 GraphicsAllocation *MemObj::getGraphicsAllocation(uint32_t rootDeviceIndex) const {
     return multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
 }
@@ -384,7 +392,8 @@ bool MemObj::checkIfMemoryTransferIsRequired(size_t offsetInMemObject, size_t of
 }
 
 void *MemObj::getBasePtrForMap(uint32_t rootDeviceIndex) {
-    if (associatedMemObject) {
+    // pool storage is shared by many images, each of them needs own map storage
+    if (associatedMemObject && !isStorageFromImagePool()) {
         return associatedMemObject->getBasePtrForMap(rootDeviceIndex);
     }
     if (getFlags() & CL_MEM_USE_HOST_PTR) {
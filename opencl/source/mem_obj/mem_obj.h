@@ -104,6 +104,7 @@ class MemObj : public BaseObject<_cl_mem> {
     bool isMemObjUncacheable() const;
     bool isMemObjUncacheableForSurfaceState() const;
     bool isMemObjDisplayable() const;
+    bool isStorageFromImagePool() const;
     virtual void transferDataToHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) { UNRECOVERABLE_IF(true); };
     virtual void transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray &copyOffset) { UNRECOVERABLE_IF(true); };
 
@@ -145,7 +146,7 @@ class MemObj : public BaseObject<_cl_mem> {
         mapAllocations.addAllocation(allocation);
     }
     GraphicsAllocation *getMapAllocation(uint32_t rootDeviceIndex) const {
-        if (associatedMemObject) {
+        if (associatedMemObject && !isStorageFromImagePool()) {
             return associatedMemObject->getMapAllocation(rootDeviceIndex);
         }
         return mapAllocations.getGraphicsAllocation(rootDeviceIndex);
@@ -8,9 +8,12 @@
 #include "printf_handler.h"
 
 #include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/blit_properties.h"
+#include "shared/source/helpers/debug_helpers.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/kernel/implicit_args_helper.h"
@@ -19,6 +22,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/program/print_formatter.h"
+#include "shared/source/utilities/completion_reactor.h"
 
 #include "opencl/source/helpers/dispatch_info.h"
 #include "opencl/source/kernel/kernel.h"
@@ -26,6 +30,42 @@
 
 namespace NEO {
 
+void PendingPrintfOutputs::add() {
+    std::lock_guard<std::mutex> lock(mtx);
+    count++;
+}
+
+void PendingPrintfOutputs::remove() {
+    std::lock_guard<std::mutex> lock(mtx);
+    DEBUG_BREAK_IF(count == 0);
+    if (--count == 0) {
+        outputsPrinted.notify_all();
+    }
+}
+
+uint32_t PendingPrintfOutputs::getCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return count;
+}
+
+WaitStatus PendingPrintfOutputs::waitForAll(CommandStreamReceiver &commandStreamReceiver) {
+    std::unique_lock<std::mutex> lock(mtx);
+    if (count == 0) {
+        return WaitStatus::ready;
+    }
+    // Reactor prints outputs only after its current callback returns, waiting from it would never finish
+    if (commandStreamReceiver.peekExecutionEnvironment().getCompletionReactor()->isReactorThread()) {
+        return WaitStatus::ready;
+    }
+
+    while (!outputsPrinted.wait_for(lock, gpuHangCheckPeriod, [this] { return count == 0; })) {
+        if (commandStreamReceiver.isGpuHangDetected()) {
+            return WaitStatus::gpuHang;
+        }
+    }
+    return WaitStatus::ready;
+}
+
 PrintfHandler::PrintfHandler(Device &deviceArg) : device(deviceArg) {
     printfSurfaceInitialDataSizePtr = std::make_unique<uint32_t>();
     *printfSurfaceInitialDataSizePtr = sizeof(uint32_t);
@@ -62,6 +102,7 @@ void PrintfHandler::prepareDispatch(const MultiDispatchInfo &multiDispatchInfo)
     auto printfPatchAddress = ptrOffset(reinterpret_cast<uintptr_t *>(kernel->getCrossThreadData()), printfSurfaceArg.stateless);
     patchWithRequiredSize(printfPatchAddress, printfSurfaceArg.pointerSize, (uintptr_t)printfSurface->getGpuAddressToPatch());
     if (isValidOffset(printfSurfaceArg.bindful)) {
+        kernel->markSurfaceStateHeapModified();
         auto surfaceState = ptrOffset(reinterpret_cast<uintptr_t *>(kernel->getSurfaceStateHeap()), printfSurfaceArg.bindful);
         void *addressToPatch = printfSurface->getUnderlyingBuffer();
         size_t sizeToPatch = printfSurface->getUnderlyingBufferSize();
@@ -113,4 +154,39 @@ bool PrintfHandler::printEnqueueOutput() {
     return true;
 }
 
+bool PrintfHandler::isAsyncOutputEnabled() {
+    return debugManager.flags.EnableAsyncPrintfOutput.get() == 1;
+}
+
+bool PrintfHandler::isAsyncOutputAllowed() const {
+    if (!isAsyncOutputEnabled() || !printfSurface) {
+        return false;
+    }
+    // Output read back through blitter needs CSR submissions, which are not done from the reactor thread
+    auto &rootDeviceEnvironment = device.getRootDeviceEnvironment();
+    if (CompressionSelector::allowStatelessCompression() || device.getProductHelper().isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *printfSurface)) {
+        return false;
+    }
+    // Without reactor completing the watch on its own, output is printed synchronously at the enqueue
+    return device.getExecutionEnvironment()->getCompletionReactor()->canCompleteWatchesAsync();
+}
+
+void PrintfHandler::printEnqueueOutputAsync(std::unique_ptr<PrintfHandler> &&printfHandler, CommandStreamReceiver &commandStreamReceiver,
+                                            TaskCountType taskCount, const std::shared_ptr<PendingPrintfOutputs> &pendingOutputs) {
+    auto handler = printfHandler.release();
+    handler->kernel->incRefInternal();
+    pendingOutputs->add();
+
+    auto watch = CompletionReactor::createTaskCountWatch(commandStreamReceiver, taskCount);
+    watch.callback = [handler, pendingOutputs](bool gpuHangDetected) {
+        if (!gpuHangDetected) {
+            handler->printEnqueueOutput();
+        }
+        handler->kernel->decRefInternal();
+        delete handler;
+        pendingOutputs->remove();
+    };
+    commandStreamReceiver.peekExecutionEnvironment().getCompletionReactor()->registerWatch(std::move(watch));
+}
+
 } // namespace NEO
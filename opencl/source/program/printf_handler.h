@@ -7,10 +7,16 @@
 
 #pragma once
 
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/command_stream/wait_status.h"
+#include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 
 namespace NEO {
 
@@ -20,6 +26,21 @@ class GraphicsAllocation;
 class Device;
 struct MultiDispatchInfo;
 
+// Outputs of a queue handed over to completion reactor, lets the queue wait until all of them are printed
+class PendingPrintfOutputs : NonCopyableAndNonMovableClass {
+  public:
+    void add();
+    void remove();
+    uint32_t getCount();
+    WaitStatus waitForAll(CommandStreamReceiver &commandStreamReceiver);
+
+  protected:
+    std::mutex mtx;
+    std::condition_variable outputsPrinted;
+    uint32_t count = 0;
+    std::chrono::microseconds gpuHangCheckPeriod{CommonConstants::gpuHangCheckTimeInUS};
+};
+
 class PrintfHandler : NonCopyableAndNonMovableClass {
   public:
     static PrintfHandler *create(const MultiDispatchInfo &multiDispatchInfo, Device &deviceArg);
@@ -30,6 +51,11 @@ class PrintfHandler : NonCopyableAndNonMovableClass {
     void makeResident(CommandStreamReceiver &commandStreamReceiver);
     MOCKABLE_VIRTUAL bool printEnqueueOutput();
 
+    static bool isAsyncOutputEnabled();
+    bool isAsyncOutputAllowed() const;
+    static void printEnqueueOutputAsync(std::unique_ptr<PrintfHandler> &&printfHandler, CommandStreamReceiver &commandStreamReceiver,
+                                        TaskCountType taskCount, const std::shared_ptr<PendingPrintfOutputs> &pendingOutputs);
+
     GraphicsAllocation *getSurface() {
         return printfSurface;
     }
@@ -122,12 +122,18 @@ cl_int Program::linkBinary(Device *pDevice, const void *constantsInitData, size_
     if (linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
         patchedIsaTempStorage.reserve(kernelInfoArray.size());
         kernelDescriptors.reserve(kernelInfoArray.size());
-        for (const auto &kernelInfo : kernelInfoArray) {
+        for (size_t segmentId = 0u; segmentId < kernelInfoArray.size(); segmentId++) {
+            const auto &kernelInfo = kernelInfoArray[segmentId];
             auto &kernHeapInfo = kernelInfo->heapInfo;
-            const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
-            patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.kernelHeapSize));
             DEBUG_BREAK_IF(nullptr == kernelInfo->getGraphicsAllocation());
-            isaSegmentsForPatching.push_back(Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), static_cast<uintptr_t>(kernelInfo->getGraphicsAllocation()->getGpuAddressToPatch()), kernHeapInfo.kernelHeapSize});
+            void *hostPointer = nullptr;
+            if (linkerInput->hasRelocationsInInstructionSegment(segmentId)) {
+                // ISA without relocations was already transferred when creating kernel allocation
+                const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
+                patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.kernelHeapSize));
+                hostPointer = patchedIsaTempStorage.rbegin()->data();
+            }
+            isaSegmentsForPatching.push_back(Linker::PatchableSegment{hostPointer, static_cast<uintptr_t>(kernelInfo->getGraphicsAllocation()->getGpuAddressToPatch()), kernHeapInfo.kernelHeapSize});
             kernelDescriptors.push_back(&kernelInfo->kernelDescriptor);
         }
     }
@@ -149,15 +155,22 @@ cl_int Program::linkBinary(Device *pDevice, const void *constantsInitData, size_
         updateBuildLog(pDevice->getRootDeviceIndex(), error.c_str(), error.size());
         return CL_INVALID_BINARY;
     } else if (linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
+        auto &rootDeviceEnvironment = pDevice->getRootDeviceEnvironment();
+        const auto &productHelper = pDevice->getProductHelper();
+        MemoryTransfers isaTransfers;
         for (auto kernelId = 0u; kernelId < kernelInfoArray.size(); kernelId++) {
             const auto &kernelInfo = kernelInfoArray[kernelId];
             auto &kernHeapInfo = kernelInfo->heapInfo;
             auto segmentId = &kernelInfo - &kernelInfoArray[0];
-            auto &rootDeviceEnvironment = pDevice->getRootDeviceEnvironment();
-            const auto &productHelper = pDevice->getProductHelper();
-            MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelInfo->getGraphicsAllocation()),
-                                                             *pDevice, kernelInfo->getGraphicsAllocation(), 0, isaSegmentsForPatching[segmentId].hostPointer,
-                                                             static_cast<size_t>(kernHeapInfo.kernelHeapSize));
+            if (nullptr == isaSegmentsForPatching[segmentId].hostPointer) {
+                continue;
+            }
+            isaTransfers.push_back({kernelInfo->getGraphicsAllocation(), 0, isaSegmentsForPatching[segmentId].hostPointer,
+                                    static_cast<size_t>(kernHeapInfo.kernelHeapSize),
+                                    productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelInfo->getGraphicsAllocation())});
+        }
+        if (!isaTransfers.empty()) {
+            MemoryTransferHelper::transferMemoryToAllocations(*pDevice, isaTransfers);
         }
     }
     DBG_LOG(PrintRelocations, NEO::constructRelocationsDebugMessage(this->getSymbols(pDevice->getRootDeviceIndex())));
@@ -281,9 +294,10 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
     }
 
     auto svmAllocsManager = context ? context->getSVMAllocsManager() : nullptr;
+    MemoryTransfers initTransfers;
     auto globalConstDataSize = src.globalConstants.size + src.globalConstants.zeroInitSize;
     if (globalConstDataSize != 0) {
-        buildInfos[rootDeviceIndex].constantSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), globalConstDataSize, src.globalConstants.zeroInitSize, true, linkerInput, src.globalConstants.initData);
+        buildInfos[rootDeviceIndex].constantSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), globalConstDataSize, src.globalConstants.zeroInitSize, true, linkerInput, src.globalConstants.initData, &initTransfers);
         if (isBindlessKernelPresent) {
             if (!clDevice.getMemoryManager()->allocateBindlessSlot(buildInfos[rootDeviceIndex].constantSurface)) {
                 return CL_OUT_OF_HOST_MEMORY;
@@ -294,7 +308,7 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
     auto globalVariablesDataSize = src.globalVariables.size + src.globalVariables.zeroInitSize;
     buildInfos[rootDeviceIndex].globalVarTotalSize = globalVariablesDataSize;
     if (globalVariablesDataSize != 0) {
-        buildInfos[rootDeviceIndex].globalSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), globalVariablesDataSize, src.globalVariables.zeroInitSize, false, linkerInput, src.globalVariables.initData);
+        buildInfos[rootDeviceIndex].globalSurface = allocateGlobalsSurface(svmAllocsManager, clDevice.getDevice(), globalVariablesDataSize, src.globalVariables.zeroInitSize, false, linkerInput, src.globalVariables.initData, &initTransfers);
         if (isBindlessKernelPresent) {
             if (!clDevice.getMemoryManager()->allocateBindlessSlot(buildInfos[rootDeviceIndex].globalSurface)) {
                 return CL_OUT_OF_HOST_MEMORY;
@@ -309,7 +323,7 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
     for (auto &kernelInfo : kernelInfoArray) {
         cl_int retVal = CL_SUCCESS;
         if (kernelInfo->heapInfo.kernelHeapSize) {
-            retVal = kernelInfo->createKernelAllocation(clDevice.getDevice(), isBuiltIn) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
+            retVal = kernelInfo->createKernelAllocation(clDevice.getDevice(), isBuiltIn, &initTransfers) ? CL_SUCCESS : CL_OUT_OF_HOST_MEMORY;
         }
 
         if (retVal != CL_SUCCESS) {
@@ -319,6 +333,11 @@ cl_int Program::processProgramInfo(ProgramInfo &src, const ClDevice &clDevice) {
         kernelInfo->apply(deviceInfoConstants);
     }
 
+    // globals and ISA of all kernels are uploaded together, transfers using blitter share a single BCS flush
+    if (!initTransfers.empty() && !MemoryTransferHelper::transferMemoryToAllocations(clDevice.getDevice(), initTransfers)) {
+        return CL_OUT_OF_HOST_MEMORY;
+    }
+
     indirectDetectionVersion = src.indirectDetectionVersion;
 
     return linkBinary(&clDevice.getDevice(), src.globalConstants.initData, src.globalConstants.size, src.globalVariables.initData,
@@ -23,7 +23,7 @@ class GlBuffer : public GlSharing, NEO::NonCopyableAndNonMovableClass {
   public:
     static Buffer *createSharedGlBuffer(Context *context, cl_mem_flags flags, unsigned int bufferId, cl_int *errcodeRet);
     void synchronizeObject(UpdateData &updateData) override;
-    void releaseReusedGraphicsAllocation() override;
+    bool releaseReusedGraphicsAllocation() override;
 
   protected:
     GlBuffer(GLSharingFunctions *sharingFunctions, unsigned int glObjectId)
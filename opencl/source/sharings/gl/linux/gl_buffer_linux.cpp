@@ -167,7 +167,7 @@ void GlBuffer::popGraphicsAllocationFromReuse(GraphicsAllocation *graphicsAlloca
     graphicsAllocation->decReuseCount();
 }
 
-void GlBuffer::releaseReusedGraphicsAllocation() {
+bool GlBuffer::releaseReusedGraphicsAllocation() {
     auto sharingFunctions = static_cast<GLSharingFunctionsLinux *>(this->sharingFunctions);
 
     std::unique_lock<std::mutex> lock(sharingFunctions->mutex);
@@ -180,10 +180,12 @@ void GlBuffer::releaseReusedGraphicsAllocation() {
             if (it->second->peekReuseCount() == 0) {
                 std::iter_swap(it, itEnd - 1);
                 allocationsVector.pop_back();
+                return true;
             }
-            break;
+            return false;
         }
     }
+    return true;
 }
 
 GraphicsAllocation *GlBuffer::createGraphicsAllocation(Context *context, unsigned int bufferId, _tagCLGLBufferInfo &bufferInfo) {
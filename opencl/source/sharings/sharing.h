@@ -42,7 +42,8 @@ class SharingHandler {
     virtual ~SharingHandler() = default;
 
     virtual void getMemObjectInfo(size_t &paramValueSize, void *&paramValue){};
-    virtual void releaseReusedGraphicsAllocation(){};
+    // Returns true if the memory object may destroy its allocation, decision is made under the same lock as the release
+    virtual bool releaseReusedGraphicsAllocation() { return true; };
 
   protected:
     virtual int synchronizeHandler(UpdateData &updateData);
@@ -16,6 +16,7 @@ typedef VAStatus (*VADestroyImagePFN)(VADisplay vaDisplay, VAImageID vaImageId);
 typedef VAStatus (*VAExtGetSurfaceHandlePFN)(VADisplay vaDisplay, VASurfaceID *vaSurface, unsigned int *handleId);
 typedef VAStatus (*VAExportSurfaceHandlePFN)(VADisplay vaDisplay, VASurfaceID vaSurface, uint32_t memType, uint32_t flags, void *descriptor);
 typedef VAStatus (*VASyncSurfacePFN)(VADisplay vaDisplay, VASurfaceID vaSurface);
+typedef VAStatus (*VAQuerySurfaceStatusPFN)(VADisplay vaDisplay, VASurfaceID vaSurface, VASurfaceStatus *status);
 typedef void *(*VAGetLibFuncPFN)(VADisplay vaDisplay, const char *func);
 typedef VAStatus (*VAQueryImageFormatsPFN)(VADisplay vaDisplay, VAImageFormat *formatList, int *numFormats);
 typedef int (*VAMaxNumImageFormatsPFN)(VADisplay vaDisplay);
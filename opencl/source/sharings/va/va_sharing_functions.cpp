@@ -8,9 +8,12 @@
 #include "va_sharing_functions.h"
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
 
 #include "opencl/source/sharings/va/va_surface.h"
 
+#include <algorithm>
 #include <dlfcn.h>
 
 namespace Os {
@@ -27,6 +30,7 @@ VASharingFunctions::VASharingFunctions(VADisplay vaDisplay) : vaDisplay(vaDispla
 };
 
 VASharingFunctions::~VASharingFunctions() {
+    releaseImportedSurfaces();
     if (libHandle != nullptr) {
         fdlclose(libHandle);
         libHandle = nullptr;
@@ -55,6 +59,7 @@ void VASharingFunctions::initFunctions() {
             vaDeriveImagePFN = reinterpret_cast<VADeriveImagePFN>(fdlsym(libHandle, "vaDeriveImage"));
             vaDestroyImagePFN = reinterpret_cast<VADestroyImagePFN>(fdlsym(libHandle, "vaDestroyImage"));
             vaSyncSurfacePFN = reinterpret_cast<VASyncSurfacePFN>(fdlsym(libHandle, "vaSyncSurface"));
+            vaQuerySurfaceStatusPFN = reinterpret_cast<VAQuerySurfaceStatusPFN>(fdlsym(libHandle, "vaQuerySurfaceStatus"));
             vaGetLibFuncPFN = reinterpret_cast<VAGetLibFuncPFN>(fdlsym(libHandle, "vaGetLibFunc"));
             vaExtGetSurfaceHandlePFN = reinterpret_cast<VAExtGetSurfaceHandlePFN>(getLibFunc("DdiMedia_ExtGetSurfaceHandle"));
             vaExportSurfaceHandlePFN = reinterpret_cast<VAExportSurfaceHandlePFN>(fdlsym(libHandle, "vaExportSurfaceHandle"));
@@ -66,6 +71,7 @@ void VASharingFunctions::initFunctions() {
             vaDeriveImagePFN = nullptr;
             vaDestroyImagePFN = nullptr;
             vaSyncSurfacePFN = nullptr;
+            vaQuerySurfaceStatusPFN = nullptr;
             vaGetLibFuncPFN = nullptr;
             vaExtGetSurfaceHandlePFN = nullptr;
             vaExportSurfaceHandlePFN = nullptr;
@@ -135,4 +141,65 @@ cl_int VASharingFunctions::getSupportedFormats(cl_mem_flags flags,
 
     return CL_SUCCESS;
 }
+uint32_t VASharingFunctions::getImportedSurfacesCacheSize() {
+    auto cacheSize = debugManager.flags.VaSurfaceImportCacheSize.get();
+    return cacheSize > 0 ? static_cast<uint32_t>(cacheSize) : 0u;
+}
+
+GraphicsAllocation *VASharingFunctions::findImportedSurface(const VASurfaceImportKey &key, ImageInfo &imgInfo) {
+    releaseDestroyedImportedSurfaces();
+
+    auto it = std::find_if(importedSurfaces.begin(), importedSurfaces.end(), [&key](const auto &importedSurface) { return importedSurface.key == key; });
+    if (it == importedSurfaces.end()) {
+        return nullptr;
+    }
+    std::rotate(it, it + 1, importedSurfaces.end());
+    auto &importedSurface = importedSurfaces.back();
+
+    auto surfaceFormat = imgInfo.surfaceFormat;
+    imgInfo = importedSurface.imgInfo;
+    imgInfo.surfaceFormat = surfaceFormat;
+    return importedSurface.allocation;
+}
+
+void VASharingFunctions::storeImportedSurface(const VASurfaceImportKey &key, VASurfaceID surfaceId, GraphicsAllocation *allocation, const ImageInfo &imgInfo, MemoryManager *memoryManager) {
+    auto cacheSize = getImportedSurfacesCacheSize();
+    if (cacheSize == 0u) {
+        return;
+    }
+    while (importedSurfaces.size() >= cacheSize) {
+        releaseImportedSurface(importedSurfaces.front());
+        importedSurfaces.erase(importedSurfaces.begin());
+    }
+    allocation->incReuseCount();
+    importedSurfaces.push_back({key, surfaceId, allocation, imgInfo, memoryManager});
+}
+
+void VASharingFunctions::releaseDestroyedImportedSurfaces() {
+    // Imported allocation keeps memory of destroyed VA surface alive, so it is dropped as soon as destruction is noticed
+    auto destroyedSurfacesBegin = std::stable_partition(importedSurfaces.begin(), importedSurfaces.end(), [this](const ImportedSurface &importedSurface) {
+        VASurfaceStatus status{};
+        return querySurfaceStatus(importedSurface.surfaceId, &status) != VA_STATUS_ERROR_INVALID_SURFACE;
+    });
+    for (auto it = destroyedSurfacesBegin; it != importedSurfaces.end(); ++it) {
+        releaseImportedSurface(*it);
+    }
+    importedSurfaces.erase(destroyedSurfacesBegin, importedSurfaces.end());
+}
+
+void VASharingFunctions::releaseImportedSurfaces() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (auto &importedSurface : importedSurfaces) {
+        releaseImportedSurface(importedSurface);
+    }
+    importedSurfaces.clear();
+}
+
+void VASharingFunctions::releaseImportedSurface(const ImportedSurface &importedSurface) {
+    importedSurface.allocation->decReuseCount();
+    if (importedSurface.allocation->peekReuseCount() == 0u) {
+        importedSurface.memoryManager->checkGpuUsageAndDestroyGraphicsAllocations(importedSurface.allocation);
+    }
+}
+
 } // namespace NEO
@@ -6,6 +6,8 @@
  */
 
 #pragma once
+#include "shared/source/helpers/surface_format_info.h"
+
 #include "opencl/source/sharings/sharing.h"
 #include "opencl/source/sharings/va/va_sharing_defines.h"
 
@@ -14,6 +16,17 @@
 #include <vector>
 
 namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+
+struct VASurfaceImportKey {
+    uint64_t device = 0;
+    uint64_t inode = 0;
+    uint32_t plane = 0;
+    uint32_t fourcc = 0;
+
+    bool operator==(const VASurfaceImportKey &other) const = default;
+};
 
 class VASharingFunctions : public SharingFunctions {
   public:
@@ -49,6 +62,13 @@ class VASharingFunctions : public SharingFunctions {
         return vaSyncSurfacePFN(vaDisplay, vaSurface);
     }
 
+    MOCKABLE_VIRTUAL VAStatus querySurfaceStatus(VASurfaceID vaSurface, VASurfaceStatus *status) {
+        if (vaQuerySurfaceStatusPFN == nullptr) {
+            return VA_STATUS_ERROR_UNIMPLEMENTED;
+        }
+        return vaQuerySurfaceStatusPFN(vaDisplay, vaSurface, status);
+    }
+
     MOCKABLE_VIRTUAL VAStatus queryImageFormats(VADisplay vaDisplay, VAImageFormat *formatList, int *numFormats) {
         return vaQueryImageFormatsPFN(vaDisplay, formatList, numFormats);
     }
@@ -83,15 +103,32 @@ class VASharingFunctions : public SharingFunctions {
 
     static bool isVaLibraryAvailable();
 
+    static uint32_t getImportedSurfacesCacheSize();
+    GraphicsAllocation *findImportedSurface(const VASurfaceImportKey &key, ImageInfo &imgInfo);
+    void storeImportedSurface(const VASurfaceImportKey &key, VASurfaceID surfaceId, GraphicsAllocation *allocation, const ImageInfo &imgInfo, MemoryManager *memoryManager);
+    void releaseImportedSurfaces();
+
     std::mutex mutex;
 
   protected:
+    struct ImportedSurface {
+        VASurfaceImportKey key;
+        VASurfaceID surfaceId = VA_INVALID_ID;
+        GraphicsAllocation *allocation = nullptr;
+        ImageInfo imgInfo = {};
+        MemoryManager *memoryManager = nullptr;
+    };
+
+    void releaseImportedSurface(const ImportedSurface &importedSurface);
+    void releaseDestroyedImportedSurfaces();
+
     void *libHandle = nullptr;
     VADisplay vaDisplay = nullptr;
     VADisplayIsValidPFN vaDisplayIsValidPFN = [](VADisplay vaDisplay) { return 0; };
     VADeriveImagePFN vaDeriveImagePFN;
     VADestroyImagePFN vaDestroyImagePFN;
     VASyncSurfacePFN vaSyncSurfacePFN;
+    VAQuerySurfaceStatusPFN vaQuerySurfaceStatusPFN = nullptr;
     VAExtGetSurfaceHandlePFN vaExtGetSurfaceHandlePFN;
     VAExportSurfaceHandlePFN vaExportSurfaceHandlePFN;
     VAGetLibFuncPFN vaGetLibFuncPFN;
@@ -101,5 +138,8 @@ class VASharingFunctions : public SharingFunctions {
     std::vector<VAImageFormat> supportedPackedFormats;
     std::vector<VAImageFormat> supported2PlaneFormats;
     std::vector<VAImageFormat> supported3PlaneFormats;
+
+    // Least recently used imported surface is at front, each one holds reuse count of its allocation
+    std::vector<ImportedSurface> importedSurfaces;
 };
 } // namespace NEO
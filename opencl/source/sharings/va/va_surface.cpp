@@ -10,8 +10,10 @@
 #include "shared/source/helpers/get_info.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/os_interface/linux/i915.h"
+#include "shared/source/os_interface/linux/sys_calls.h"
 
 #include "opencl/source/cl_device/cl_device.h"
 #include "opencl/source/context/context.h"
@@ -19,6 +21,7 @@
 
 #include "drm_fourcc.h"
 
+#include <sys/stat.h>
 #include <va/va_drmcommon.h>
 
 namespace NEO {
@@ -203,15 +206,31 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
         return nullptr;
     }
 
-    AllocationProperties properties(context->getDevice(0)->getRootDeviceIndex(),
-                                    false, // allocateMemory
-                                    &sharedSurfaceInfo.imgInfo, AllocationType::sharedImage,
-                                    context->getDeviceBitfieldForAllocation(context->getDevice(0)->getRootDeviceIndex()));
+    VASurfaceImportKey importKey{};
+    bool importReusable = getSurfaceImportKey(sharedSurfaceInfo, importKey);
+    GraphicsAllocation *alloc = importReusable ? sharingFunctions->findImportedSurface(importKey, sharedSurfaceInfo.imgInfo) : nullptr;
 
-    MemoryManager::OsHandleData osHandleData{sharedSurfaceInfo.sharedHandle};
-    auto alloc = memoryManager->createGraphicsAllocationFromSharedHandle(osHandleData, properties, false, false, true, nullptr);
+    if (alloc) {
+        SysCalls::close(static_cast<int>(sharedSurfaceInfo.sharedHandle));
+    } else {
+        AllocationProperties properties(context->getDevice(0)->getRootDeviceIndex(),
+                                        false, // allocateMemory
+                                        &sharedSurfaceInfo.imgInfo, AllocationType::sharedImage,
+                                        context->getDeviceBitfieldForAllocation(context->getDevice(0)->getRootDeviceIndex()));
+
+        MemoryManager::OsHandleData osHandleData{sharedSurfaceInfo.sharedHandle};
+        alloc = memoryManager->createGraphicsAllocationFromSharedHandle(osHandleData, properties, false, false, true, nullptr);
+
+        memoryManager->closeSharedHandle(alloc);
 
-    memoryManager->closeSharedHandle(alloc);
+        if (alloc && importReusable) {
+            sharingFunctions->storeImportedSurface(importKey, *surface, alloc, sharedSurfaceInfo.imgInfo, memoryManager);
+        }
+    }
+    importReusable &= (alloc != nullptr);
+    if (importReusable) {
+        alloc->incReuseCount(); // decremented in releaseReusedGraphicsAllocation() called from MemObj destructor
+    }
 
     if (VASurface::isSupportedPlanarFormat(sharedSurfaceInfo.imageFourcc)) {
         applyPlaneSettings(sharedSurfaceInfo, plane);
@@ -229,6 +248,9 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
     sharedSurfaceInfo.imgInfo.imgDesc.imageRowPitch = sharedSurfaceInfo.imgInfo.rowPitch;
 
     auto vaSurface = new VASurface(sharingFunctions, sharedSurfaceInfo.imageId, plane, surface, context->getInteropUserSyncEnabled());
+    if (importReusable) {
+        vaSurface->reusedAllocation = alloc;
+    }
     auto multiGraphicsAllocation = MultiGraphicsAllocation(context->getDevice(0)->getRootDeviceIndex());
     multiGraphicsAllocation.addAllocation(alloc);
 
@@ -237,6 +259,31 @@ Image *VASurface::createSharedVaSurface(Context *context, VASharingFunctions *sh
     return image;
 }
 
+bool VASurface::getSurfaceImportKey(const SharedSurfaceInfo &sharedSurfaceInfo, VASurfaceImportKey &importKey) {
+    // Only dma-buf handles exported by VA are identified by their inode, flink names from derived images are not cached
+    if (VASharingFunctions::getImportedSurfacesCacheSize() == 0u || sharedSurfaceInfo.imageId != VA_INVALID_ID) {
+        return false;
+    }
+    struct stat fileStat = {};
+    if (SysCalls::fstat(static_cast<int>(sharedSurfaceInfo.sharedHandle), &fileStat) != 0 || fileStat.st_ino == 0) {
+        return false;
+    }
+    importKey.device = static_cast<uint64_t>(fileStat.st_dev);
+    importKey.inode = static_cast<uint64_t>(fileStat.st_ino);
+    importKey.plane = sharedSurfaceInfo.plane;
+    importKey.fourcc = sharedSurfaceInfo.imageFourcc;
+    return true;
+}
+
+bool VASurface::releaseReusedGraphicsAllocation() {
+    if (!reusedAllocation) {
+        return true;
+    }
+    std::unique_lock<std::mutex> lock(sharingFunctions->mutex);
+    reusedAllocation->decReuseCount();
+    return reusedAllocation->peekReuseCount() == 0;
+}
+
 void VASurface::synchronizeObject(UpdateData &updateData) {
     updateData.synchronizationStatus = SynchronizeStatus::ACQUIRE_SUCCESFUL;
     if (!interopUserSync) {
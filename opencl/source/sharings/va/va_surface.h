@@ -48,6 +48,9 @@ class VASurface : VASharing {
     static void applyPlanarOptions(SharedSurfaceInfo &sharedSurfaceInfo, cl_uint plane, cl_mem_flags flags, bool supportOcl21);
     static void applyPackedOptions(SharedSurfaceInfo &sharedSurfaceInfo);
     static void applyPlaneSettings(SharedSurfaceInfo &sharedSurfaceInfo, cl_uint plane);
+    static bool getSurfaceImportKey(const SharedSurfaceInfo &sharedSurfaceInfo, VASurfaceImportKey &importKey);
+
+    bool releaseReusedGraphicsAllocation() override;
 
   protected:
     VASurface(VASharingFunctions *sharingFunctions, VAImageID imageId,
@@ -59,6 +62,7 @@ class VASurface : VASharing {
     cl_uint plane;
     VASurfaceID surfaceId;
     VASurfaceID *surfaceIdPtr;
+    GraphicsAllocation *reusedAllocation = nullptr;
     bool interopUserSync;
 };
 } // namespace NEO
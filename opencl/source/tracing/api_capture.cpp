@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/api_capture.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/io_functions.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <iterator>
+
+namespace HostSideTracing {
+
+namespace {
+struct ThreadRingCache {
+    ~ThreadRingCache() {
+        if (ring) {
+            ring->markThreadExited();
+        }
+    }
+
+    uint64_t captureId = 0;
+    std::shared_ptr<ApiCaptureRing> ring;
+};
+
+std::atomic<uint64_t> nextCaptureId{1};
+thread_local ThreadRingCache threadRingCache;
+} // namespace
+
+bool ApiCaptureRing::push(const void *data, size_t size) {
+    const auto capacity = storage.size();
+    const auto currentTail = tail.load(std::memory_order_relaxed);
+    if (capacity - (currentTail - head.load(std::memory_order_acquire)) < size) {
+        return false;
+    }
+
+    const auto offset = currentTail % capacity;
+    const auto firstPartSize = std::min(size, capacity - offset);
+    memcpy(&storage[offset], data, firstPartSize);
+    memcpy(storage.data(), ptrOffset(data, firstPartSize), size - firstPartSize);
+    tail.store(currentTail + size, std::memory_order_release);
+    return true;
+}
+
+void ApiCaptureRing::drain(std::vector<uint8_t> &output) {
+    const auto capacity = storage.size();
+    const auto currentHead = head.load(std::memory_order_relaxed);
+    const auto currentTail = tail.load(std::memory_order_acquire);
+    const auto size = currentTail - currentHead;
+
+    const auto offset = currentHead % capacity;
+    const auto firstPartSize = std::min(size, capacity - offset);
+    output.insert(output.end(), storage.begin() + offset, storage.begin() + offset + firstPartSize);
+    output.insert(output.end(), storage.begin(), storage.begin() + (size - firstPartSize));
+    head.store(currentTail, std::memory_order_release);
+}
+
+ApiCapture::ApiCapture(const std::string &fileName, size_t ringCapacity) : fileName(fileName), ringCapacity(ringCapacity), captureId(nextCaptureId++) {}
+
+ApiCapture::~ApiCapture() {
+    flush();
+    if (captureFile) {
+        NEO::IoFunctions::fclosePtr(captureFile);
+        captureFile = nullptr;
+    }
+}
+
+ApiCapture *ApiCapture::get() {
+    static std::unique_ptr<ApiCapture> apiCapture = []() -> std::unique_ptr<ApiCapture> {
+        if (NEO::debugManager.flags.EnableApiCapture.get() != 1) {
+            return nullptr;
+        }
+        auto captureFileName = NEO::debugManager.flags.ApiCaptureFile.get();
+        if (captureFileName == "unk") {
+            captureFileName = defaultFileName;
+        }
+        return std::make_unique<ApiCapture>(captureFileName, defaultRingCapacity);
+    }();
+    return apiCapture.get();
+}
+
+uint64_t ApiCapture::getTimestampNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+uint32_t ApiCapture::registerFunction(const char *name) {
+    std::string functionName = name;
+    if (!functionName.empty()) {
+        functionName[0] = static_cast<char>(std::tolower(functionName[0]));
+    }
+
+    uint32_t functionId = 0;
+    {
+        std::lock_guard<std::mutex> lock(functionsMtx);
+        functionId = static_cast<uint32_t>(functionNames.size());
+        functionNames.push_back(functionName);
+    }
+
+    // written directly, call records using this id are still pending in rings
+    ApiCaptureFunctionNameHeader header{};
+    header.functionId = functionId;
+    header.nameLength = static_cast<uint32_t>(functionName.size());
+    std::lock_guard<std::mutex> lock(fileMtx);
+    writeToFile(&header, sizeof(header));
+    writeToFile(functionName.c_str(), functionName.size());
+    return functionId;
+}
+
+uint32_t ApiCapture::getThreadId() {
+    return getThreadRing().getThreadId();
+}
+
+ApiCaptureRing &ApiCapture::getThreadRing() {
+    if (threadRingCache.captureId != captureId) {
+        if (hasExitedThreadRings()) {
+            drainRings();
+        }
+        if (threadRingCache.ring) {
+            threadRingCache.ring->markThreadExited();
+        }
+
+        std::lock_guard<std::mutex> lock(ringsMtx);
+        rings.push_back(std::make_shared<ApiCaptureRing>(nextThreadId++, ringCapacity));
+        threadRingCache.captureId = captureId;
+        threadRingCache.ring = rings.back();
+    }
+    return *threadRingCache.ring;
+}
+
+bool ApiCapture::hasExitedThreadRings() {
+    std::lock_guard<std::mutex> lock(ringsMtx);
+    return std::any_of(rings.begin(), rings.end(), [](const auto &ring) { return ring->isThreadExited(); });
+}
+
+void ApiCapture::submit(const void *record, size_t size) {
+    auto &ring = getThreadRing();
+    if (size > ring.getCapacity()) {
+        // earlier records of this thread are drained first to keep them in order
+        drainRings();
+        std::lock_guard<std::mutex> lock(fileMtx);
+        writeToFile(record, size);
+        return;
+    }
+    while (!ring.push(record, size)) {
+        drainRings();
+    }
+    if (ring.getUsedSize() >= ring.getCapacity() / 2) {
+        drainRings();
+    }
+}
+
+void ApiCapture::flush() {
+    drainRings();
+    std::lock_guard<std::mutex> lock(fileMtx);
+    if (captureFile) {
+        NEO::IoFunctions::fflushPtr(captureFile);
+    }
+}
+
+void ApiCapture::drainRings() {
+    std::vector<std::shared_ptr<ApiCaptureRing>> ringsToDrain;
+    std::vector<std::shared_ptr<ApiCaptureRing>> exitedThreadRings;
+    {
+        std::lock_guard<std::mutex> lock(ringsMtx);
+        // exited threads no longer push, their rings are released once drained below
+        auto exitedThreadRingsBegin = std::stable_partition(rings.begin(), rings.end(), [](const auto &ring) { return !ring->isThreadExited(); });
+        std::move(exitedThreadRingsBegin, rings.end(), std::back_inserter(exitedThreadRings));
+        rings.erase(exitedThreadRingsBegin, rings.end());
+        ringsToDrain = rings;
+    }
+
+    std::lock_guard<std::mutex> lock(fileMtx);
+    for (auto &ring : ringsToDrain) {
+        ring->drain(drainBuffer);
+    }
+    for (auto &ring : exitedThreadRings) {
+        ring->drain(drainBuffer);
+    }
+    if (!drainBuffer.empty()) {
+        writeToFile(drainBuffer.data(), drainBuffer.size());
+        drainBuffer.clear();
+    }
+}
+
+void captureFunctionPayload(ApiCaptureCall &call, ClCreateCommandQueueWithPropertiesTracer *, cl_context *context, cl_device_id *device, const cl_queue_properties **properties, cl_int **errcodeRet) {
+    if (*properties) {
+        size_t propertiesCount = 0;
+        while ((*properties)[propertiesCount] != 0) {
+            propertiesCount += 2;
+        }
+        call.appendPayload(ApiCapturePayloadType::queueProperties, *properties, (propertiesCount + 1) * sizeof(cl_queue_properties));
+    }
+}
+
+void captureFunctionPayload(ApiCaptureCall &call, ClCreateProgramWithSourceTracer *, cl_context *context, cl_uint *count, const char ***strings, const size_t **lengths, cl_int **errcodeRet) {
+    if (!*strings) {
+        return;
+    }
+    std::string source;
+    for (cl_uint i = 0; i < *count; i++) {
+        if ((*strings)[i]) {
+            auto length = (*lengths && (*lengths)[i] > 0) ? (*lengths)[i] : strlen((*strings)[i]);
+            source.append((*strings)[i], length);
+        }
+    }
+    call.appendPayload(ApiCapturePayloadType::programSource, source.c_str(), source.size());
+}
+
+void captureFunctionPayload(ApiCaptureCall &call, ClEnqueueFillBufferTracer *, cl_command_queue *commandQueue, cl_mem *buffer, const void **pattern, size_t *patternSize, size_t *offset, size_t *size,
+                            cl_uint *numEventsInWaitList, const cl_event **eventWaitList, cl_event **event) {
+    // valid patterns are at most 128 bytes, larger sizes are rejected by the call itself
+    if (*pattern && *patternSize <= 128u) {
+        call.appendPayload(ApiCapturePayloadType::fillPattern, *pattern, *patternSize);
+    }
+}
+
+void captureFunctionPayload(ApiCaptureCall &call, ClEnqueueNdRangeKernelTracer *, cl_command_queue *commandQueue, cl_kernel *kernel, cl_uint *workDim, const size_t **globalWorkOffset,
+                            const size_t **globalWorkSize, const size_t **localWorkSize, cl_uint *numEventsInWaitList, const cl_event **eventWaitList, cl_event **event) {
+    auto workSizesSize = std::min(*workDim, 3u) * sizeof(size_t);
+    if (*globalWorkOffset) {
+        call.appendPayload(ApiCapturePayloadType::workOffset, *globalWorkOffset, workSizesSize);
+    }
+    if (*globalWorkSize) {
+        call.appendPayload(ApiCapturePayloadType::globalWorkSize, *globalWorkSize, workSizesSize);
+    }
+    if (*localWorkSize) {
+        call.appendPayload(ApiCapturePayloadType::localWorkSize, *localWorkSize, workSizesSize);
+    }
+}
+
+void captureFunctionPayload(ApiCaptureCall &call, ClSetKernelArgTracer *, cl_kernel *kernel, cl_uint *argIndex, size_t *argSize, const void **argValue) {
+    if (*argValue) {
+        call.appendPayload(ApiCapturePayloadType::kernelArgValue, *argValue, *argSize);
+    }
+}
+
+void ApiCapture::writeToFile(const void *data, size_t size) {
+    if (!captureFile && !fileOpenFailed) {
+        captureFile = NEO::IoFunctions::fopenPtr(fileName.c_str(), "wb");
+        fileOpenFailed = (captureFile == nullptr);
+        if (captureFile) {
+            uint32_t header[] = {fileMagic, fileVersion};
+            NEO::IoFunctions::fwritePtr(header, 1, sizeof(header), captureFile);
+        }
+    }
+    if (captureFile) {
+        NEO::IoFunctions::fwritePtr(data, 1, size, captureFile);
+    }
+}
+
+} // namespace HostSideTracing
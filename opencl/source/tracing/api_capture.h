@@ -0,0 +1,277 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include "opencl/source/tracing/api_capture_log.h"
+
+#include "CL/cl.h"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace HostSideTracing {
+
+// Single producer ring of serialized records, owning thread appends without taking locks.
+// Draining is serialized by ApiCapture.
+class ApiCaptureRing : NEO::NonCopyableAndNonMovableClass {
+  public:
+    ApiCaptureRing(uint32_t threadId, size_t capacity) : storage(capacity), threadId(threadId) {}
+
+    bool push(const void *data, size_t size);
+    void drain(std::vector<uint8_t> &output);
+
+    size_t getUsedSize() const {
+        return tail.load(std::memory_order_acquire) - head.load(std::memory_order_acquire);
+    }
+    size_t getCapacity() const {
+        return storage.size();
+    }
+    uint32_t getThreadId() const {
+        return threadId;
+    }
+    void markThreadExited() {
+        threadExited.store(true, std::memory_order_release);
+    }
+    bool isThreadExited() const {
+        return threadExited.load(std::memory_order_acquire);
+    }
+
+  protected:
+    std::vector<uint8_t> storage;
+    std::atomic<size_t> head{0};
+    std::atomic<size_t> tail{0};
+    std::atomic<bool> threadExited{false};
+    uint32_t threadId;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<ApiCaptureRing>);
+
+// Writes every traced API call with its argument values, return value and enter and exit timestamps to a binary log.
+class ApiCapture : NEO::NonCopyableAndNonMovableClass {
+  public:
+    static constexpr const char *defaultFileName = "api_capture.bin";
+    static constexpr uint32_t fileMagic = apiCaptureFileMagic;
+    static constexpr uint32_t fileVersion = apiCaptureFileVersion;
+    static constexpr size_t defaultRingCapacity = 256 * 1024;
+
+    ApiCapture(const std::string &fileName, size_t ringCapacity);
+    MOCKABLE_VIRTUAL ~ApiCapture();
+
+    static ApiCapture *get();
+    static uint64_t getTimestampNs();
+
+    uint32_t registerFunction(const char *name);
+    uint32_t getThreadId();
+    void submit(const void *record, size_t size);
+    void flush();
+
+  protected:
+    ApiCaptureRing &getThreadRing();
+    bool hasExitedThreadRings();
+    void drainRings();
+    MOCKABLE_VIRTUAL void writeToFile(const void *data, size_t size);
+
+    std::string fileName;
+    size_t ringCapacity;
+    uint64_t captureId;
+
+    // Ring is shared with its thread, which marks it on exit so it can be drained and released
+    std::mutex ringsMtx;
+    std::vector<std::shared_ptr<ApiCaptureRing>> rings;
+    uint32_t nextThreadId = 0;
+
+    std::mutex fileMtx;
+    FILE *captureFile = nullptr;
+    bool fileOpenFailed = false;
+    std::vector<uint8_t> drainBuffer;
+
+    std::mutex functionsMtx;
+    std::vector<std::string> functionNames;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<ApiCapture>);
+
+inline thread_local bool apiCaptureInProgress = false;
+
+class ApiCaptureCall;
+class ClCreateCommandQueueWithPropertiesTracer;
+class ClCreateProgramWithSourceTracer;
+class ClEnqueueFillBufferTracer;
+class ClEnqueueNdRangeKernelTracer;
+class ClSetKernelArgTracer;
+
+// Captures data referenced by pointer arguments of the function traced by Tracer.
+template <typename Tracer, typename... Args>
+void captureFunctionPayload(ApiCaptureCall &call, Tracer *, Args *...args) {}
+
+void captureFunctionPayload(ApiCaptureCall &call, ClCreateCommandQueueWithPropertiesTracer *, cl_context *context, cl_device_id *device, const cl_queue_properties **properties, cl_int **errcodeRet);
+void captureFunctionPayload(ApiCaptureCall &call, ClCreateProgramWithSourceTracer *, cl_context *context, cl_uint *count, const char ***strings, const size_t **lengths, cl_int **errcodeRet);
+void captureFunctionPayload(ApiCaptureCall &call, ClEnqueueFillBufferTracer *, cl_command_queue *commandQueue, cl_mem *buffer, const void **pattern, size_t *patternSize, size_t *offset, size_t *size,
+                            cl_uint *numEventsInWaitList, const cl_event **eventWaitList, cl_event **event);
+void captureFunctionPayload(ApiCaptureCall &call, ClEnqueueNdRangeKernelTracer *, cl_command_queue *commandQueue, cl_kernel *kernel, cl_uint *workDim, const size_t **globalWorkOffset,
+                            const size_t **globalWorkSize, const size_t **localWorkSize, cl_uint *numEventsInWaitList, const cl_event **eventWaitList, cl_event **event);
+void captureFunctionPayload(ApiCaptureCall &call, ClSetKernelArgTracer *, cl_kernel *kernel, cl_uint *argIndex, size_t *argSize, const void **argValue);
+
+// Serializes one API call, created by TRACING_ENTER and submitted by TRACING_EXIT.
+// Records longer than maxRecordSize move to heap storage, values past maxExtendedRecordSize
+// are dropped and the record is marked as truncated.
+class ApiCaptureCall : NEO::NonCopyableAndNonMovableClass {
+  public:
+    static constexpr size_t maxRecordSize = 512;
+    static constexpr size_t maxExtendedRecordSize = 64 * 1024;
+    static constexpr size_t maxStringLength = 4096;
+
+    void setup(ApiCapture *apiCapture, uint32_t functionId) {
+        if (apiCaptureInProgress) {
+            return;
+        }
+        apiCaptureInProgress = true;
+        capture = apiCapture;
+        header.functionId = functionId;
+        recordSize = sizeof(ApiCaptureCallHeader);
+    }
+
+    template <typename Tracer = void, typename... Args>
+    void enter(Args *...args) {
+        if (!capture) {
+            return;
+        }
+        (appendValue(args), ...);
+        header.argumentsSize = static_cast<uint16_t>(recordSize - sizeof(ApiCaptureCallHeader));
+
+        payloadOffset = recordSize;
+        if (stringArgument) {
+            appendPayload(ApiCapturePayloadType::string, stringArgument, strnlen(stringArgument, maxStringLength));
+        }
+        if (eventWaitList && eventWaitListCount > 0) {
+            appendPayload(ApiCapturePayloadType::eventWaitList, eventWaitList, eventWaitListCount * sizeof(cl_event));
+        }
+        captureFunctionPayload(*this, static_cast<Tracer *>(nullptr), args...);
+        header.enterNs = ApiCapture::getTimestampNs();
+    }
+
+    template <typename T>
+    void exit(T *returnValue) {
+        if (!capture) {
+            return;
+        }
+        header.exitNs = ApiCapture::getTimestampNs();
+        if constexpr (std::is_same_v<T, cl_int>) {
+            if (outputEvent && *returnValue == CL_SUCCESS) {
+                appendPayload(ApiCapturePayloadType::outputEvent, outputEvent, sizeof(cl_event));
+            }
+        }
+        header.payloadSize = static_cast<uint32_t>(recordSize - payloadOffset);
+        auto returnValueOffset = recordSize;
+        appendValue(returnValue);
+        header.returnValueSize = static_cast<uint16_t>(recordSize - returnValueOffset);
+        submit();
+    }
+
+    void exit(std::nullptr_t) {
+        if (!capture) {
+            return;
+        }
+        header.exitNs = ApiCapture::getTimestampNs();
+        header.payloadSize = static_cast<uint32_t>(recordSize - payloadOffset);
+        submit();
+    }
+
+    void appendPayload(ApiCapturePayloadType type, const void *data, size_t size) {
+        auto payloadSize = static_cast<uint32_t>(size);
+        auto destination = reserve(sizeof(type) + sizeof(payloadSize) + size);
+        if (!destination) {
+            return;
+        }
+        memcpy(destination, &type, sizeof(type));
+        memcpy(destination + sizeof(type), &payloadSize, sizeof(payloadSize));
+        memcpy(destination + sizeof(type) + sizeof(payloadSize), data, size);
+    }
+
+  protected:
+    template <typename T>
+    void appendValue(T *value) {
+        using ValueT = std::remove_cv_t<T>;
+        static_assert(std::is_trivially_copyable_v<ValueT> && sizeof(ValueT) <= UINT8_MAX);
+
+        // wait lists follow their count, created events are read back when the call returns
+        if constexpr (std::is_same_v<ValueT, cl_uint>) {
+            eventWaitListCount = *value;
+        } else if constexpr (std::is_same_v<ValueT, const cl_event *>) {
+            eventWaitList = *value;
+        } else if constexpr (std::is_same_v<ValueT, cl_event *>) {
+            outputEvent = *value;
+        } else if constexpr (std::is_same_v<ValueT, const char *>) {
+            stringArgument = *value;
+        }
+
+        auto destination = reserve(1 + sizeof(ValueT));
+        if (!destination) {
+            return;
+        }
+        destination[0] = static_cast<uint8_t>(sizeof(ValueT));
+        memcpy(destination + 1, value, sizeof(ValueT));
+    }
+
+    uint8_t *reserve(size_t size) {
+        if (header.flags & ApiCaptureCallHeader::truncatedFlag) {
+            return nullptr;
+        }
+        if (extendedRecord.empty() && recordSize + size <= maxRecordSize) {
+            auto destination = &record[recordSize];
+            recordSize += size;
+            return destination;
+        }
+        if (recordSize + size > maxExtendedRecordSize) {
+            header.flags |= ApiCaptureCallHeader::truncatedFlag;
+            return nullptr;
+        }
+        if (extendedRecord.empty()) {
+            extendedRecord.assign(record.begin(), record.begin() + recordSize);
+        }
+        extendedRecord.resize(recordSize + size);
+        auto destination = &extendedRecord[recordSize];
+        recordSize += size;
+        return destination;
+    }
+
+    void submit() {
+        header.threadId = capture->getThreadId();
+        auto recordData = extendedRecord.empty() ? record.data() : extendedRecord.data();
+        memcpy(recordData, &header, sizeof(ApiCaptureCallHeader));
+        capture->submit(recordData, recordSize);
+        capture = nullptr;
+        apiCaptureInProgress = false;
+    }
+
+    ApiCapture *capture = nullptr;
+    ApiCaptureCallHeader header{};
+    std::array<uint8_t, maxRecordSize> record;
+    std::vector<uint8_t> extendedRecord;
+    size_t recordSize = 0;
+    size_t payloadOffset = 0;
+
+    cl_uint eventWaitListCount = 0;
+    const cl_event *eventWaitList = nullptr;
+    cl_event *outputEvent = nullptr;
+    const char *stringArgument = nullptr;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<ApiCaptureCall>);
+
+} // namespace HostSideTracing
@@ -0,0 +1,137 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/api_capture_log.h"
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
+namespace HostSideTracing {
+
+const ApiCapturePayload *ApiCaptureCallRecord::getPayload(ApiCapturePayloadType type) const {
+    for (auto &payload : payloads) {
+        if (payload.type == type) {
+            return &payload;
+        }
+    }
+    return nullptr;
+}
+
+bool ApiCaptureLog::parse(const uint8_t *data, size_t size) {
+    size_t offset = 0;
+    auto read = [&](void *destination, size_t readSize) {
+        if (size - offset < readSize) {
+            return false;
+        }
+        memcpy(destination, data + offset, readSize);
+        offset += readSize;
+        return true;
+    };
+
+    uint32_t header[2] = {};
+    if (!read(header, sizeof(header)) || header[0] != apiCaptureFileMagic || header[1] != apiCaptureFileVersion) {
+        return false;
+    }
+
+    while (offset < size) {
+        ApiCaptureRecordType type{};
+        if (size - offset < sizeof(type)) {
+            return false;
+        }
+        memcpy(&type, data + offset, sizeof(type));
+
+        if (type == ApiCaptureRecordType::functionName) {
+            ApiCaptureFunctionNameHeader nameHeader{};
+            if (!read(&nameHeader, sizeof(nameHeader)) || size - offset < nameHeader.nameLength) {
+                return false;
+            }
+            functionNames[nameHeader.functionId] = std::string(reinterpret_cast<const char *>(data + offset), nameHeader.nameLength);
+            offset += nameHeader.nameLength;
+        } else if (type == ApiCaptureRecordType::call) {
+            ApiCaptureCallHeader callHeader{};
+            if (!read(&callHeader, sizeof(callHeader)) ||
+                size - offset < static_cast<size_t>(callHeader.argumentsSize) + callHeader.payloadSize + callHeader.returnValueSize) {
+                return false;
+            }
+
+            ApiCaptureCallRecord call{};
+            call.functionId = callHeader.functionId;
+            call.threadId = callHeader.threadId;
+            call.enterNs = callHeader.enterNs;
+            call.exitNs = callHeader.exitNs;
+            call.truncated = (callHeader.flags & ApiCaptureCallHeader::truncatedFlag) != 0;
+
+            const auto argumentsEnd = offset + callHeader.argumentsSize;
+            while (offset < argumentsEnd) {
+                const auto valueSize = data[offset++];
+                if (argumentsEnd - offset < valueSize) {
+                    return false;
+                }
+                call.arguments.emplace_back(data + offset, data + offset + valueSize);
+                offset += valueSize;
+            }
+
+            const auto payloadEnd = offset + callHeader.payloadSize;
+            while (offset < payloadEnd) {
+                ApiCapturePayload payload{};
+                uint32_t payloadDataSize = 0;
+                if (payloadEnd - offset < sizeof(payload.type) + sizeof(payloadDataSize)) {
+                    return false;
+                }
+                memcpy(&payload.type, data + offset, sizeof(payload.type));
+                memcpy(&payloadDataSize, data + offset + sizeof(payload.type), sizeof(payloadDataSize));
+                offset += sizeof(payload.type) + sizeof(payloadDataSize);
+                if (payloadEnd - offset < payloadDataSize) {
+                    return false;
+                }
+                payload.data.assign(data + offset, data + offset + payloadDataSize);
+                offset += payloadDataSize;
+                call.payloads.push_back(std::move(payload));
+            }
+
+            if (callHeader.returnValueSize > 0) {
+                call.returnValue.assign(data + offset + 1, data + offset + callHeader.returnValueSize);
+                offset += callHeader.returnValueSize;
+            }
+            calls.push_back(std::move(call));
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::map<std::string, ApiCaptureStatistics> ApiCaptureLog::getStatistics() const {
+    std::map<std::string, ApiCaptureStatistics> statistics;
+    for (auto &call : calls) {
+        auto name = functionNames.find(call.functionId);
+        auto &functionStatistics = statistics[name != functionNames.end() ? name->second : "unknown_" + std::to_string(call.functionId)];
+        auto duration = call.exitNs - call.enterNs;
+        functionStatistics.callsCount++;
+        functionStatistics.totalNs += duration;
+        functionStatistics.minNs = std::min(functionStatistics.minNs, duration);
+        functionStatistics.maxNs = std::max(functionStatistics.maxNs, duration);
+    }
+    return statistics;
+}
+
+std::string ApiCaptureLog::printStatistics() const {
+    return printApiCaptureStatistics(getStatistics());
+}
+
+std::string printApiCaptureStatistics(const std::map<std::string, ApiCaptureStatistics> &statistics) {
+    std::stringstream output;
+    output << "function,calls,totalNs,avgNs,minNs,maxNs\n";
+    for (auto &[name, functionStatistics] : statistics) {
+        output << name << "," << functionStatistics.callsCount << "," << functionStatistics.totalNs << ","
+               << functionStatistics.totalNs / functionStatistics.callsCount << "," << functionStatistics.minNs << "," << functionStatistics.maxNs << "\n";
+    }
+    return output.str();
+}
+
+} // namespace HostSideTracing
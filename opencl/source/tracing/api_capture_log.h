@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace HostSideTracing {
+
+inline constexpr uint32_t apiCaptureFileMagic = 0x4350414eu; // "NAPC"
+inline constexpr uint32_t apiCaptureFileVersion = 2u;
+
+enum class ApiCaptureRecordType : uint32_t {
+    functionName = 0,
+    call = 1
+};
+
+// Data referenced by pointer arguments which is needed to re-issue the call.
+enum class ApiCapturePayloadType : uint8_t {
+    string = 0,
+    programSource = 1,
+    queueProperties = 2,
+    kernelArgValue = 3,
+    workOffset = 4,
+    globalWorkSize = 5,
+    localWorkSize = 6,
+    fillPattern = 7,
+    eventWaitList = 8,
+    outputEvent = 9
+};
+
+struct ApiCaptureFunctionNameHeader {
+    ApiCaptureRecordType type = ApiCaptureRecordType::functionName;
+    uint32_t functionId = 0;
+    uint32_t nameLength = 0;
+    uint32_t reserved = 0;
+};
+static_assert(sizeof(ApiCaptureFunctionNameHeader) == 16);
+
+// Call record is followed by serialized arguments, payload and return value.
+// Each argument and the return value is stored as one byte of size followed by its bytes,
+// each payload entry as one byte of type and four bytes of size followed by its bytes.
+struct ApiCaptureCallHeader {
+    static constexpr uint32_t truncatedFlag = 1u;
+
+    ApiCaptureRecordType type = ApiCaptureRecordType::call;
+    uint32_t functionId = 0;
+    uint32_t threadId = 0;
+    uint32_t flags = 0;
+    uint16_t argumentsSize = 0;
+    uint16_t returnValueSize = 0;
+    uint32_t payloadSize = 0;
+    uint64_t enterNs = 0;
+    uint64_t exitNs = 0;
+};
+static_assert(sizeof(ApiCaptureCallHeader) == 40);
+
+struct ApiCapturePayload {
+    ApiCapturePayloadType type = ApiCapturePayloadType::string;
+    std::vector<uint8_t> data;
+};
+
+struct ApiCaptureCallRecord {
+    uint32_t functionId = 0;
+    uint32_t threadId = 0;
+    uint64_t enterNs = 0;
+    uint64_t exitNs = 0;
+    std::vector<std::vector<uint8_t>> arguments;
+    std::vector<uint8_t> returnValue;
+    std::vector<ApiCapturePayload> payloads;
+    // values past the record size limit were dropped, the call cannot be re-issued
+    bool truncated = false;
+
+    const ApiCapturePayload *getPayload(ApiCapturePayloadType type) const;
+};
+
+struct ApiCaptureStatistics {
+    uint64_t callsCount = 0;
+    uint64_t totalNs = 0;
+    uint64_t minNs = UINT64_MAX;
+    uint64_t maxNs = 0;
+};
+
+// Parses capture logs and reports CPU time spent in each API function,
+// summaries of captures taken with different drivers can be compared directly.
+std::string printApiCaptureStatistics(const std::map<std::string, ApiCaptureStatistics> &statistics);
+
+class ApiCaptureLog {
+  public:
+    bool parse(const uint8_t *data, size_t size);
+    std::map<std::string, ApiCaptureStatistics> getStatistics() const;
+    std::string printStatistics() const;
+
+    std::map<uint32_t, std::string> functionNames;
+    std::vector<ApiCaptureCallRecord> calls;
+};
+
+} // namespace HostSideTracing
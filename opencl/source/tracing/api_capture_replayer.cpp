@@ -0,0 +1,455 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/api_capture_replayer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+#include <thread>
+
+namespace HostSideTracing {
+
+namespace {
+constexpr size_t hostMemoryAlignment = 4096;
+
+uint64_t getTimestampNs() {
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+} // namespace
+
+const std::unordered_map<std::string, ApiCaptureReplayer::Handler> ApiCaptureReplayer::handlers = {
+    {"clCreateContext", &ApiCaptureReplayer::replayCreateContext},
+    {"clCreateContextFromType", &ApiCaptureReplayer::replayCreateContext},
+    {"clRetainContext", &ApiCaptureReplayer::replayHandleCall<cl_context, &ApiCaptureReplayDispatch::retainContext>},
+    {"clReleaseContext", &ApiCaptureReplayer::replayHandleCall<cl_context, &ApiCaptureReplayDispatch::releaseContext>},
+    {"clCreateCommandQueue", &ApiCaptureReplayer::replayCreateCommandQueue},
+    {"clCreateCommandQueueWithProperties", &ApiCaptureReplayer::replayCreateCommandQueueWithProperties},
+    {"clRetainCommandQueue", &ApiCaptureReplayer::replayHandleCall<cl_command_queue, &ApiCaptureReplayDispatch::retainCommandQueue>},
+    {"clReleaseCommandQueue", &ApiCaptureReplayer::replayHandleCall<cl_command_queue, &ApiCaptureReplayDispatch::releaseCommandQueue>},
+    {"clCreateBuffer", &ApiCaptureReplayer::replayCreateBuffer},
+    {"clRetainMemObject", &ApiCaptureReplayer::replayHandleCall<cl_mem, &ApiCaptureReplayDispatch::retainMemObject>},
+    {"clReleaseMemObject", &ApiCaptureReplayer::replayHandleCall<cl_mem, &ApiCaptureReplayDispatch::releaseMemObject>},
+    {"clCreateProgramWithSource", &ApiCaptureReplayer::replayCreateProgramWithSource},
+    {"clBuildProgram", &ApiCaptureReplayer::replayBuildProgram},
+    {"clRetainProgram", &ApiCaptureReplayer::replayHandleCall<cl_program, &ApiCaptureReplayDispatch::retainProgram>},
+    {"clReleaseProgram", &ApiCaptureReplayer::replayHandleCall<cl_program, &ApiCaptureReplayDispatch::releaseProgram>},
+    {"clCreateKernel", &ApiCaptureReplayer::replayCreateKernel},
+    {"clSetKernelArg", &ApiCaptureReplayer::replaySetKernelArg},
+    {"clRetainKernel", &ApiCaptureReplayer::replayHandleCall<cl_kernel, &ApiCaptureReplayDispatch::retainKernel>},
+    {"clReleaseKernel", &ApiCaptureReplayer::replayHandleCall<cl_kernel, &ApiCaptureReplayDispatch::releaseKernel>},
+    {"clEnqueueNdRangeKernel", &ApiCaptureReplayer::replayEnqueueNDRangeKernel},
+    {"clEnqueueReadBuffer", &ApiCaptureReplayer::replayEnqueueReadBuffer},
+    {"clEnqueueWriteBuffer", &ApiCaptureReplayer::replayEnqueueWriteBuffer},
+    {"clEnqueueCopyBuffer", &ApiCaptureReplayer::replayEnqueueCopyBuffer},
+    {"clEnqueueFillBuffer", &ApiCaptureReplayer::replayEnqueueFillBuffer},
+    {"clWaitForEvents", &ApiCaptureReplayer::replayWaitForEvents},
+    {"clRetainEvent", &ApiCaptureReplayer::replayHandleCall<cl_event, &ApiCaptureReplayDispatch::retainEvent>},
+    {"clReleaseEvent", &ApiCaptureReplayer::replayHandleCall<cl_event, &ApiCaptureReplayDispatch::releaseEvent>},
+    {"clFlush", &ApiCaptureReplayer::replayHandleCall<cl_command_queue, &ApiCaptureReplayDispatch::flush>},
+    {"clFinish", &ApiCaptureReplayer::replayHandleCall<cl_command_queue, &ApiCaptureReplayDispatch::finish>},
+};
+
+bool ApiCaptureReplayer::replay(const ApiCaptureLog &log) {
+    if (!selectDevice()) {
+        return false;
+    }
+
+    std::vector<const ApiCaptureCallRecord *> calls;
+    calls.reserve(log.calls.size());
+    for (auto &call : log.calls) {
+        calls.push_back(&call);
+    }
+    std::stable_sort(calls.begin(), calls.end(), [](auto left, auto right) { return left->enterNs < right->enterNs; });
+
+    const auto replayStartNs = getTimestampNs();
+    for (auto call : calls) {
+        auto name = log.functionNames.find(call->functionId);
+        auto functionName = name != log.functionNames.end() ? name->second : "unknown_" + std::to_string(call->functionId);
+
+        auto handler = handlers.find(functionName);
+        if (handler == handlers.end() || call->truncated || !isCapturedCallSuccessful(*call)) {
+            skippedCalls[functionName]++;
+            continue;
+        }
+
+        if (timing == Timing::original) {
+            const auto callOffsetNs = call->enterNs - calls.front()->enterNs;
+            const auto elapsedNs = getTimestampNs() - replayStartNs;
+            if (callOffsetNs > elapsedNs) {
+                std::this_thread::sleep_for(std::chrono::nanoseconds(callOffsetNs - elapsedNs));
+            }
+        }
+
+        if (!(this->*(handler->second))(*call)) {
+            skippedCalls[functionName]++;
+            continue;
+        }
+
+        auto &functionStatistics = statistics[functionName];
+        functionStatistics.callsCount++;
+        functionStatistics.totalNs += lastCallNs;
+        functionStatistics.minNs = std::min(functionStatistics.minNs, lastCallNs);
+        functionStatistics.maxNs = std::max(functionStatistics.maxNs, lastCallNs);
+    }
+    return true;
+}
+
+std::string ApiCaptureReplayer::printSkippedCalls() const {
+    std::stringstream output;
+    output << "function,skippedCalls\n";
+    for (auto &[name, count] : skippedCalls) {
+        output << name << "," << count << "\n";
+    }
+    return output.str();
+}
+
+bool ApiCaptureReplayer::selectDevice() {
+    cl_platform_id platform = nullptr;
+    if (dispatch.getPlatformIDs(1, &platform, nullptr) != CL_SUCCESS) {
+        return false;
+    }
+    return dispatch.getDeviceIDs(platform, CL_DEVICE_TYPE_ALL, 1, &device, nullptr) == CL_SUCCESS;
+}
+
+template <typename T>
+bool ApiCaptureReplayer::getArgument(const ApiCaptureCallRecord &call, size_t index, T &value) {
+    if (index >= call.arguments.size() || call.arguments[index].size() != sizeof(T)) {
+        return false;
+    }
+    memcpy(&value, call.arguments[index].data(), sizeof(T));
+    return true;
+}
+
+bool ApiCaptureReplayer::isCapturedCallSuccessful(const ApiCaptureCallRecord &call) {
+    // functions return either an error code or the created object
+    if (call.returnValue.size() == sizeof(cl_int)) {
+        cl_int returnValue = CL_SUCCESS;
+        memcpy(&returnValue, call.returnValue.data(), sizeof(returnValue));
+        return returnValue == CL_SUCCESS;
+    }
+    return std::any_of(call.returnValue.begin(), call.returnValue.end(), [](auto byte) { return byte != 0; });
+}
+
+template <typename HandleT>
+bool ApiCaptureReplayer::getReplayedHandle(uint64_t capturedHandle, HandleT &replayedHandle) const {
+    if (capturedHandle == 0) {
+        replayedHandle = nullptr;
+        return true;
+    }
+    auto handle = replayedHandles.find(capturedHandle);
+    if (handle == replayedHandles.end()) {
+        return false;
+    }
+    replayedHandle = static_cast<HandleT>(handle->second);
+    return true;
+}
+
+template <typename HandleT>
+bool ApiCaptureReplayer::getReplayedHandle(const ApiCaptureCallRecord &call, size_t index, HandleT &replayedHandle) const {
+    uintptr_t capturedHandle = 0;
+    return getArgument(call, index, capturedHandle) && getReplayedHandle(capturedHandle, replayedHandle);
+}
+
+void ApiCaptureReplayer::storeReplayedHandle(const ApiCaptureCallRecord &call, void *replayedHandle) {
+    uintptr_t capturedHandle = 0;
+    if (replayedHandle && call.returnValue.size() == sizeof(capturedHandle)) {
+        memcpy(&capturedHandle, call.returnValue.data(), sizeof(capturedHandle));
+        replayedHandles[capturedHandle] = replayedHandle;
+    }
+}
+
+void ApiCaptureReplayer::storeReplayedEvent(const ApiCaptureCallRecord &call, cl_event replayedEvent) {
+    auto outputEvent = call.getPayload(ApiCapturePayloadType::outputEvent);
+    uintptr_t capturedEvent = 0;
+    if (replayedEvent && outputEvent && outputEvent->data.size() == sizeof(capturedEvent)) {
+        memcpy(&capturedEvent, outputEvent->data.data(), sizeof(capturedEvent));
+        replayedHandles[capturedEvent] = replayedEvent;
+    }
+}
+
+std::vector<cl_event> ApiCaptureReplayer::getReplayedWaitList(const ApiCaptureCallRecord &call) const {
+    std::vector<cl_event> waitList;
+    auto capturedWaitList = call.getPayload(ApiCapturePayloadType::eventWaitList);
+    if (!capturedWaitList) {
+        return waitList;
+    }
+    // events created by calls which were not replayed are dropped from the list
+    for (size_t offset = 0; offset + sizeof(uintptr_t) <= capturedWaitList->data.size(); offset += sizeof(uintptr_t)) {
+        uintptr_t capturedEvent = 0;
+        cl_event replayedEvent = nullptr;
+        memcpy(&capturedEvent, capturedWaitList->data.data() + offset, sizeof(capturedEvent));
+        if (getReplayedHandle(capturedEvent, replayedEvent) && replayedEvent) {
+            waitList.push_back(replayedEvent);
+        }
+    }
+    return waitList;
+}
+
+void *ApiCaptureReplayer::getHostMemory(size_t size) {
+    // transfers only need valid memory of the captured size, its contents are not replayed
+    auto &memory = stagingMemory[size];
+    if (!memory) {
+        memory = std::make_unique<uint8_t[]>(size + hostMemoryAlignment);
+    }
+    auto address = reinterpret_cast<uintptr_t>(memory.get());
+    return reinterpret_cast<void *>((address + hostMemoryAlignment - 1) & ~(hostMemoryAlignment - 1));
+}
+
+void *ApiCaptureReplayer::allocateHostMemory(size_t size) {
+    hostAllocations.push_back(std::make_unique<uint8_t[]>(size + hostMemoryAlignment));
+    auto address = reinterpret_cast<uintptr_t>(hostAllocations.back().get());
+    return reinterpret_cast<void *>((address + hostMemoryAlignment - 1) & ~(hostMemoryAlignment - 1));
+}
+
+template <typename FunctionT, typename... Args>
+auto ApiCaptureReplayer::measure(FunctionT function, Args... args) {
+    const auto startNs = getTimestampNs();
+    auto result = function(args...);
+    lastCallNs = getTimestampNs() - startNs;
+    return result;
+}
+
+template <typename HandleT, auto function>
+bool ApiCaptureReplayer::replayHandleCall(const ApiCaptureCallRecord &call) {
+    HandleT handle = nullptr;
+    if (!getReplayedHandle(call, 0, handle) || !handle) {
+        return false;
+    }
+    measure(dispatch.*function, handle);
+    return true;
+}
+
+bool ApiCaptureReplayer::replayCreateContext(const ApiCaptureCallRecord &call) {
+    cl_int retVal = CL_SUCCESS;
+    auto context = measure(dispatch.createContext, nullptr, 1u, &device, nullptr, nullptr, &retVal);
+    storeReplayedHandle(call, context);
+    return retVal == CL_SUCCESS;
+}
+
+bool ApiCaptureReplayer::replayCreateCommandQueue(const ApiCaptureCallRecord &call) {
+    cl_context context = nullptr;
+    cl_command_queue_properties properties = 0;
+    if (!getReplayedHandle(call, 0, context) || !getArgument(call, 2, properties)) {
+        return false;
+    }
+    cl_queue_properties queueProperties[] = {CL_QUEUE_PROPERTIES, properties, 0};
+    cl_int retVal = CL_SUCCESS;
+    auto commandQueue = measure(dispatch.createCommandQueueWithProperties, context, device, properties ? queueProperties : nullptr, &retVal);
+    storeReplayedHandle(call, commandQueue);
+    return retVal == CL_SUCCESS;
+}
+
+bool ApiCaptureReplayer::replayCreateCommandQueueWithProperties(const ApiCaptureCallRecord &call) {
+    cl_context context = nullptr;
+    if (!getReplayedHandle(call, 0, context)) {
+        return false;
+    }
+    std::vector<cl_queue_properties> properties;
+    if (auto capturedProperties = call.getPayload(ApiCapturePayloadType::queueProperties)) {
+        properties.resize(capturedProperties->data.size() / sizeof(cl_queue_properties));
+        memcpy(properties.data(), capturedProperties->data.data(), properties.size() * sizeof(cl_queue_properties));
+    }
+    cl_int retVal = CL_SUCCESS;
+    auto commandQueue = measure(dispatch.createCommandQueueWithProperties, context, device, properties.empty() ? nullptr : properties.data(), &retVal);
+    storeReplayedHandle(call, commandQueue);
+    return retVal == CL_SUCCESS;
+}
+
+bool ApiCaptureReplayer::replayCreateBuffer(const ApiCaptureCallRecord &call) {
+    cl_context context = nullptr;
+    cl_mem_flags flags = 0;
+    size_t size = 0;
+    if (!getReplayedHandle(call, 0, context) || !getArgument(call, 1, flags) || !getArgument(call, 2, size)) {
+        return false;
+    }
+    void *hostPtr = nullptr;
+    if (flags & CL_MEM_USE_HOST_PTR) {
+        hostPtr = allocateHostMemory(size);
+    } else if (flags & CL_MEM_COPY_HOST_PTR) {
+        hostPtr = getHostMemory(size);
+    }
+    cl_int retVal = CL_SUCCESS;
+    auto buffer = measure(dispatch.createBuffer, context, flags, size, hostPtr, &retVal);
+    storeReplayedHandle(call, buffer);
+    return retVal == CL_SUCCESS;
+}
+
+bool ApiCaptureReplayer::replayCreateProgramWithSource(const ApiCaptureCallRecord &call) {
+    cl_context context = nullptr;
+    auto source = call.getPayload(ApiCapturePayloadType::programSource);
+    if (!getReplayedHandle(call, 0, context) || !source) {
+        return false;
+    }
+    auto sourceString = reinterpret_cast<const char *>(source->data.data());
+    auto sourceLength = source->data.size();
+    cl_int retVal = CL_SUCCESS;
+    auto program = measure(dispatch.createProgramWithSource, context, 1u, &sourceString, &sourceLength, &retVal);
+    storeReplayedHandle(call, program);
+    return retVal == CL_SUCCESS;
+}
+
+bool ApiCaptureReplayer::replayBuildProgram(const ApiCaptureCallRecord &call) {
+    cl_program program = nullptr;
+    if (!getReplayedHandle(call, 0, program) || !program) {
+        return false;
+    }
+    std::string options;
+    if (auto capturedOptions = call.getPayload(ApiCapturePayloadType::string)) {
+        options.assign(capturedOptions->data.begin(), capturedOptions->data.end());
+    }
+    measure(dispatch.buildProgram, program, 0u, nullptr, options.c_str(), nullptr, nullptr);
+    return true;
+}
+
+bool ApiCaptureReplayer::replayCreateKernel(const ApiCaptureCallRecord &call) {
+    cl_program program = nullptr;
+    auto kernelName = call.getPayload(ApiCapturePayloadType::string);
+    if (!getReplayedHandle(call, 0, program) || !kernelName) {
+        return false;
+    }
+    std::string name(kernelName->data.begin(), kernelName->data.end());
+    cl_int retVal = CL_SUCCESS;
+    auto kernel = measure(dispatch.createKernel, program, name.c_str(), &retVal);
+    storeReplayedHandle(call, kernel);
+    return retVal == CL_SUCCESS;
+}
+
+bool ApiCaptureReplayer::replaySetKernelArg(const ApiCaptureCallRecord &call) {
+    cl_kernel kernel = nullptr;
+    cl_uint argIndex = 0;
+    size_t argSize = 0;
+    if (!getReplayedHandle(call, 0, kernel) || !getArgument(call, 1, argIndex) || !getArgument(call, 2, argSize)) {
+        return false;
+    }
+
+    std::vector<uint8_t> argValue;
+    if (auto capturedArgValue = call.getPayload(ApiCapturePayloadType::kernelArgValue)) {
+        argValue = capturedArgValue->data;
+    }
+    // argument types are not captured, pointer sized values matching replayed objects are treated as their handles
+    if (argValue.size() == sizeof(uintptr_t)) {
+        uintptr_t capturedHandle = 0;
+        void *replayedHandle = nullptr;
+        memcpy(&capturedHandle, argValue.data(), sizeof(capturedHandle));
+        if (capturedHandle != 0 && getReplayedHandle(capturedHandle, replayedHandle)) {
+            memcpy(argValue.data(), &replayedHandle, sizeof(replayedHandle));
+        }
+    }
+    measure(dispatch.setKernelArg, kernel, argIndex, argSize, argValue.empty() ? nullptr : argValue.data());
+    return true;
+}
+
+bool ApiCaptureReplayer::replayEnqueueNDRangeKernel(const ApiCaptureCallRecord &call) {
+    cl_command_queue commandQueue = nullptr;
+    cl_kernel kernel = nullptr;
+    cl_uint workDim = 0;
+    if (!getReplayedHandle(call, 0, commandQueue) || !getReplayedHandle(call, 1, kernel) || !getArgument(call, 2, workDim)) {
+        return false;
+    }
+    auto getWorkSizes = [&call](ApiCapturePayloadType type) -> const size_t * {
+        auto workSizes = call.getPayload(type);
+        return workSizes ? reinterpret_cast<const size_t *>(workSizes->data.data()) : nullptr;
+    };
+    auto waitList = getReplayedWaitList(call);
+    cl_event event = nullptr;
+    auto eventRequested = call.getPayload(ApiCapturePayloadType::outputEvent) != nullptr;
+    measure(dispatch.enqueueNDRangeKernel, commandQueue, kernel, workDim,
+            getWorkSizes(ApiCapturePayloadType::workOffset), getWorkSizes(ApiCapturePayloadType::globalWorkSize), getWorkSizes(ApiCapturePayloadType::localWorkSize),
+            static_cast<cl_uint>(waitList.size()), waitList.empty() ? nullptr : waitList.data(), eventRequested ? &event : nullptr);
+    storeReplayedEvent(call, event);
+    return true;
+}
+
+bool ApiCaptureReplayer::replayEnqueueReadBuffer(const ApiCaptureCallRecord &call) {
+    cl_command_queue commandQueue = nullptr;
+    cl_mem buffer = nullptr;
+    cl_bool blocking = CL_FALSE;
+    size_t offset = 0;
+    size_t size = 0;
+    if (!getReplayedHandle(call, 0, commandQueue) || !getReplayedHandle(call, 1, buffer) ||
+        !getArgument(call, 2, blocking) || !getArgument(call, 3, offset) || !getArgument(call, 4, size)) {
+        return false;
+    }
+    auto waitList = getReplayedWaitList(call);
+    cl_event event = nullptr;
+    auto eventRequested = call.getPayload(ApiCapturePayloadType::outputEvent) != nullptr;
+    measure(dispatch.enqueueReadBuffer, commandQueue, buffer, blocking, offset, size, getHostMemory(size),
+            static_cast<cl_uint>(waitList.size()), waitList.empty() ? nullptr : waitList.data(), eventRequested ? &event : nullptr);
+    storeReplayedEvent(call, event);
+    return true;
+}
+
+bool ApiCaptureReplayer::replayEnqueueWriteBuffer(const ApiCaptureCallRecord &call) {
+    cl_command_queue commandQueue = nullptr;
+    cl_mem buffer = nullptr;
+    cl_bool blocking = CL_FALSE;
+    size_t offset = 0;
+    size_t size = 0;
+    if (!getReplayedHandle(call, 0, commandQueue) || !getReplayedHandle(call, 1, buffer) ||
+        !getArgument(call, 2, blocking) || !getArgument(call, 3, offset) || !getArgument(call, 4, size)) {
+        return false;
+    }
+    auto waitList = getReplayedWaitList(call);
+    cl_event event = nullptr;
+    auto eventRequested = call.getPayload(ApiCapturePayloadType::outputEvent) != nullptr;
+    measure(dispatch.enqueueWriteBuffer, commandQueue, buffer, blocking, offset, size, static_cast<const void *>(getHostMemory(size)),
+            static_cast<cl_uint>(waitList.size()), waitList.empty() ? nullptr : waitList.data(), eventRequested ? &event : nullptr);
+    storeReplayedEvent(call, event);
+    return true;
+}
+
+bool ApiCaptureReplayer::replayEnqueueCopyBuffer(const ApiCaptureCallRecord &call) {
+    cl_command_queue commandQueue = nullptr;
+    cl_mem srcBuffer = nullptr;
+    cl_mem dstBuffer = nullptr;
+    size_t srcOffset = 0;
+    size_t dstOffset = 0;
+    size_t size = 0;
+    if (!getReplayedHandle(call, 0, commandQueue) || !getReplayedHandle(call, 1, srcBuffer) || !getReplayedHandle(call, 2, dstBuffer) ||
+        !getArgument(call, 3, srcOffset) || !getArgument(call, 4, dstOffset) || !getArgument(call, 5, size)) {
+        return false;
+    }
+    auto waitList = getReplayedWaitList(call);
+    cl_event event = nullptr;
+    auto eventRequested = call.getPayload(ApiCapturePayloadType::outputEvent) != nullptr;
+    measure(dispatch.enqueueCopyBuffer, commandQueue, srcBuffer, dstBuffer, srcOffset, dstOffset, size,
+            static_cast<cl_uint>(waitList.size()), waitList.empty() ? nullptr : waitList.data(), eventRequested ? &event : nullptr);
+    storeReplayedEvent(call, event);
+    return true;
+}
+
+bool ApiCaptureReplayer::replayEnqueueFillBuffer(const ApiCaptureCallRecord &call) {
+    cl_command_queue commandQueue = nullptr;
+    cl_mem buffer = nullptr;
+    size_t offset = 0;
+    size_t size = 0;
+    auto pattern = call.getPayload(ApiCapturePayloadType::fillPattern);
+    if (!getReplayedHandle(call, 0, commandQueue) || !getReplayedHandle(call, 1, buffer) ||
+        !getArgument(call, 4, offset) || !getArgument(call, 5, size) || !pattern) {
+        return false;
+    }
+    auto waitList = getReplayedWaitList(call);
+    cl_event event = nullptr;
+    auto eventRequested = call.getPayload(ApiCapturePayloadType::outputEvent) != nullptr;
+    measure(dispatch.enqueueFillBuffer, commandQueue, buffer, static_cast<const void *>(pattern->data.data()), pattern->data.size(), offset, size,
+            static_cast<cl_uint>(waitList.size()), waitList.empty() ? nullptr : waitList.data(), eventRequested ? &event : nullptr);
+    storeReplayedEvent(call, event);
+    return true;
+}
+
+bool ApiCaptureReplayer::replayWaitForEvents(const ApiCaptureCallRecord &call) {
+    auto waitList = getReplayedWaitList(call);
+    if (waitList.empty()) {
+        return false;
+    }
+    measure(dispatch.waitForEvents, static_cast<cl_uint>(waitList.size()), static_cast<const cl_event *>(waitList.data()));
+    return true;
+}
+
+} // namespace HostSideTracing
@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "opencl/source/tracing/api_capture_log.h"
+
+#include "CL/cl.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace HostSideTracing {
+
+// OpenCL entry points used to re-issue captured calls, filled from the library under test.
+struct ApiCaptureReplayDispatch {
+    decltype(&clGetPlatformIDs) getPlatformIDs = nullptr;
+    decltype(&clGetDeviceIDs) getDeviceIDs = nullptr;
+    decltype(&clCreateContext) createContext = nullptr;
+    decltype(&clRetainContext) retainContext = nullptr;
+    decltype(&clReleaseContext) releaseContext = nullptr;
+    decltype(&clCreateCommandQueueWithProperties) createCommandQueueWithProperties = nullptr;
+    decltype(&clRetainCommandQueue) retainCommandQueue = nullptr;
+    decltype(&clReleaseCommandQueue) releaseCommandQueue = nullptr;
+    decltype(&clCreateBuffer) createBuffer = nullptr;
+    decltype(&clRetainMemObject) retainMemObject = nullptr;
+    decltype(&clReleaseMemObject) releaseMemObject = nullptr;
+    decltype(&clCreateProgramWithSource) createProgramWithSource = nullptr;
+    decltype(&clBuildProgram) buildProgram = nullptr;
+    decltype(&clRetainProgram) retainProgram = nullptr;
+    decltype(&clReleaseProgram) releaseProgram = nullptr;
+    decltype(&clCreateKernel) createKernel = nullptr;
+    decltype(&clSetKernelArg) setKernelArg = nullptr;
+    decltype(&clRetainKernel) retainKernel = nullptr;
+    decltype(&clReleaseKernel) releaseKernel = nullptr;
+    decltype(&clEnqueueNDRangeKernel) enqueueNDRangeKernel = nullptr;
+    decltype(&clEnqueueReadBuffer) enqueueReadBuffer = nullptr;
+    decltype(&clEnqueueWriteBuffer) enqueueWriteBuffer = nullptr;
+    decltype(&clEnqueueCopyBuffer) enqueueCopyBuffer = nullptr;
+    decltype(&clEnqueueFillBuffer) enqueueFillBuffer = nullptr;
+    decltype(&clWaitForEvents) waitForEvents = nullptr;
+    decltype(&clRetainEvent) retainEvent = nullptr;
+    decltype(&clReleaseEvent) releaseEvent = nullptr;
+    decltype(&clFlush) flush = nullptr;
+    decltype(&clFinish) finish = nullptr;
+};
+
+// Re-issues captured calls on one thread in the order they entered the driver.
+// Object handles returned by the capture are remapped to the replayed objects, host memory is
+// replaced with replayer owned memory and all contexts and queues use the first device found.
+// Calls of other functions, failed or truncated calls and calls using objects that were not
+// replayed are skipped. CPU time of each re-issued call is reported like the captured one.
+class ApiCaptureReplayer {
+  public:
+    enum class Timing {
+        asFastAsPossible,
+        original
+    };
+
+    ApiCaptureReplayer(const ApiCaptureReplayDispatch &dispatch, Timing timing) : dispatch(dispatch), timing(timing) {}
+
+    bool replay(const ApiCaptureLog &log);
+
+    const std::map<std::string, ApiCaptureStatistics> &getStatistics() const { return statistics; }
+    const std::map<std::string, uint64_t> &getSkippedCalls() const { return skippedCalls; }
+    std::string printSkippedCalls() const;
+
+  protected:
+    using Handler = bool (ApiCaptureReplayer::*)(const ApiCaptureCallRecord &call);
+    static const std::unordered_map<std::string, Handler> handlers;
+
+    bool replayCreateContext(const ApiCaptureCallRecord &call);
+    bool replayCreateCommandQueue(const ApiCaptureCallRecord &call);
+    bool replayCreateCommandQueueWithProperties(const ApiCaptureCallRecord &call);
+    bool replayCreateBuffer(const ApiCaptureCallRecord &call);
+    bool replayCreateProgramWithSource(const ApiCaptureCallRecord &call);
+    bool replayBuildProgram(const ApiCaptureCallRecord &call);
+    bool replayCreateKernel(const ApiCaptureCallRecord &call);
+    bool replaySetKernelArg(const ApiCaptureCallRecord &call);
+    bool replayEnqueueNDRangeKernel(const ApiCaptureCallRecord &call);
+    bool replayEnqueueReadBuffer(const ApiCaptureCallRecord &call);
+    bool replayEnqueueWriteBuffer(const ApiCaptureCallRecord &call);
+    bool replayEnqueueCopyBuffer(const ApiCaptureCallRecord &call);
+    bool replayEnqueueFillBuffer(const ApiCaptureCallRecord &call);
+    bool replayWaitForEvents(const ApiCaptureCallRecord &call);
+    template <typename HandleT, auto function>
+    bool replayHandleCall(const ApiCaptureCallRecord &call);
+
+    bool selectDevice();
+    template <typename T>
+    static bool getArgument(const ApiCaptureCallRecord &call, size_t index, T &value);
+    static bool isCapturedCallSuccessful(const ApiCaptureCallRecord &call);
+    template <typename HandleT>
+    bool getReplayedHandle(uint64_t capturedHandle, HandleT &replayedHandle) const;
+    template <typename HandleT>
+    bool getReplayedHandle(const ApiCaptureCallRecord &call, size_t index, HandleT &replayedHandle) const;
+    void storeReplayedHandle(const ApiCaptureCallRecord &call, void *replayedHandle);
+    void storeReplayedEvent(const ApiCaptureCallRecord &call, cl_event replayedEvent);
+    std::vector<cl_event> getReplayedWaitList(const ApiCaptureCallRecord &call) const;
+    void *getHostMemory(size_t size);
+    void *allocateHostMemory(size_t size);
+
+    template <typename FunctionT, typename... Args>
+    auto measure(FunctionT function, Args... args);
+
+    ApiCaptureReplayDispatch dispatch;
+    Timing timing;
+    cl_device_id device = nullptr;
+
+    std::unordered_map<uint64_t, void *> replayedHandles;
+    std::unordered_map<size_t, std::unique_ptr<uint8_t[]>> stagingMemory;
+    std::vector<std::unique_ptr<uint8_t[]>> hostAllocations;
+
+    uint64_t lastCallNs = 0;
+    std::map<std::string, ApiCaptureStatistics> statistics;
+    std::map<std::string, uint64_t> skippedCalls;
+};
+
+} // namespace HostSideTracing
@@ -10,6 +10,7 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include "opencl/source/tracing/api_capture.h"
 #include "opencl/source/tracing/tracing_handle.h"
 
 #include <atomic>
@@ -59,9 +60,16 @@ static_assert(NEO::NonCopyableAndNonMovable<CheckIfExitCalled>);
         if (isHostSideTracingEnabled_##name) {                                                                                                     \
             tracer_##name.enter(__VA_ARGS__);                                                                                                      \
         }                                                                                                                                          \
+    }                                                                                                                                              \
+    HostSideTracing::ApiCaptureCall apiCaptureCall_##name;                                                                                         \
+    if (auto apiCapture = HostSideTracing::ApiCapture::get()) {                                                                                    \
+        static const uint32_t apiCaptureFunctionId = apiCapture->registerFunction(#name);                                                          \
+        apiCaptureCall_##name.setup(apiCapture, apiCaptureFunctionId);                                                                             \
+        apiCaptureCall_##name.enter<HostSideTracing::name##Tracer>(__VA_ARGS__);                                                                   \
     }
 
 #define TRACING_EXIT(name, ...)                     \
+    apiCaptureCall_##name.exit(__VA_ARGS__);        \
     if (currentlyTracedCall) {                      \
         if (isHostSideTracingEnabled_##name) {      \
             tracer_##name.exit(__VA_ARGS__);        \
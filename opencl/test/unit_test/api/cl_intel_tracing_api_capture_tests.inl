@@ -0,0 +1,414 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/api_capture.h"
+#include "opencl/source/tracing/api_capture_replayer.h"
+
+#include "gtest/gtest.h"
+
+#include <thread>
+
+using namespace HostSideTracing;
+
+namespace ULT {
+
+class MockApiCapture : public ApiCapture {
+  public:
+    using ApiCapture::rings;
+
+    MockApiCapture(size_t ringCapacity) : ApiCapture("api_capture_file", ringCapacity) {}
+
+    void writeToFile(const void *data, size_t size) override {
+        if (output.empty()) {
+            uint32_t header[] = {fileMagic, fileVersion};
+            output.insert(output.end(), reinterpret_cast<const uint8_t *>(header), reinterpret_cast<const uint8_t *>(header) + sizeof(header));
+        }
+        output.insert(output.end(), static_cast<const uint8_t *>(data), static_cast<const uint8_t *>(data) + size);
+        writeToFileCalled++;
+    }
+
+    std::vector<uint8_t> output;
+    uint32_t writeToFileCalled = 0;
+};
+
+TEST(ApiCaptureRingTest, givenRingWhenPushingAndDrainingThenDataIsReturnedInOrderAcrossWrapAround) {
+    ApiCaptureRing ring(3u, 16u);
+    EXPECT_EQ(3u, ring.getThreadId());
+
+    uint8_t data[12];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = i;
+    }
+
+    std::vector<uint8_t> output;
+    EXPECT_TRUE(ring.push(data, 10));
+    EXPECT_FALSE(ring.push(data, 10));
+    ring.drain(output);
+    EXPECT_EQ(0u, ring.getUsedSize());
+
+    EXPECT_TRUE(ring.push(data, 12));
+    EXPECT_EQ(12u, ring.getUsedSize());
+    ring.drain(output);
+
+    ASSERT_EQ(22u, output.size());
+    EXPECT_EQ(0, memcmp(output.data(), data, 10));
+    EXPECT_EQ(0, memcmp(output.data() + 10, data, 12));
+}
+
+TEST(ApiCaptureTest, givenCapturedCallWhenParsingLogThenFunctionNameArgumentsAndReturnValueAreRestored) {
+    MockApiCapture capture(ApiCapture::defaultRingCapacity);
+    auto functionId = capture.registerFunction("ClEnqueueNDRangeKernel");
+
+    cl_uint workDim = 3;
+    void *pointer = reinterpret_cast<void *>(0x1234);
+    const char *name = nullptr;
+    cl_int retVal = CL_INVALID_VALUE;
+    {
+        ApiCaptureCall call;
+        call.setup(&capture, functionId);
+        call.enter(&workDim, &pointer, &name);
+        call.exit(&retVal);
+    }
+    EXPECT_FALSE(apiCaptureInProgress);
+    capture.flush();
+
+    ApiCaptureLog log;
+    ASSERT_TRUE(log.parse(capture.output.data(), capture.output.size()));
+    ASSERT_EQ(1u, log.functionNames.size());
+    EXPECT_EQ("clEnqueueNDRangeKernel", log.functionNames[functionId]);
+
+    ASSERT_EQ(1u, log.calls.size());
+    auto &call = log.calls[0];
+    EXPECT_EQ(functionId, call.functionId);
+    EXPECT_LE(call.enterNs, call.exitNs);
+    ASSERT_EQ(3u, call.arguments.size());
+    ASSERT_EQ(sizeof(cl_uint), call.arguments[0].size());
+    EXPECT_EQ(0, memcmp(&workDim, call.arguments[0].data(), sizeof(cl_uint)));
+    ASSERT_EQ(sizeof(void *), call.arguments[1].size());
+    EXPECT_EQ(0, memcmp(&pointer, call.arguments[1].data(), sizeof(void *)));
+    ASSERT_EQ(sizeof(cl_int), call.returnValue.size());
+    EXPECT_EQ(0, memcmp(&retVal, call.returnValue.data(), sizeof(cl_int)));
+}
+
+TEST(ApiCaptureTest, givenNestedCallWhenCapturingThenOnlyOuterCallIsRecorded) {
+    MockApiCapture capture(ApiCapture::defaultRingCapacity);
+    auto outerFunctionId = capture.registerFunction("ClCreateBuffer");
+    auto innerFunctionId = capture.registerFunction("ClCreateBufferWithProperties");
+
+    cl_mem buffer = nullptr;
+    {
+        ApiCaptureCall outerCall;
+        outerCall.setup(&capture, outerFunctionId);
+        outerCall.enter(&buffer);
+        {
+            ApiCaptureCall innerCall;
+            innerCall.setup(&capture, innerFunctionId);
+            innerCall.enter(&buffer);
+            innerCall.exit(&buffer);
+        }
+        outerCall.exit(nullptr);
+    }
+    capture.flush();
+
+    ApiCaptureLog log;
+    ASSERT_TRUE(log.parse(capture.output.data(), capture.output.size()));
+    ASSERT_EQ(1u, log.calls.size());
+    EXPECT_EQ(outerFunctionId, log.calls[0].functionId);
+    EXPECT_EQ(1u, log.calls[0].arguments.size());
+    EXPECT_TRUE(log.calls[0].returnValue.empty());
+}
+
+TEST(ApiCaptureTest, givenRingFilledWhenSubmittingCallsThenRingIsDrainedAndAllCallsAreWritten) {
+    MockApiCapture capture(256u);
+    auto functionId = capture.registerFunction("ClFlush");
+    auto writesAfterRegister = capture.writeToFileCalled;
+
+    for (cl_int i = 0; i < 20; i++) {
+        ApiCaptureCall call;
+        call.setup(&capture, functionId);
+        call.enter();
+        call.exit(&i);
+    }
+    EXPECT_LT(writesAfterRegister, capture.writeToFileCalled);
+    EXPECT_EQ(1u, capture.rings.size());
+    capture.flush();
+
+    ApiCaptureLog log;
+    ASSERT_TRUE(log.parse(capture.output.data(), capture.output.size()));
+    ASSERT_EQ(20u, log.calls.size());
+    for (cl_int i = 0; i < 20; i++) {
+        EXPECT_EQ(0, memcmp(&i, log.calls[i].returnValue.data(), sizeof(cl_int)));
+    }
+}
+
+TEST(ApiCaptureTest, givenThreadExitedWhenDrainingRingsThenItsCallsAreWrittenAndRingIsReleased) {
+    MockApiCapture capture(ApiCapture::defaultRingCapacity);
+    auto functionId = capture.registerFunction("ClFinish");
+
+    std::thread worker([&]() {
+        cl_int retVal = CL_SUCCESS;
+        ApiCaptureCall call;
+        call.setup(&capture, functionId);
+        call.enter();
+        call.exit(&retVal);
+    });
+    worker.join();
+    ASSERT_EQ(1u, capture.rings.size());
+    EXPECT_TRUE(capture.rings[0]->isThreadExited());
+
+    capture.flush();
+    EXPECT_TRUE(capture.rings.empty());
+
+    ApiCaptureLog log;
+    ASSERT_TRUE(log.parse(capture.output.data(), capture.output.size()));
+    ASSERT_EQ(1u, log.calls.size());
+    EXPECT_EQ(functionId, log.calls[0].functionId);
+}
+
+TEST(ApiCaptureTest, givenEnqueueNdRangeKernelCallWhenCapturingThenWorkSizesWaitListAndCreatedEventAreStoredInPayload) {
+    MockApiCapture capture(ApiCapture::defaultRingCapacity);
+    auto functionId = capture.registerFunction("ClEnqueueNdRangeKernel");
+
+    cl_command_queue commandQueue = reinterpret_cast<cl_command_queue>(0x100);
+    cl_kernel kernel = reinterpret_cast<cl_kernel>(0x200);
+    cl_uint workDim = 2;
+    size_t globalWorkSize[] = {64, 32};
+    const size_t *globalWorkOffset = nullptr;
+    const size_t *globalWorkSizePtr = globalWorkSize;
+    const size_t *localWorkSize = nullptr;
+    cl_event waitEvents[] = {reinterpret_cast<cl_event>(0x300), reinterpret_cast<cl_event>(0x400)};
+    cl_uint numEventsInWaitList = 2;
+    const cl_event *eventWaitList = waitEvents;
+    cl_event createdEvent = nullptr;
+    cl_event *event = &createdEvent;
+    cl_int retVal = CL_SUCCESS;
+    {
+        ApiCaptureCall call;
+        call.setup(&capture, functionId);
+        call.enter<ClEnqueueNdRangeKernelTracer>(&commandQueue, &kernel, &workDim, &globalWorkOffset, &globalWorkSizePtr, &localWorkSize, &numEventsInWaitList, &eventWaitList, &event);
+        createdEvent = reinterpret_cast<cl_event>(0x500);
+        call.exit(&retVal);
+    }
+    capture.flush();
+
+    ApiCaptureLog log;
+    ASSERT_TRUE(log.parse(capture.output.data(), capture.output.size()));
+    ASSERT_EQ(1u, log.calls.size());
+    auto &call = log.calls[0];
+    EXPECT_FALSE(call.truncated);
+    EXPECT_EQ(9u, call.arguments.size());
+    EXPECT_EQ(sizeof(cl_int), call.returnValue.size());
+    EXPECT_EQ(nullptr, call.getPayload(ApiCapturePayloadType::workOffset));
+    EXPECT_EQ(nullptr, call.getPayload(ApiCapturePayloadType::localWorkSize));
+
+    auto globalWorkSizePayload = call.getPayload(ApiCapturePayloadType::globalWorkSize);
+    ASSERT_NE(nullptr, globalWorkSizePayload);
+    ASSERT_EQ(sizeof(globalWorkSize), globalWorkSizePayload->data.size());
+    EXPECT_EQ(0, memcmp(globalWorkSize, globalWorkSizePayload->data.data(), sizeof(globalWorkSize)));
+
+    auto waitListPayload = call.getPayload(ApiCapturePayloadType::eventWaitList);
+    ASSERT_NE(nullptr, waitListPayload);
+    ASSERT_EQ(sizeof(waitEvents), waitListPayload->data.size());
+    EXPECT_EQ(0, memcmp(waitEvents, waitListPayload->data.data(), sizeof(waitEvents)));
+
+    auto outputEventPayload = call.getPayload(ApiCapturePayloadType::outputEvent);
+    ASSERT_NE(nullptr, outputEventPayload);
+    ASSERT_EQ(sizeof(cl_event), outputEventPayload->data.size());
+    EXPECT_EQ(0, memcmp(&createdEvent, outputEventPayload->data.data(), sizeof(cl_event)));
+}
+
+TEST(ApiCaptureTest, givenCallLargerThanInlineRecordWhenCapturingThenWholeCallIsStored) {
+    MockApiCapture capture(ApiCapture::defaultRingCapacity);
+    auto functionId = capture.registerFunction("ClSetKernelArg");
+
+    std::vector<uint8_t> value(2 * ApiCaptureCall::maxRecordSize, 0x5A);
+    cl_kernel kernel = reinterpret_cast<cl_kernel>(0x100);
+    cl_uint argIndex = 1;
+    size_t argSize = value.size();
+    const void *argValue = value.data();
+    cl_int retVal = CL_SUCCESS;
+    {
+        ApiCaptureCall call;
+        call.setup(&capture, functionId);
+        call.enter<ClSetKernelArgTracer>(&kernel, &argIndex, &argSize, &argValue);
+        call.exit(&retVal);
+    }
+    capture.flush();
+
+    ApiCaptureLog log;
+    ASSERT_TRUE(log.parse(capture.output.data(), capture.output.size()));
+    ASSERT_EQ(1u, log.calls.size());
+    EXPECT_FALSE(log.calls[0].truncated);
+    EXPECT_EQ(4u, log.calls[0].arguments.size());
+    EXPECT_EQ(sizeof(cl_int), log.calls[0].returnValue.size());
+    auto argValuePayload = log.calls[0].getPayload(ApiCapturePayloadType::kernelArgValue);
+    ASSERT_NE(nullptr, argValuePayload);
+    EXPECT_EQ(value, argValuePayload->data);
+}
+
+TEST(ApiCaptureTest, givenCallLargerThanRecordLimitWhenCapturingThenCallIsMarkedAsTruncated) {
+    MockApiCapture capture(ApiCapture::defaultRingCapacity);
+    auto functionId = capture.registerFunction("ClSetKernelArg");
+
+    std::vector<uint8_t> value(ApiCaptureCall::maxExtendedRecordSize, 0x5A);
+    cl_kernel kernel = reinterpret_cast<cl_kernel>(0x100);
+    cl_uint argIndex = 1;
+    size_t argSize = value.size();
+    const void *argValue = value.data();
+    cl_int retVal = CL_SUCCESS;
+    {
+        ApiCaptureCall call;
+        call.setup(&capture, functionId);
+        call.enter<ClSetKernelArgTracer>(&kernel, &argIndex, &argSize, &argValue);
+        call.exit(&retVal);
+    }
+    capture.flush();
+
+    ApiCaptureLog log;
+    ASSERT_TRUE(log.parse(capture.output.data(), capture.output.size()));
+    ASSERT_EQ(1u, log.calls.size());
+    EXPECT_TRUE(log.calls[0].truncated);
+    EXPECT_EQ(4u, log.calls[0].arguments.size());
+    EXPECT_EQ(nullptr, log.calls[0].getPayload(ApiCapturePayloadType::kernelArgValue));
+    EXPECT_TRUE(log.calls[0].returnValue.empty());
+}
+
+TEST(ApiCaptureTest, givenCorruptedLogWhenParsingThenFalseIsReturned) {
+    MockApiCapture capture(ApiCapture::defaultRingCapacity);
+    capture.registerFunction("ClFinish");
+
+    ApiCaptureLog log;
+    auto truncated = capture.output;
+    truncated.pop_back();
+    EXPECT_FALSE(log.parse(truncated.data(), truncated.size()));
+
+    auto invalidMagic = capture.output;
+    invalidMagic[0]++;
+    EXPECT_FALSE(log.parse(invalidMagic.data(), invalidMagic.size()));
+
+    auto invalidRecordType = capture.output;
+    invalidRecordType[2 * sizeof(uint32_t)] = 0xFF;
+    EXPECT_FALSE(log.parse(invalidRecordType.data(), invalidRecordType.size()));
+}
+
+TEST(ApiCaptureTest, givenParsedCallsWhenPrintingStatisticsThenCpuTimePerFunctionIsReported) {
+    ApiCaptureLog log;
+    log.functionNames[0] = "clFinish";
+    log.calls.push_back({0u, 0u, 100u, 150u, {}, {}, {}, false});
+    log.calls.push_back({0u, 1u, 200u, 230u, {}, {}, {}, false});
+    log.calls.push_back({1u, 0u, 300u, 310u, {}, {}, {}, false});
+
+    auto statistics = log.getStatistics();
+    ASSERT_EQ(2u, statistics.size());
+    EXPECT_EQ(2u, statistics["clFinish"].callsCount);
+    EXPECT_EQ(80u, statistics["clFinish"].totalNs);
+    EXPECT_EQ(30u, statistics["clFinish"].minNs);
+    EXPECT_EQ(50u, statistics["clFinish"].maxNs);
+    EXPECT_EQ(1u, statistics["unknown_1"].callsCount);
+
+    std::string expected = "function,calls,totalNs,avgNs,minNs,maxNs\n"
+                           "clFinish,2,80,40,30,50\n"
+                           "unknown_1,1,10,10,10,10\n";
+    EXPECT_EQ(expected, log.printStatistics());
+}
+
+namespace ReplayMock {
+cl_context replayedContext = reinterpret_cast<cl_context>(0x1000);
+cl_mem replayedBuffer = reinterpret_cast<cl_mem>(0x2000);
+cl_context createBufferContext = nullptr;
+size_t createBufferSize = 0;
+std::vector<cl_mem> releasedMemObjects;
+
+cl_int CL_API_CALL getPlatformIDs(cl_uint numEntries, cl_platform_id *platforms, cl_uint *numPlatforms) {
+    platforms[0] = reinterpret_cast<cl_platform_id>(0x10);
+    return CL_SUCCESS;
+}
+cl_int CL_API_CALL getDeviceIDs(cl_platform_id platform, cl_device_type deviceType, cl_uint numEntries, cl_device_id *devices, cl_uint *numDevices) {
+    devices[0] = reinterpret_cast<cl_device_id>(0x20);
+    return CL_SUCCESS;
+}
+cl_context CL_API_CALL createContext(const cl_context_properties *properties, cl_uint numDevices, const cl_device_id *devices,
+                                     void(CL_CALLBACK *funcNotify)(const char *, const void *, size_t, void *), void *userData, cl_int *errcodeRet) {
+    *errcodeRet = CL_SUCCESS;
+    return replayedContext;
+}
+cl_mem CL_API_CALL createBuffer(cl_context context, cl_mem_flags flags, size_t size, void *hostPtr, cl_int *errcodeRet) {
+    createBufferContext = context;
+    createBufferSize = size;
+    *errcodeRet = CL_SUCCESS;
+    return replayedBuffer;
+}
+cl_int CL_API_CALL releaseMemObject(cl_mem memobj) {
+    releasedMemObjects.push_back(memobj);
+    return CL_SUCCESS;
+}
+} // namespace ReplayMock
+
+template <typename ReturnT, typename... Args>
+ApiCaptureCallRecord createCallRecord(uint32_t functionId, uint64_t enterNs, ReturnT returnValue, Args... args) {
+    ApiCaptureCallRecord call;
+    call.functionId = functionId;
+    call.enterNs = enterNs;
+    call.exitNs = enterNs + 1;
+    auto appendBytes = [](std::vector<uint8_t> &bytes, auto value) {
+        bytes.insert(bytes.end(), reinterpret_cast<const uint8_t *>(&value), reinterpret_cast<const uint8_t *>(&value) + sizeof(value));
+    };
+    (appendBytes(call.arguments.emplace_back(), args), ...);
+    appendBytes(call.returnValue, returnValue);
+    return call;
+}
+
+TEST(ApiCaptureReplayerTest, givenCapturedCallsWhenReplayingThenHandlesAreRemappedAndUnsupportedCallsAreSkipped) {
+    ApiCaptureReplayDispatch dispatch;
+    dispatch.getPlatformIDs = ReplayMock::getPlatformIDs;
+    dispatch.getDeviceIDs = ReplayMock::getDeviceIDs;
+    dispatch.createContext = ReplayMock::createContext;
+    dispatch.createBuffer = ReplayMock::createBuffer;
+    dispatch.releaseMemObject = ReplayMock::releaseMemObject;
+    ReplayMock::releasedMemObjects.clear();
+
+    const uintptr_t capturedContext = 0x100;
+    const uintptr_t capturedBuffer = 0x200;
+    const uintptr_t unknownBuffer = 0x300;
+    const cl_int success = CL_SUCCESS;
+    ApiCaptureLog log;
+    log.functionNames = {{0u, "clCreateContext"}, {1u, "clCreateBuffer"}, {2u, "clReleaseMemObject"}, {3u, "clGetDeviceInfo"}};
+    log.calls.push_back(createCallRecord(2u, 40u, success, unknownBuffer));
+    log.calls.push_back(createCallRecord(1u, 20u, capturedBuffer, capturedContext, cl_mem_flags{CL_MEM_READ_WRITE}, size_t{4096}, uintptr_t{0}, uintptr_t{0}));
+    log.calls.push_back(createCallRecord(0u, 10u, capturedContext, uintptr_t{0}, cl_uint{1}, uintptr_t{0}, uintptr_t{0}, uintptr_t{0}, uintptr_t{0}));
+    log.calls.push_back(createCallRecord(2u, 30u, success, capturedBuffer));
+    log.calls.push_back(createCallRecord(3u, 50u, success, uintptr_t{0x20}));
+    auto truncatedCall = createCallRecord(1u, 60u, capturedBuffer, capturedContext);
+    truncatedCall.truncated = true;
+    log.calls.push_back(truncatedCall);
+
+    ApiCaptureReplayer replayer(dispatch, ApiCaptureReplayer::Timing::asFastAsPossible);
+    EXPECT_TRUE(replayer.replay(log));
+
+    EXPECT_EQ(ReplayMock::replayedContext, ReplayMock::createBufferContext);
+    EXPECT_EQ(4096u, ReplayMock::createBufferSize);
+    ASSERT_EQ(1u, ReplayMock::releasedMemObjects.size());
+    EXPECT_EQ(ReplayMock::replayedBuffer, ReplayMock::releasedMemObjects[0]);
+
+    auto &statistics = replayer.getStatistics();
+    ASSERT_EQ(3u, statistics.size());
+    EXPECT_EQ(1u, statistics.at("clCreateContext").callsCount);
+    EXPECT_EQ(1u, statistics.at("clCreateBuffer").callsCount);
+    EXPECT_EQ(1u, statistics.at("clReleaseMemObject").callsCount);
+
+    auto &skippedCalls = replayer.getSkippedCalls();
+    ASSERT_EQ(3u, skippedCalls.size());
+    EXPECT_EQ(1u, skippedCalls.at("clReleaseMemObject"));
+    EXPECT_EQ(1u, skippedCalls.at("clGetDeviceInfo"));
+    EXPECT_EQ(1u, skippedCalls.at("clCreateBuffer"));
+}
+
+TEST(ApiCaptureTest, givenApiCaptureDisabledWhenGettingCaptureThenNullptrIsReturned) {
+    EXPECT_EQ(nullptr, ApiCapture::get());
+}
+
+} // namespace ULT
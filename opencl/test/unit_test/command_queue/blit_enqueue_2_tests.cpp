@@ -622,6 +622,7 @@ HWTEST_TEMPLATED_F(BlitCopyTests, givenKernelAllocationInLocalMemoryWithoutCpuAc
     device->getExecutionEnvironment()->rootDeviceEnvironments[0]->getMutableHardwareInfo()->capabilityTable.blitterOperationsSupported = true;
 
     auto linkerInput = std::make_unique<WhiteBox<LinkerInput>>();
+    linkerInput->textRelocations.push_back({{"", 0x8, LinkerInput::RelocationInfo::Type::address, SegmentType::instructions}});
     linkerInput->traits.requiresPatchingOfInstructionSegments = true;
 
     KernelInfo kernelInfo = {};
@@ -649,4 +650,38 @@ HWTEST_TEMPLATED_F(BlitCopyTests, givenKernelAllocationInLocalMemoryWithoutCpuAc
     device->getMemoryManager()->freeGraphicsMemory(kernelInfo.kernelAllocation);
 }
 
+HWTEST_TEMPLATED_F(BlitCopyTests, givenKernelAllocationInLocalMemoryWithoutCpuAccessAllowedWhenLinkerRequiresPatchingButKernelHasNoRelocationsThenIsaIsNotTransferredAgain) {
+    debugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::cpuAccessDisallowed));
+    debugManager.flags.ForceNonSystemMemoryPlacement.set(1 << (static_cast<int64_t>(AllocationType::kernelIsa) - 1));
+
+    device->getExecutionEnvironment()->rootDeviceEnvironments[0]->getMutableHardwareInfo()->capabilityTable.blitterOperationsSupported = true;
+
+    auto linkerInput = std::make_unique<WhiteBox<LinkerInput>>();
+    linkerInput->traits.requiresPatchingOfInstructionSegments = true;
+
+    KernelInfo kernelInfo = {};
+    std::vector<char> kernelHeap;
+    kernelHeap.resize(32, 7);
+    kernelInfo.heapInfo.pKernelHeap = kernelHeap.data();
+    kernelInfo.heapInfo.kernelHeapSize = static_cast<uint32_t>(kernelHeap.size());
+    kernelInfo.createKernelAllocation(device->getDevice(), false);
+    ASSERT_NE(nullptr, kernelInfo.kernelAllocation);
+    EXPECT_TRUE(kernelInfo.kernelAllocation->isAllocatedInLocalMemoryPool());
+
+    std::vector<NEO::ExternalFunctionInfo> externalFunctions;
+    MockProgram program{nullptr, false, toClDeviceVector(*device)};
+    program.getKernelInfoArray(device->getRootDeviceIndex()).push_back(&kernelInfo);
+    program.setLinkerInput(device->getRootDeviceIndex(), std::move(linkerInput));
+
+    auto initialTaskCount = bcsMockContext->bcsCsr->peekTaskCount();
+
+    auto ret = program.linkBinary(&device->getDevice(), nullptr, 0, nullptr, 0, {}, externalFunctions);
+    EXPECT_EQ(CL_SUCCESS, ret);
+
+    EXPECT_EQ(initialTaskCount, bcsMockContext->bcsCsr->peekTaskCount());
+
+    program.getKernelInfoArray(device->getRootDeviceIndex()).clear();
+    device->getMemoryManager()->freeGraphicsMemory(kernelInfo.kernelAllocation);
+}
+
 } // namespace NEO
@@ -13,27 +13,34 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/memory_manager/allocations_list.h"
+#include "shared/source/utilities/completion_reactor.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/relaxed_ordering_commands_helper.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/mocks/mock_direct_submission_hw.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/mocks/mock_timestamp_container.h"
 #include "shared/test/common/mocks/ult_device_factory.h"
 #include "shared/test/common/utilities/base_object_utils.h"
 
 #include "opencl/source/helpers/task_information.h"
+#include "opencl/source/program/printf_handler.h"
 #include "opencl/test/unit_test/command_queue/enqueue_fixture.h"
 #include "opencl/test/unit_test/fixtures/hello_world_fixture.h"
 #include "opencl/test/unit_test/gen_common/gen_commands_common_validation.h"
 #include "opencl/test/unit_test/helpers/cl_hw_parse.h"
 #include "opencl/test/unit_test/mocks/mock_buffer.h"
 #include "opencl/test/unit_test/mocks/mock_command_queue.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
+#include "opencl/test/unit_test/mocks/mock_kernel.h"
 #include "opencl/test/unit_test/test_macros/test_checks_ocl.h"
 
 using namespace NEO;
 #include "shared/test/common/test_macros/header/heapless_matchers.h"
 
+#include <thread>
+
 struct TestParam2 {
     uint32_t scratchSize;
 } testParamTable2[] = {{1024u}, {2048u}, {4096u}, {8192u}, {16384u}};
@@ -737,6 +744,68 @@ INSTANTIATE_TEST_SUITE_P(EnqueueKernel,
                          EnqueueKernelPrintfTest,
                          ::testing::ValuesIn(testParamPrintf));
 
+namespace {
+class NoThreadCompletionReactor : public CompletionReactor {
+  public:
+    using CompletionReactor::draining;
+    using CompletionReactor::registerList;
+
+    void openThread() override {}
+};
+} // namespace
+
+struct EnqueueKernelAsyncPrintfTest : public ::testing::Test {
+    void SetUp() override {
+        debugManager.flags.EnableAsyncPrintfOutput.set(1);
+        debugManager.flags.EnableLocalMemory.set(0);
+
+        auto executionEnvironment = new MockExecutionEnvironment(defaultHwInfo.get(), false, 1u);
+        reactor = new NoThreadCompletionReactor();
+        executionEnvironment->completionReactor.reset(reactor);
+        device = std::make_unique<MockClDevice>(MockDevice::createWithExecutionEnvironment<MockDevice>(nullptr, executionEnvironment, 0u));
+        context = std::make_unique<MockContext>(device.get());
+        mockKernel = std::make_unique<MockKernelWithInternals>(*device, context.get());
+        mockKernel->kernelInfo.setPrintfSurface(sizeof(uintptr_t), 64);
+    }
+
+    DebugManagerStateRestore restore;
+    NoThreadCompletionReactor *reactor = nullptr;
+    std::unique_ptr<MockClDevice> device;
+    std::unique_ptr<MockContext> context;
+    std::unique_ptr<MockKernelWithInternals> mockKernel;
+    size_t globalWorkSize[3] = {1, 1, 1};
+};
+
+HWTEST_F(EnqueueKernelAsyncPrintfTest, givenAsyncPrintfOutputWhenNonBlockingKernelIsEnqueuedThenEnqueueDoesNotWaitAndOutputIsPrintedBeforeFinishReturns) {
+    MockCommandQueueHw<FamilyType> cmdQ(context.get(), device.get(), nullptr);
+
+    auto retVal = cmdQ.enqueueKernel(*mockKernel, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, nullptr);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(std::numeric_limits<uint32_t>::max(), cmdQ.latestTaskCountWaited.load());
+    ASSERT_EQ(1u, reactor->registerList.size());
+    EXPECT_EQ(cmdQ.taskCount, reactor->registerList[0].waitValue);
+    EXPECT_EQ(1u, cmdQ.pendingAsyncPrintfOutputs->getCount());
+
+    std::thread reactorThread([this] { reactor->registerList[0].callback(false); });
+    EXPECT_EQ(CL_SUCCESS, cmdQ.finish());
+    EXPECT_EQ(0u, cmdQ.pendingAsyncPrintfOutputs->getCount());
+    reactorThread.join();
+}
+
+HWTEST_F(EnqueueKernelAsyncPrintfTest, givenReactorNotCompletingWatchesAsyncWhenNonBlockingKernelIsEnqueuedThenOutputIsPrintedSynchronously) {
+    MockCommandQueueHw<FamilyType> cmdQ(context.get(), device.get(), nullptr);
+    reactor->draining = true;
+
+    auto retVal = cmdQ.enqueueKernel(*mockKernel, 1, nullptr, globalWorkSize, nullptr, 0, nullptr, nullptr);
+    reactor->draining = false;
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    EXPECT_EQ(cmdQ.taskCount, cmdQ.latestTaskCountWaited.load());
+    EXPECT_TRUE(reactor->registerList.empty());
+    EXPECT_EQ(0u, cmdQ.pendingAsyncPrintfOutputs->getCount());
+}
+
 using EnqueueKernelTests = ::testing::Test;
 
 HWTEST2_F(EnqueueKernelTests, whenEnqueueingKernelThenCsrCorrectlySetsRequiredThreadArbitrationPolicy, IsHeapfulSupported) {
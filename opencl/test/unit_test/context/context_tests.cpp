@@ -625,6 +625,60 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, ContextCreateTests, givenGpuHangOnFlushBcsTaskAndLo
     EXPECT_EQ(BlitOperationResult::gpuHang, BlitHelper::blitMemoryToAllocation(buffer->getContext()->getDevice(0)->getDevice(), memory, buffer->getOffset(), hostMemory, {1, 1, 1}));
 }
 
+HWCMDTEST_F(IGFX_XE_HP_CORE, ContextCreateTests, givenTransfersToMultipleLocalMemoryAllocationsWhenTransferringThemTogetherThenSingleBcsFlushCopiesAllOfThem) {
+    if (is32bit) {
+        GTEST_SKIP();
+    }
+
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableLocalMemory.set(true);
+    debugManager.flags.ForceLocalMemoryAccessMode.set(static_cast<int32_t>(LocalMemoryAccessMode::defaultMode));
+
+    VariableBackup<HardwareInfo> backupHwInfo(defaultHwInfo.get());
+    defaultHwInfo->capabilityTable.blitterOperationsSupported = true;
+    {
+        auto productHelper = ProductHelper::create(defaultHwInfo->platform.eProductFamily);
+        auto defaultBcsIndex = EngineHelpers::getBcsIndex(productHelper->getDefaultCopyEngine());
+        if (0u != defaultBcsIndex) {
+            defaultHwInfo->featureTable.ftrBcsInfo.set(defaultBcsIndex, true);
+            defaultHwInfo->featureTable.ftrBcsInfo.set(EngineHelpers::getBcsIndex(aub_stream::ENGINE_BCS3), true); // enable BCS3 for internal operations
+        }
+    }
+    UltClDeviceFactory deviceFactory{1, 0};
+
+    auto testedDevice = deviceFactory.rootDevices[0];
+    MockContext context(testedDevice);
+
+    constexpr size_t transfersCount = 3;
+    std::unique_ptr<Buffer> buffers[transfersCount];
+    uint8_t hostMemory[transfersCount][16] = {};
+    MemoryTransfers transfers;
+    for (size_t i = 0; i < transfersCount; i++) {
+        cl_int retVal = CL_SUCCESS;
+        buffers[i].reset(Buffer::create(&context, {}, sizeof(hostMemory[i]), nullptr, retVal));
+        ASSERT_NE(nullptr, buffers[i]);
+        transfers.push_back({buffers[i]->getGraphicsAllocation(testedDevice->getRootDeviceIndex()), buffers[i]->getOffset(), hostMemory[i], sizeof(hostMemory[i]), true});
+    }
+
+    const auto blitDevice = testedDevice->getDevice().getRootDevice()->getNearestGenericSubDevice(0);
+    auto &selectorCopyEngine = blitDevice->getSelectorCopyEngine();
+    auto &rootDeviceEnvironment = testedDevice->getRootDeviceEnvironment();
+    auto &gfxCoreHelper = rootDeviceEnvironment.getHelper<GfxCoreHelper>();
+
+    auto internalUsage = true;
+    auto bcsEngineType = EngineHelpers::getBcsEngineType(rootDeviceEnvironment, blitDevice->getDeviceBitfield(), selectorCopyEngine, internalUsage);
+    auto bcsEngineUsage = gfxCoreHelper.preferInternalBcsEngine() ? EngineUsage::internal : EngineUsage::regular;
+    auto bcsEngine = blitDevice->tryGetEngine(bcsEngineType, bcsEngineUsage);
+    ASSERT_NE(nullptr, bcsEngine);
+
+    auto ultBcsCsr = static_cast<UltCommandStreamReceiver<FamilyType> *>(bcsEngine->commandStreamReceiver);
+    const auto flushBcsTaskCalled = ultBcsCsr->blitBufferCalled;
+
+    EXPECT_TRUE(MemoryTransferHelper::transferMemoryToAllocations(testedDevice->getDevice(), transfers));
+    EXPECT_EQ(flushBcsTaskCalled + 1, ultBcsCsr->blitBufferCalled);
+    EXPECT_EQ(transfersCount, ultBcsCsr->receivedBlitProperties.size());
+}
+
 struct AllocationReuseContextTest : ContextTest {
     void addMappedPtr(Buffer &buffer, void *ptr, size_t ptrLength) {
         auto &handler = context->getMapOperationsStorage().getHandler(&buffer);
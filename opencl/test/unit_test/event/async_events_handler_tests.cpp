@@ -389,3 +389,115 @@ TEST_F(AsyncEventsHandlerTests, WhenReturningThenAsyncProcessWillCallProcessList
 
     event->release();
 }
+
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventsWithCallbacksWhenListIsProcessedThenEventsAreMovedToCompletionHeapOfTheirCsr) {
+    auto baseTaskCount = commandQueue->getHeaplessStateInitEnabled() ? 1u : 0u;
+    int event1Counter(0), event2Counter(0), event3Counter(0);
+
+    event1->setTaskStamp(0, baseTaskCount + 3);
+    event2->setTaskStamp(0, baseTaskCount + 1);
+    event3->setTaskStamp(0, baseTaskCount + 2);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &event1Counter);
+    event2->addCallback(&this->callbackFcn, CL_COMPLETE, &event2Counter);
+    event3->addCallback(&this->callbackFcn, CL_COMPLETE, &event3Counter);
+    handler->registerEvent(event1.get());
+    handler->registerEvent(event2.get());
+    handler->registerEvent(event3.get());
+
+    auto sleepCandidate = handler->process();
+    EXPECT_EQ(event2.get(), sleepCandidate);
+    EXPECT_FALSE(handler->peekIsListEmpty());
+    ASSERT_EQ(1u, handler->completionHeaps.size());
+
+    auto &heap = handler->completionHeaps[&commandQueue->getGpgpuCommandStreamReceiver()];
+    EXPECT_EQ(3u, heap.entries.size());
+    EXPECT_EQ(baseTaskCount + 1, heap.entries.front().taskCount);
+    EXPECT_EQ(3u, handler->statistics.polledEventUpdates);
+
+    handler->process();
+    EXPECT_EQ(3u, handler->statistics.polledEventUpdates);
+    EXPECT_EQ(0u, handler->statistics.heapCompletedEvents);
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = baseTaskCount + 2;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(event1.get(), sleepCandidate);
+    EXPECT_EQ(0, event1Counter);
+    EXPECT_EQ(1, event2Counter);
+    EXPECT_EQ(1, event3Counter);
+    EXPECT_EQ(2u, handler->statistics.heapCompletedEvents);
+    EXPECT_EQ(1, event2->getRefInternalCount());
+    EXPECT_EQ(1, event3->getRefInternalCount());
+
+    *(commandQueue->getGpgpuCommandStreamReceiver().getTagAddress()) = baseTaskCount + 3;
+    sleepCandidate = handler->process();
+    EXPECT_EQ(nullptr, sleepCandidate);
+    EXPECT_EQ(1, event1Counter);
+    EXPECT_TRUE(handler->peekIsListEmpty());
+    EXPECT_EQ(3u, handler->statistics.heapCompletedEvents);
+    EXPECT_EQ(3u, handler->statistics.polledEventUpdates);
+    EXPECT_GE(handler->statistics.totalCallbackLatencyNs, handler->statistics.maxCallbackLatencyNs);
+}
+
+TEST_F(AsyncEventsHandlerTests, givenEventsInCompletionHeapWhenAsyncExecutionInterruptedThenUnreferenceAll) {
+    auto baseTaskCount = commandQueue->getHeaplessStateInitEnabled() ? 1u : 0u;
+    event1->setTaskStamp(0, baseTaskCount + 1);
+    event1->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+
+    handler->registerEvent(event1.get());
+    handler->process();
+    EXPECT_EQ(1u, handler->completionHeaps.size());
+    EXPECT_EQ(3, event1->getRefInternalCount());
+
+    handler->allowAsyncProcess.store(false);
+    MockHandler::asyncProcess(handler.get());
+    EXPECT_TRUE(handler->completionHeaps.empty());
+    EXPECT_EQ(2, event1->getRefInternalCount());
+    EXPECT_EQ(0, counter);
+
+    event1->setStatus(CL_COMPLETE);
+}
+
+TEST_F(AsyncEventsHandlerTests, givenSubmittedEventWaitingForBcsWhenGpgpuTaskCountIsReadyThenEventIsNotMovedToCompletionHeapAndHandlerSleepsOnIt) {
+    struct BcsDependentEvent : MyEvent {
+        using MyEvent::MyEvent;
+        void updateExecutionStatus() override {
+            // copy engine part is still executing
+        }
+    };
+
+    auto baseTaskCount = commandQueue->getHeaplessStateInitEnabled() ? 1u : 0u;
+    auto event = makeReleaseable<BcsDependentEvent>(context.get(), commandQueue.get(), CL_COMMAND_COPY_BUFFER, CompletionStamp::notReady, CompletionStamp::notReady);
+    event->setupBcs(aub_stream::EngineType::ENGINE_BCS);
+    event->updateCompletionStamp(baseTaskCount, 1u, 0u, 0u);
+    event->setStatus(CL_SUBMITTED);
+    event->addCallback(&this->callbackFcn, CL_COMPLETE, &counter);
+    EXPECT_FALSE(event->isCompletionSignaledByGpgpuTaskCountOnly());
+
+    event->handler->registerEvent(event.get());
+    EXPECT_EQ(event.get(), event->handler->process());
+    EXPECT_TRUE(event->handler->completionHeaps.empty());
+    EXPECT_FALSE(event->handler->peekIsListEmpty());
+
+    event->handler->allowAsyncProcess.store(true);
+    MockHandler::asyncProcess(event->handler.get());
+    EXPECT_EQ(1u, event->waitCalled);
+    EXPECT_TRUE(event->handler->completionHeaps.empty());
+    EXPECT_EQ(0, counter);
+
+    event->setStatus(CL_COMPLETE);
+}
+
+TEST_F(AsyncEventsHandlerTests, givenPrintAsyncEventsHandlerStatisticsWhenPrintingStatisticsThenCountersAndLatencyArePrinted) {
+    debugManager.flags.PrintAsyncEventsHandlerStatistics.set(true);
+    handler->statistics.registeredEvents = 4;
+    handler->statistics.heapCompletedEvents = 2;
+    handler->statistics.polledEventUpdates = 5;
+    handler->statistics.totalCallbackLatencyNs = 300;
+    handler->statistics.maxCallbackLatencyNs = 200;
+
+    testing::internal::CaptureStdout();
+    handler->printStatistics();
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_EQ("AsyncEventsHandler: registered 4, completed by tag 2, polled updates 5, callback latency avg 150 ns, max 200 ns\n", output);
+}
@@ -14,6 +14,7 @@
 #include "shared/test/common/mocks/mock_allocation_properties.h"
 #include "shared/test/common/test_macros/test_checks_shared.h"
 
+#include "opencl/source/event/event_unblock_batch.h"
 #include "opencl/source/helpers/task_information.h"
 #include "opencl/test/unit_test/command_queue/enqueue_fixture.h"
 #include "opencl/test/unit_test/mocks/mock_event.h"
@@ -789,6 +790,58 @@ TEST_F(MockEventTests, givenBlockedQueueThenCommandStreamDoesNotChangeWhileEnque
     EXPECT_EQ(CL_SUCCESS, retVal);
 }
 
+HWTEST_F(MockEventTests, givenEventUnblockBatchingEnabledWhenUserEventUnblocksEnqueuesThenCommandsAreFlushedInSingleBatch) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableEventUnblockBatching.set(1);
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.overrideDispatchPolicy(DispatchMode::immediateDispatch);
+
+    uEvent = makeReleaseable<UserEvent>(context);
+    cl_event eventWaitList[] = {uEvent.get()};
+    int sizeOfWaitList = sizeof(eventWaitList) / sizeof(cl_event);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        retVal = callOneWorkItemNDRKernel(eventWaitList, sizeOfWaitList);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+    }
+    auto taskCountBeforeUnblock = csr.peekTaskCount();
+    csr.flushBatchedSubmissionsCalled = false;
+
+    uEvent->setStatus(CL_COMPLETE);
+
+    EXPECT_EQ(taskCountBeforeUnblock + 3, csr.peekTaskCount());
+    EXPECT_TRUE(csr.flushBatchedSubmissionsCalled);
+    EXPECT_EQ(csr.peekTaskCount(), csr.peekLatestFlushedTaskCount());
+    EXPECT_EQ(DispatchMode::immediateDispatch, csr.dispatchMode);
+    EXPECT_EQ(nullptr, EventUnblockBatch::getActive());
+}
+
+HWTEST_F(MockEventTests, givenEventUnblockBatchingDisabledWhenUserEventUnblocksEnqueuesThenBatchedSubmissionsAreNotUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableEventUnblockBatching.set(0);
+
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    csr.overrideDispatchPolicy(DispatchMode::immediateDispatch);
+
+    uEvent = makeReleaseable<UserEvent>(context);
+    cl_event eventWaitList[] = {uEvent.get()};
+    int sizeOfWaitList = sizeof(eventWaitList) / sizeof(cl_event);
+
+    for (uint32_t i = 0; i < 3; i++) {
+        retVal = callOneWorkItemNDRKernel(eventWaitList, sizeOfWaitList);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+    }
+    auto taskCountBeforeUnblock = csr.peekTaskCount();
+    csr.flushBatchedSubmissionsCalled = false;
+
+    uEvent->setStatus(CL_COMPLETE);
+
+    EXPECT_EQ(taskCountBeforeUnblock + 3, csr.peekTaskCount());
+    EXPECT_FALSE(csr.flushBatchedSubmissionsCalled);
+    EXPECT_EQ(csr.peekTaskCount(), csr.peekLatestFlushedTaskCount());
+}
+
 TEST_F(EventTests, givenUserEventThatHasCallbackAndBlockQueueWhenQueueIsQueriedForBlockedThenCallBackIsCalled) {
     DebugManagerStateRestore dbgRestore;
     debugManager.flags.EnableAsyncEventsHandler.set(false);
@@ -5,6 +5,9 @@
  *
  */
 
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/test_macros/hw_test.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "opencl/source/helpers/dispatch_info_builder.h"
@@ -1015,4 +1018,45 @@ TEST_F(DispatchInfoBuilderTest, WhengDimensionIsNotMatchingGWSThenDimensionPasse
     }
 }
 
+HWTEST_F(DispatchInfoBuilderTest, givenLocalWorkSizeAutotuneEnabledWhenBakingUserKernelWithoutLwsThenCandidateLwsIsUsedAndTrialIsMarked) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableLocalWorkSizeAutotune.set(1);
+    debugManager.flags.LocalWorkSizeAutotuneCacheFile.set("");
+    pDevice->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+    pKernel->isBuiltIn = false;
+
+    Vec3<size_t> lws[2] = {{0, 0, 0}, {0, 0, 0}};
+    for (auto &bakedLws : lws) {
+        MultiDispatchInfo mdi;
+        DispatchInfoBuilder<SplitDispatch::Dim::d1D, SplitDispatch::SplitMode::walkerSplit> diBuilder(*pClDevice);
+        diBuilder.setDispatchGeometry(Vec3<size_t>(256, 1, 1), Vec3<size_t>(0, 0, 0), Vec3<size_t>(0, 0, 0));
+        diBuilder.setKernel(pKernel);
+        diBuilder.bake(mdi);
+
+        ASSERT_EQ(1u, mdi.size());
+        auto &trial = mdi.begin()->peekLwsAutotuneTrial();
+        ASSERT_TRUE(trial.has_value());
+        bakedLws = mdi.begin()->getLocalWorkgroupSize();
+        EXPECT_EQ(bakedLws, trial->lws);
+        EXPECT_EQ(Vec3<size_t>(256, 1, 1), trial->key.gws);
+    }
+    EXPECT_NE(lws[0], lws[1]);
+}
+
+HWTEST_F(DispatchInfoBuilderTest, givenLocalWorkSizeAutotuneEnabledWhenBakingBuiltinKernelThenTrialIsNotMarked) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableLocalWorkSizeAutotune.set(1);
+    debugManager.flags.LocalWorkSizeAutotuneCacheFile.set("");
+    pDevice->getUltCommandStreamReceiver<FamilyType>().timestampPacketWriteEnabled = true;
+
+    MultiDispatchInfo mdi;
+    DispatchInfoBuilder<SplitDispatch::Dim::d1D, SplitDispatch::SplitMode::walkerSplit> diBuilder(*pClDevice);
+    diBuilder.setDispatchGeometry(Vec3<size_t>(256, 1, 1), Vec3<size_t>(0, 0, 0), Vec3<size_t>(0, 0, 0));
+    diBuilder.setKernel(pKernel);
+    diBuilder.bake(mdi);
+
+    ASSERT_EQ(1u, mdi.size());
+    EXPECT_FALSE(mdi.begin()->peekLwsAutotuneTrial().has_value());
+}
+
 } // namespace NEO
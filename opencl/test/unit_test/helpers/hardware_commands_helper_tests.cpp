@@ -901,6 +901,119 @@ HWTEST2_F(HardwareCommandsTest, givenNoBTEntriesInKernelDescriptorAndGTPinInitia
     isGTPinInitialized = false;
 }
 
+template <typename FamilyType>
+std::unique_ptr<MockKernel> createKernelWithTwoBindingTableStates(MockKernelInfo &kernelInfo, MockProgram &program, ClDevice &clDevice, char *surfaceStateHeap, size_t surfaceStateHeapSize) {
+    using BINDING_TABLE_STATE = typename FamilyType::BINDING_TABLE_STATE;
+    using RENDER_SURFACE_STATE = typename FamilyType::RENDER_SURFACE_STATE;
+
+    constexpr auto bindingTableOffset = 2 * sizeof(RENDER_SURFACE_STATE);
+    memset(surfaceStateHeap, 0xA, surfaceStateHeapSize);
+    auto bindingTable = reinterpret_cast<BINDING_TABLE_STATE *>(ptrOffset(surfaceStateHeap, bindingTableOffset));
+    for (uint32_t i = 0; i < 2; i++) {
+        bindingTable[i] = FamilyType::cmdInitBindingTableState;
+        bindingTable[i].setSurfaceStatePointer(i * sizeof(RENDER_SURFACE_STATE));
+    }
+
+    kernelInfo.kernelDescriptor.kernelAttributes.simdSize = 1;
+    kernelInfo.heapInfo.pSsh = surfaceStateHeap;
+    kernelInfo.heapInfo.surfaceStateHeapSize = static_cast<uint32_t>(surfaceStateHeapSize);
+    kernelInfo.setBindingTable(static_cast<SurfaceStateHeapOffset>(bindingTableOffset), 2);
+
+    auto kernel = std::make_unique<MockKernel>(&program, kernelInfo, clDevice);
+    EXPECT_EQ(CL_SUCCESS, kernel->initialize());
+    return kernel;
+}
+
+HWTEST2_F(HardwareCommandsTest, givenSurfaceStateBlockReuseEnabledAndUnchangedSurfaceStatesWhenSettingBTPointerAgainThenEmittedBlockIsReused, IsHeapfulSupported) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableSurfaceStateBlockReuse.set(1);
+
+    MockKernelInfo kernelInfo;
+    MockContext context;
+    MockProgram program(&context, false, toClDeviceVector(*pClDevice));
+    alignas(64) char surfaceStateHeap[256];
+    auto pKernel = createKernelWithTwoBindingTableStates<FamilyType>(kernelInfo, program, *pClDevice, surfaceStateHeap, sizeof(surfaceStateHeap));
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::Type::surfaceState, 8192);
+    ssh.getSpace(FamilyType::cacheLineSize);
+
+    auto dstBindingTablePointer = HardwareCommandsHelper<FamilyType>::checkForAdditionalBTAndSetBTPointer(ssh, *pKernel);
+    auto usedAfterFirstCall = ssh.getUsed();
+    EXPECT_NE(0u, dstBindingTablePointer);
+
+    EXPECT_EQ(dstBindingTablePointer, HardwareCommandsHelper<FamilyType>::checkForAdditionalBTAndSetBTPointer(ssh, *pKernel));
+    EXPECT_EQ(usedAfterFirstCall, ssh.getUsed());
+}
+
+HWTEST2_F(HardwareCommandsTest, givenSurfaceStateBlockReuseEnabledAndChangedSurfaceStateWhenSettingBTPointerAgainThenNewBlockIsEmitted, IsHeapfulSupported) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableSurfaceStateBlockReuse.set(1);
+
+    MockKernelInfo kernelInfo;
+    MockContext context;
+    MockProgram program(&context, false, toClDeviceVector(*pClDevice));
+    alignas(64) char surfaceStateHeap[256];
+    auto pKernel = createKernelWithTwoBindingTableStates<FamilyType>(kernelInfo, program, *pClDevice, surfaceStateHeap, sizeof(surfaceStateHeap));
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::Type::surfaceState, 8192);
+    ssh.getSpace(FamilyType::cacheLineSize);
+
+    auto dstBindingTablePointer = HardwareCommandsHelper<FamilyType>::checkForAdditionalBTAndSetBTPointer(ssh, *pKernel);
+    auto usedAfterFirstCall = ssh.getUsed();
+
+    static_cast<char *>(pKernel->getSurfaceStateHeap())[0] = 0xB;
+    pKernel->markSurfaceStateHeapModified();
+
+    auto newBindingTablePointer = HardwareCommandsHelper<FamilyType>::checkForAdditionalBTAndSetBTPointer(ssh, *pKernel);
+    EXPECT_NE(dstBindingTablePointer, newBindingTablePointer);
+    EXPECT_LT(usedAfterFirstCall, ssh.getUsed());
+
+    auto usedAfterSecondCall = ssh.getUsed();
+    EXPECT_EQ(newBindingTablePointer, HardwareCommandsHelper<FamilyType>::checkForAdditionalBTAndSetBTPointer(ssh, *pKernel));
+    EXPECT_EQ(usedAfterSecondCall, ssh.getUsed());
+}
+
+HWTEST2_F(HardwareCommandsTest, givenSurfaceStateBlockReuseEnabledAndReplacedHeapBufferWhenSettingBTPointerAgainThenNewBlockIsEmitted, IsHeapfulSupported) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableSurfaceStateBlockReuse.set(1);
+
+    MockKernelInfo kernelInfo;
+    MockContext context;
+    MockProgram program(&context, false, toClDeviceVector(*pClDevice));
+    alignas(64) char surfaceStateHeap[256];
+    auto pKernel = createKernelWithTwoBindingTableStates<FamilyType>(kernelInfo, program, *pClDevice, surfaceStateHeap, sizeof(surfaceStateHeap));
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::Type::surfaceState, 8192);
+    ssh.getSpace(FamilyType::cacheLineSize);
+
+    HardwareCommandsHelper<FamilyType>::checkForAdditionalBTAndSetBTPointer(ssh, *pKernel);
+
+    ssh.replaceBuffer(ssh.getCpuBase(), ssh.getMaxAvailableSpace());
+    HardwareCommandsHelper<FamilyType>::checkForAdditionalBTAndSetBTPointer(ssh, *pKernel);
+    EXPECT_NE(0u, ssh.getUsed());
+}
+
+HWTEST2_F(HardwareCommandsTest, givenSurfaceStateBlockReuseDisabledWhenSettingBTPointerAgainThenNewBlockIsEmitted, IsHeapfulSupported) {
+    MockKernelInfo kernelInfo;
+    MockContext context;
+    MockProgram program(&context, false, toClDeviceVector(*pClDevice));
+    alignas(64) char surfaceStateHeap[256];
+    auto pKernel = createKernelWithTwoBindingTableStates<FamilyType>(kernelInfo, program, *pClDevice, surfaceStateHeap, sizeof(surfaceStateHeap));
+
+    CommandQueueHw<FamilyType> cmdQ(nullptr, pClDevice, 0, false);
+    auto &ssh = cmdQ.getIndirectHeap(IndirectHeap::Type::surfaceState, 8192);
+    ssh.getSpace(FamilyType::cacheLineSize);
+
+    auto dstBindingTablePointer = HardwareCommandsHelper<FamilyType>::checkForAdditionalBTAndSetBTPointer(ssh, *pKernel);
+    auto usedAfterFirstCall = ssh.getUsed();
+
+    EXPECT_NE(dstBindingTablePointer, HardwareCommandsHelper<FamilyType>::checkForAdditionalBTAndSetBTPointer(ssh, *pKernel));
+    EXPECT_LT(usedAfterFirstCall, ssh.getUsed());
+}
+
 HWCMDTEST_F(IGFX_GEN12LP_CORE, HardwareCommandsTest, GivenKernelWithInvalidSamplerStateArrayWhenSendIndirectStateIsCalledThenInterfaceDescriptorIsNotPopulated) {
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
     using GPGPU_WALKER = typename FamilyType::GPGPU_WALKER;
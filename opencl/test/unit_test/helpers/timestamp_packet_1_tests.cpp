@@ -10,6 +10,7 @@
 #include "shared/source/utilities/tag_allocator.h"
 #include "shared/source/utilities/wait_util.h"
 #include "shared/test/common/cmd_parse/hw_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/dispatch_flags_helper.h"
 #include "shared/test/common/mocks/mock_csr.h"
 #include "shared/test/common/mocks/mock_device.h"
@@ -137,6 +138,44 @@ HWTEST_F(TimestampPacketTests, givenCrossCsrDependenciesWhenFillCsrDepsThenFlush
     *mockCmdQ2->getUltCommandStreamReceiver().tagAddress = 1;
 }
 
+HWTEST_F(TimestampPacketTests, givenEventsFromSameInOrderQueueWhenFillingCsrDependenciesThenOnlyEventsWithLatestTaskCountAreAdded) {
+    DebugManagerStateRestore restorer;
+    auto mockCmdQHw = std::make_unique<MockCommandQueueHw<FamilyType>>(context, device.get(), nullptr);
+    auto &csr = mockCmdQHw->getGpgpuCommandStreamReceiver();
+
+    MockTimestampPacketContainer timestamp1(*csr.getTimestampPacketAllocator(), 1);
+    MockTimestampPacketContainer timestamp2(*csr.getTimestampPacketAllocator(), 1);
+    MockTimestampPacketContainer timestamp3(*csr.getTimestampPacketAllocator(), 1);
+    MockTimestampPacketContainer timestamp4(*csr.getTimestampPacketAllocator(), 1);
+
+    Event event1(mockCmdQHw.get(), 0, 0, 1);
+    event1.addTimestampPacketNodes(timestamp1);
+    Event event2(mockCmdQHw.get(), 0, 0, 3);
+    event2.addTimestampPacketNodes(timestamp2);
+    Event event3(mockCmdQHw.get(), 0, 0, 2);
+    event3.addTimestampPacketNodes(timestamp3);
+    Event event4(mockCmdQHw.get(), 0, 0, 3);
+    event4.addTimestampPacketNodes(timestamp4);
+
+    cl_event waitlist[] = {&event1, &event2, &event3, &event4};
+    EventsRequest eventsRequest(4, waitlist, nullptr);
+
+    {
+        debugManager.flags.EnableWaitListCompaction.set(0);
+        CsrDependencies csrDeps;
+        eventsRequest.fillCsrDependenciesForTimestampPacketContainer(csrDeps, csr, CsrDependencies::DependenciesType::all);
+        EXPECT_EQ(4u, csrDeps.timestampPacketContainer.size());
+    }
+    {
+        debugManager.flags.EnableWaitListCompaction.set(1);
+        CsrDependencies csrDeps;
+        eventsRequest.fillCsrDependenciesForTimestampPacketContainer(csrDeps, csr, CsrDependencies::DependenciesType::all);
+        ASSERT_EQ(2u, csrDeps.timestampPacketContainer.size());
+        EXPECT_EQ(event2.getTimestampPacketNodes(), csrDeps.timestampPacketContainer[0]);
+        EXPECT_EQ(event4.getTimestampPacketNodes(), csrDeps.timestampPacketContainer[1]);
+    }
+}
+
 HWTEST_F(TimestampPacketTests, givenCrossCsrDependenciesWhenFillCsrDepsThendependentCsrIsStoredInSet) {
     auto mockCmdQHw = std::make_unique<MockCommandQueueHw<FamilyType>>(context, device.get(), nullptr);
     mockCmdQHw->getUltCommandStreamReceiver().timestampPacketWriteEnabled = true;
@@ -93,6 +93,22 @@ TEST_F(KernelArgSvmTest, GivenValidSvmPtrWhenSettingKernelArgThenSvmPtrIsCorrect
     delete[] svmPtr;
 }
 
+TEST_F(KernelArgSvmTest, GivenSvmPtrWhenSettingKernelArgThenSurfaceStateHeapGenerationIsBumped) {
+    const ClDeviceInfo &devInfo = pClDevice->getDeviceInfo();
+    if (devInfo.svmCapabilities == 0) {
+        GTEST_SKIP();
+    }
+    char svmPtr[256];
+
+    auto generation = pKernel->getSurfaceStateHeapGeneration();
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArgSvm(0, 256, svmPtr, nullptr, 0u));
+    EXPECT_NE(generation, pKernel->getSurfaceStateHeapGeneration());
+
+    generation = pKernel->getSurfaceStateHeapGeneration();
+    EXPECT_EQ(CL_SUCCESS, pKernel->setArgSvmAlloc(0, svmPtr, nullptr, 0u));
+    EXPECT_NE(generation, pKernel->getSurfaceStateHeapGeneration());
+}
+
 HWTEST_F(KernelArgSvmTest, GivenSvmPtrStatefulWhenSettingKernelArgThenArgumentsAreSetCorrectly) {
     const ClDeviceInfo &devInfo = pClDevice->getDeviceInfo();
     if (devInfo.svmCapabilities == 0) {
@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/buffer_pool_allocator.inl"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "opencl/source/command_queue/command_queue.h"
+#include "opencl/source/helpers/cl_memory_properties_helpers.h"
+#include "opencl/source/mem_obj/buffer.h"
+#include "opencl/source/mem_obj/image.h"
+#include "opencl/test/unit_test/fixtures/cl_device_fixture.h"
+#include "opencl/test/unit_test/mocks/mock_cl_device.h"
+#include "opencl/test/unit_test/mocks/mock_context.h"
+
+using namespace NEO;
+
+class ImagePoolAllocatorTest : public ClDeviceFixture, public ::testing::Test {
+  public:
+    using MockImagePoolAllocator = MockContext::MockImagePoolAllocator;
+
+    void SetUp() override {
+        debugManager.flags.ExperimentalSmallImagePoolAllocator.set(1);
+        debugManager.flags.ForceLinearImages.set(true);
+        ClDeviceFixture::setUp();
+        pDevice->updateMaxPoolCount(2u);
+        context = std::make_unique<MockContext>(pClDevice);
+        poolAllocator = static_cast<MockImagePoolAllocator *>(&context->getImagePoolAllocator());
+
+        imageFormat.image_channel_data_type = CL_UNORM_INT8;
+        imageFormat.image_channel_order = CL_RGBA;
+
+        imageDesc.image_type = CL_MEM_OBJECT_IMAGE2D;
+        imageDesc.image_width = 16;
+        imageDesc.image_height = 16;
+    }
+
+    void TearDown() override {
+        context.reset();
+        ClDeviceFixture::tearDown();
+    }
+
+    Image *createImage(cl_mem_flags flags, const void *hostPtr) {
+        auto surfaceFormat = Image::getSurfaceFormatFromTable(flags, &imageFormat, pClDevice->getHardwareInfo().capabilityTable.supportsOcl21Features);
+        return Image::create(context.get(), ClMemoryPropertiesHelper::createMemoryProperties(flags, 0, 0, pDevice),
+                             flags, 0, surfaceFormat, &imageDesc, hostPtr, retVal);
+    }
+
+    static uint64_t getImageOffset(Image *image) {
+        SurfaceOffsets surfaceOffsets = {};
+        image->getSurfaceOffsets(surfaceOffsets);
+        return surfaceOffsets.offset;
+    }
+
+    DebugManagerStateRestore restorer;
+    std::unique_ptr<MockContext> context;
+    MockImagePoolAllocator *poolAllocator = nullptr;
+    cl_image_format imageFormat = {};
+    cl_image_desc imageDesc = {};
+    cl_int retVal = CL_SUCCESS;
+};
+
+TEST_F(ImagePoolAllocatorTest, givenDefaultFlagValueWhenCheckingIfImagePoolIsEnabledThenReturnFalse) {
+    debugManager.flags.ExperimentalSmallImagePoolAllocator.set(-1);
+    EXPECT_FALSE(poolAllocator->isImagePoolEnabled(context.get()));
+
+    debugManager.flags.ExperimentalSmallImagePoolAllocator.set(0);
+    EXPECT_FALSE(poolAllocator->isImagePoolEnabled(context.get()));
+
+    debugManager.flags.ExperimentalSmallImagePoolAllocator.set(1);
+    EXPECT_TRUE(poolAllocator->isImagePoolEnabled(context.get()));
+}
+
+TEST_F(ImagePoolAllocatorTest, givenImagePoolDisabledWhenSmallLinearImageIsCreatedThenItHasOwnAllocation) {
+    debugManager.flags.ExperimentalSmallImagePoolAllocator.set(0);
+
+    std::unique_ptr<Image> image(createImage(CL_MEM_READ_WRITE, nullptr));
+    ASSERT_NE(nullptr, image);
+    EXPECT_EQ(0u, poolAllocator->getPoolsCount());
+    EXPECT_EQ(nullptr, image->getAssociatedMemObject());
+    EXPECT_EQ(AllocationType::image, image->getGraphicsAllocation(pDevice->getRootDeviceIndex())->getAllocationType());
+}
+
+TEST_F(ImagePoolAllocatorTest, givenImagePoolEnabledWhenSmallLinearImagesAreCreatedThenTheyShareStorageWithDifferentOffsets) {
+    std::unique_ptr<Image> image1(createImage(CL_MEM_READ_WRITE, nullptr));
+    std::unique_ptr<Image> image2(createImage(CL_MEM_READ_WRITE, nullptr));
+    ASSERT_NE(nullptr, image1);
+    ASSERT_NE(nullptr, image2);
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+
+    auto rootDeviceIndex = pDevice->getRootDeviceIndex();
+    auto poolAllocation = poolAllocator->bufferPools[0].mainStorage->getGraphicsAllocation(rootDeviceIndex);
+    EXPECT_EQ(poolAllocation, image1->getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(poolAllocation, image2->getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_NE(getImageOffset(image1.get()), getImageOffset(image2.get()));
+    EXPECT_TRUE(isAligned(getImageOffset(image1.get()), MemoryConstants::pageSize));
+    EXPECT_TRUE(isAligned(getImageOffset(image2.get()), MemoryConstants::pageSize));
+
+    EXPECT_EQ(alignUp(16u * 4u, MemoryConstants::cacheLineSize), image1->getImageDesc().image_row_pitch);
+    EXPECT_TRUE(image1->isStorageFromImagePool());
+    EXPECT_TRUE(image2->isStorageFromImagePool());
+}
+
+TEST_F(ImagePoolAllocatorTest, givenImageFromPoolWhenQueryingParentObjectsThenPoolStorageIsNotExposed) {
+    std::unique_ptr<Image> image(createImage(CL_MEM_READ_WRITE, nullptr));
+    ASSERT_NE(nullptr, image);
+    ASSERT_TRUE(image->isStorageFromImagePool());
+
+    cl_mem associatedMemObject = reinterpret_cast<cl_mem>(0x1234);
+    EXPECT_EQ(CL_SUCCESS, image->getMemObjectInfo(CL_MEM_ASSOCIATED_MEMOBJECT, sizeof(associatedMemObject), &associatedMemObject, nullptr));
+    EXPECT_EQ(nullptr, associatedMemObject);
+
+    size_t offset = 1u;
+    EXPECT_EQ(CL_SUCCESS, image->getMemObjectInfo(CL_MEM_OFFSET, sizeof(offset), &offset, nullptr));
+    EXPECT_EQ(0u, offset);
+
+    cl_mem imageBuffer = reinterpret_cast<cl_mem>(0x1234);
+    EXPECT_EQ(CL_SUCCESS, image->getImageInfo(CL_IMAGE_BUFFER, sizeof(imageBuffer), &imageBuffer, nullptr));
+    EXPECT_EQ(nullptr, imageBuffer);
+}
+
+TEST_F(ImagePoolAllocatorTest, givenImageFromPoolWhenItIsReleasedThenItsSlotIsRecycled) {
+    auto image = createImage(CL_MEM_READ_WRITE, nullptr);
+    ASSERT_NE(nullptr, image);
+    const auto offset = getImageOffset(image);
+
+    image->release();
+    auto &imagePool = poolAllocator->bufferPools[0];
+    ASSERT_EQ(1u, imagePool.chunksToFree.size());
+    EXPECT_EQ(offset, imagePool.chunksToFree[0].first);
+
+    poolAllocator->drain();
+    EXPECT_EQ(0u, imagePool.chunksToFree.size());
+
+    std::unique_ptr<Image> reusedImage(createImage(CL_MEM_READ_WRITE, nullptr));
+    ASSERT_NE(nullptr, reusedImage);
+    EXPECT_EQ(offset, getImageOffset(reusedImage.get()));
+    EXPECT_EQ(1u, poolAllocator->getPoolsCount());
+}
+
+TEST_F(ImagePoolAllocatorTest, givenImageFromPoolCreatedWithCopyHostPtrThenDataIsWrittenAtImageOffset) {
+    std::unique_ptr<Image> image1(createImage(CL_MEM_READ_WRITE, nullptr));
+    ASSERT_NE(nullptr, image1);
+
+    uint8_t hostData[16 * 16 * 4];
+    memset(hostData, 0xAB, sizeof(hostData));
+    std::unique_ptr<Image> image2(createImage(CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, hostData));
+    ASSERT_NE(nullptr, image2);
+    ASSERT_TRUE(image2->isStorageFromImagePool());
+
+    auto allocation = image2->getGraphicsAllocation(pDevice->getRootDeviceIndex());
+    auto imageStorage = ptrOffset(static_cast<uint8_t *>(allocation->getUnderlyingBuffer()), getImageOffset(image2.get()));
+    EXPECT_EQ(0, memcmp(imageStorage, hostData, 16 * 4));
+}
+
+TEST_F(ImagePoolAllocatorTest, givenImageNotSuitableForPoolWhenCreatingImageThenPoolIsNotUsed) {
+    {
+        debugManager.flags.ForceLinearImages.set(false);
+        std::unique_ptr<Image> image(createImage(CL_MEM_READ_WRITE, nullptr));
+        ASSERT_NE(nullptr, image);
+        EXPECT_EQ(image->isTiledAllocation(), !image->isStorageFromImagePool());
+        debugManager.flags.ForceLinearImages.set(true);
+    }
+    {
+        uint8_t hostData[16 * 16 * 4];
+        std::unique_ptr<Image> image(createImage(CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, hostData));
+        ASSERT_NE(nullptr, image);
+        EXPECT_FALSE(image->isStorageFromImagePool());
+    }
+    {
+        imageDesc.image_width = 1024;
+        imageDesc.image_height = 1024;
+        std::unique_ptr<Image> image(createImage(CL_MEM_READ_WRITE, nullptr));
+        ASSERT_NE(nullptr, image);
+        EXPECT_FALSE(image->isStorageFromImagePool());
+    }
+    {
+        imageDesc.image_type = CL_MEM_OBJECT_IMAGE2D_ARRAY;
+        imageDesc.image_width = 16;
+        imageDesc.image_height = 16;
+        imageDesc.image_array_size = 2;
+        std::unique_ptr<Image> image(createImage(CL_MEM_READ_WRITE, nullptr));
+        ASSERT_NE(nullptr, image);
+        EXPECT_FALSE(image->isStorageFromImagePool());
+    }
+}
+
+TEST_F(ImagePoolAllocatorTest, givenPoolCountLimitReachedWhenImagePoolIsFullThenImageGetsOwnAllocation) {
+    pDevice->updateMaxPoolCount(0u);
+
+    std::unique_ptr<Image> image(createImage(CL_MEM_READ_WRITE, nullptr));
+    ASSERT_NE(nullptr, image);
+    EXPECT_EQ(0u, poolAllocator->getPoolsCount());
+    EXPECT_FALSE(image->isStorageFromImagePool());
+    EXPECT_EQ(AllocationType::image, image->getGraphicsAllocation(pDevice->getRootDeviceIndex())->getAllocationType());
+}
+
+TEST_F(ImagePoolAllocatorTest, givenTwoImagesFromPoolWhenMappedOnCpuThenEachMapPointsToOwnChunk) {
+    std::unique_ptr<Image> image1(createImage(CL_MEM_READ_WRITE, nullptr));
+    std::unique_ptr<Image> image2(createImage(CL_MEM_READ_WRITE, nullptr));
+    ASSERT_NE(nullptr, image1);
+    ASSERT_NE(nullptr, image2);
+    ASSERT_TRUE(image1->isStorageFromImagePool());
+    ASSERT_TRUE(image2->isStorageFromImagePool());
+    if (!image1->mappingOnCpuAllowed()) {
+        GTEST_SKIP();
+    }
+
+    auto poolStorage = static_cast<uint8_t *>(image1->getGraphicsAllocation(pDevice->getRootDeviceIndex())->getUnderlyingBuffer());
+    EXPECT_EQ(ptrOffset(poolStorage, getImageOffset(image1.get())), image1->getCpuAddress());
+    EXPECT_EQ(ptrOffset(poolStorage, getImageOffset(image2.get())), image2->getCpuAddress());
+
+    std::unique_ptr<CommandQueue> commandQueue(CommandQueue::create(context.get(), pClDevice, nullptr, false, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    const size_t origin[3] = {0, 1, 0};
+    const size_t region[3] = {1, 1, 1};
+    auto mappedPtr1 = commandQueue->enqueueMapImage(image1.get(), CL_TRUE, CL_MAP_WRITE, origin, region, nullptr, nullptr, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    auto mappedPtr2 = commandQueue->enqueueMapImage(image2.get(), CL_TRUE, CL_MAP_WRITE, origin, region, nullptr, nullptr, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    const auto rowPitch = image1->getImageDesc().image_row_pitch;
+    EXPECT_EQ(ptrOffset(image1->getCpuAddress(), rowPitch), mappedPtr1);
+    EXPECT_EQ(ptrOffset(image2->getCpuAddress(), rowPitch), mappedPtr2);
+
+    memset(mappedPtr1, 0x11, 4);
+    memset(mappedPtr2, 0x22, 4);
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueUnmapMemObject(image1.get(), mappedPtr1, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueUnmapMemObject(image2.get(), mappedPtr2, 0, nullptr, nullptr));
+
+    EXPECT_EQ(0x11, *ptrOffset(poolStorage, getImageOffset(image1.get()) + rowPitch));
+    EXPECT_EQ(0x22, *ptrOffset(poolStorage, getImageOffset(image2.get()) + rowPitch));
+}
+
+TEST_F(ImagePoolAllocatorTest, givenTwoImagesFromPoolWhenMappedOnGpuThenEachImageHasOwnMapStorage) {
+    debugManager.flags.DisableZeroCopyForBuffers.set(1);
+
+    std::unique_ptr<Image> image1(createImage(CL_MEM_READ_WRITE, nullptr));
+    std::unique_ptr<Image> image2(createImage(CL_MEM_READ_WRITE, nullptr));
+    ASSERT_NE(nullptr, image1);
+    ASSERT_NE(nullptr, image2);
+    ASSERT_TRUE(image1->isStorageFromImagePool());
+    ASSERT_TRUE(image2->isStorageFromImagePool());
+    EXPECT_FALSE(image1->mappingOnCpuAllowed());
+
+    std::unique_ptr<CommandQueue> commandQueue(CommandQueue::create(context.get(), pClDevice, nullptr, false, retVal));
+    ASSERT_EQ(CL_SUCCESS, retVal);
+
+    const size_t origin[3] = {0, 0, 0};
+    const size_t region[3] = {1, 1, 1};
+    auto mappedPtr1 = commandQueue->enqueueMapImage(image1.get(), CL_TRUE, CL_MAP_READ, origin, region, nullptr, nullptr, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    auto mappedPtr2 = commandQueue->enqueueMapImage(image2.get(), CL_TRUE, CL_MAP_READ, origin, region, nullptr, nullptr, 0, nullptr, nullptr, retVal);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+
+    const auto rootDeviceIndex = pDevice->getRootDeviceIndex();
+    ASSERT_NE(nullptr, mappedPtr1);
+    ASSERT_NE(nullptr, mappedPtr2);
+    EXPECT_NE(mappedPtr1, mappedPtr2);
+    EXPECT_EQ(image1->getAllocatedMapPtr(), mappedPtr1);
+    EXPECT_EQ(image2->getAllocatedMapPtr(), mappedPtr2);
+    EXPECT_NE(nullptr, image1->getMapAllocation(rootDeviceIndex));
+    EXPECT_NE(image1->getMapAllocation(rootDeviceIndex), image2->getMapAllocation(rootDeviceIndex));
+    EXPECT_EQ(nullptr, poolAllocator->bufferPools[0].mainStorage->getAllocatedMapPtr());
+
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueUnmapMemObject(image1.get(), mappedPtr1, 0, nullptr, nullptr));
+    EXPECT_EQ(CL_SUCCESS, commandQueue->enqueueUnmapMemObject(image2.get(), mappedPtr2, 0, nullptr, nullptr));
+    commandQueue->finish();
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2024 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -12,6 +12,7 @@
 #include "opencl/source/mem_obj/map_operations_handler.h"
 #include "opencl/test/unit_test/mocks/mock_buffer.h"
 
+#include <set>
 #include <tuple>
 
 using namespace NEO;
@@ -19,6 +20,7 @@ using namespace NEO;
 struct MockMapOperationsHandler : public MapOperationsHandler {
     using MapOperationsHandler::isOverlapping;
     using MapOperationsHandler::mappedPointers;
+    using MapOperationsHandler::maxMappedLength;
 };
 
 struct MapOperationsHandlerTests : public ::testing::Test {
@@ -82,27 +84,27 @@ TEST_F(MapOperationsHandlerTests, givenMappedPtrsWhenDoubleRemovedThenDoNothing)
 TEST_F(MapOperationsHandlerTests, givenMapInfoWhenAddedThenSetReadOnlyFlag) {
     mapFlags = CL_MAP_READ;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 
     mapFlags = CL_MAP_READ | CL_MAP_WRITE_INVALIDATE_REGION;
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     mockHandler.remove(mappedPtrs[0].ptr);
 }
 
@@ -112,7 +114,7 @@ TEST_F(MapOperationsHandlerTests, givenNonReadOnlyOverlappingPtrWhenAddingThenRe
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_FALSE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_FALSE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_TRUE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_FALSE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(1u, mockHandler.size());
@@ -124,11 +126,69 @@ TEST_F(MapOperationsHandlerTests, givenReadOnlyOverlappingPtrWhenAddingThenRetur
     mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get());
 
     EXPECT_EQ(1u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
     EXPECT_FALSE(mockHandler.isOverlapping(mappedPtrs[0]));
     EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
     EXPECT_EQ(2u, mockHandler.size());
-    EXPECT_TRUE(mockHandler.mappedPointers.back().readOnly);
+    EXPECT_TRUE(mockHandler.mappedPointers.rbegin()->second.readOnly);
+}
+
+TEST_F(MapOperationsHandlerTests, givenReadOnlyMappingsOfSamePtrWhenRemovingThenOnlyOneMappingIsRemoved) {
+    mapFlags = CL_MAP_READ;
+    EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    EXPECT_TRUE(mockHandler.add(mappedPtrs[0].ptr, mappedPtrs[0].ptrLength, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    EXPECT_EQ(2u, mockHandler.size());
+
+    mockHandler.remove(mappedPtrs[0].ptr);
+    EXPECT_EQ(1u, mockHandler.size());
+
+    MapInfo receivedMapInfo;
+    EXPECT_TRUE(mockHandler.find(mappedPtrs[0].ptr, receivedMapInfo));
+    mockHandler.remove(mappedPtrs[0].ptr);
+    EXPECT_FALSE(mockHandler.find(mappedPtrs[0].ptr, receivedMapInfo));
+    EXPECT_EQ(0u, mockHandler.maxMappedLength);
+}
+
+TEST_F(MapOperationsHandlerTests, givenSlidingWindowMappingsWhenAddingWritableMappingThenOverlapIsDetectedOnlyWithNeighbours) {
+    constexpr size_t windowSize = 0x100;
+    constexpr size_t windowsCount = 64;
+    auto basePtr = reinterpret_cast<void *>(0x10000);
+    mapFlags = CL_MAP_WRITE;
+
+    for (size_t i = 0; i < windowsCount; i += 2) {
+        EXPECT_TRUE(mockHandler.add(ptrOffset(basePtr, i * windowSize), windowSize - 1, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    }
+    EXPECT_EQ(windowsCount / 2, mockHandler.size());
+
+    EXPECT_TRUE(mockHandler.add(ptrOffset(basePtr, windowSize), windowSize - 1, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    EXPECT_FALSE(mockHandler.add(ptrOffset(basePtr, 3 * windowSize - 2), 2, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    EXPECT_FALSE(mockHandler.add(ptrOffset(basePtr, windowsCount * windowSize / 2), 1, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    EXPECT_TRUE(mockHandler.add(ptrOffset(basePtr, windowsCount * windowSize), windowSize, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    EXPECT_EQ(windowsCount / 2 + 2, mockHandler.size());
+}
+
+TEST_F(MapOperationsHandlerTests, givenLongMappingFollowedByShortMappingsWhenFindingInfoForHostPtrThenLongMappingIsFound) {
+    auto basePtr = reinterpret_cast<void *>(0x10000);
+    mapFlags = CL_MAP_READ;
+
+    EXPECT_TRUE(mockHandler.add(basePtr, 0x1000, mapFlags, mappedPtrs[0].size, mappedPtrs[0].offset, 0, allocations[0].get()));
+    for (size_t i = 1; i < 8; i++) {
+        EXPECT_TRUE(mockHandler.add(ptrOffset(basePtr, i * 0x100), 0x10, mapFlags, mappedPtrs[1].size, mappedPtrs[1].offset, 0, allocations[1].get()));
+    }
+
+    MapInfo receivedMapInfo;
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr(ptrOffset(basePtr, 0x900), 0x100, receivedMapInfo));
+    EXPECT_EQ(basePtr, receivedMapInfo.ptr);
+    EXPECT_EQ(allocations[0].get(), receivedMapInfo.graphicsAllocation);
+
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr(ptrOffset(basePtr, 0xF00), 0x101, receivedMapInfo));
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr(reinterpret_cast<void *>(0xFFFF), 1, receivedMapInfo));
+
+    mockHandler.remove(basePtr);
+    EXPECT_FALSE(mockHandler.findInfoForHostPtr(ptrOffset(basePtr, 0x900), 0x100, receivedMapInfo));
+    EXPECT_TRUE(mockHandler.findInfoForHostPtr(ptrOffset(basePtr, 0x700), 0x10, receivedMapInfo));
+    EXPECT_EQ(ptrOffset(basePtr, 0x700), receivedMapInfo.ptr);
+    EXPECT_EQ(allocations[1].get(), receivedMapInfo.graphicsAllocation);
 }
 
 const std::tuple<void *, size_t, void *, size_t, bool> overlappingCombinations[] = {
@@ -170,7 +230,16 @@ INSTANTIATE_TEST_SUITE_P(MapOperationsHandlerOverlapTests,
                          ::testing::ValuesIn(overlappingCombinations));
 
 struct MapOperationsStorageWhitebox : MapOperationsStorage {
-    using MapOperationsStorage::handlers;
+    using MapOperationsStorage::getShardIndex;
+    using MapOperationsStorage::shards;
+
+    size_t getHandlersCount() {
+        size_t handlersCount = 0;
+        for (auto &shard : shards) {
+            handlersCount += shard.handlers.size();
+        }
+        return handlersCount;
+    }
 };
 
 TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIsUsedThenCreateHandler) {
@@ -178,16 +247,16 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIsUsedThen
     MockBuffer buffer2{};
 
     MapOperationsStorageWhitebox storage{};
-    EXPECT_EQ(0u, storage.handlers.size());
+    EXPECT_EQ(0u, storage.getHandlersCount());
 
     storage.getHandler(&buffer1);
-    EXPECT_EQ(1u, storage.handlers.size());
+    EXPECT_EQ(1u, storage.getHandlersCount());
 
     storage.getHandler(&buffer2);
-    EXPECT_EQ(2u, storage.handlers.size());
+    EXPECT_EQ(2u, storage.getHandlersCount());
 
     storage.getHandler(&buffer1);
-    EXPECT_EQ(2u, storage.handlers.size());
+    EXPECT_EQ(2u, storage.getHandlersCount());
 }
 
 TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIfExistsIsUsedThenDoNotCreateHandler) {
@@ -195,17 +264,17 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenGetHandlerIfExistsIs
     MockBuffer buffer2{};
 
     MapOperationsStorageWhitebox storage{};
-    EXPECT_EQ(0u, storage.handlers.size());
+    EXPECT_EQ(0u, storage.getHandlersCount());
     EXPECT_EQ(nullptr, storage.getHandlerIfExists(&buffer1));
     EXPECT_EQ(nullptr, storage.getHandlerIfExists(&buffer2));
 
     storage.getHandler(&buffer1);
-    EXPECT_EQ(1u, storage.handlers.size());
+    EXPECT_EQ(1u, storage.getHandlersCount());
     EXPECT_NE(nullptr, storage.getHandlerIfExists(&buffer1));
     EXPECT_EQ(nullptr, storage.getHandlerIfExists(&buffer2));
 
     storage.getHandler(&buffer2);
-    EXPECT_EQ(2u, storage.handlers.size());
+    EXPECT_EQ(2u, storage.getHandlersCount());
     EXPECT_NE(nullptr, storage.getHandlerIfExists(&buffer1));
     EXPECT_NE(nullptr, storage.getHandlerIfExists(&buffer2));
     EXPECT_NE(storage.getHandlerIfExists(&buffer1), storage.getHandlerIfExists(&buffer2));
@@ -216,8 +285,49 @@ TEST(MapOperationsStorageTest, givenMapOperationsStorageWhenRemoveHandlerIsUsedT
     MapOperationsStorageWhitebox storage{};
 
     storage.getHandler(&buffer);
-    ASSERT_EQ(1u, storage.handlers.size());
+    ASSERT_EQ(1u, storage.getHandlersCount());
 
     storage.removeHandler(&buffer);
-    EXPECT_EQ(0u, storage.handlers.size());
+    EXPECT_EQ(0u, storage.getHandlersCount());
+}
+
+TEST(MapOperationsStorageTest, givenMemObjectsAllocatedOneAfterAnotherWhenGettingHandlersThenTheyAreSpreadOverShards) {
+    std::vector<std::unique_ptr<MockBuffer>> buffers;
+    std::set<size_t> usedShards;
+    for (size_t i = 0; i < 4 * MapOperationsStorage::shardsCount; i++) {
+        buffers.push_back(std::make_unique<MockBuffer>());
+        auto shardIndex = MapOperationsStorageWhitebox::getShardIndex(buffers.back().get());
+        EXPECT_LT(shardIndex, MapOperationsStorage::shardsCount);
+        usedShards.insert(shardIndex);
+    }
+    EXPECT_LT(1u, usedShards.size());
+
+    MapOperationsStorageWhitebox storage{};
+    for (auto &buffer : buffers) {
+        storage.getHandler(buffer.get());
+    }
+    EXPECT_EQ(buffers.size(), storage.getHandlersCount());
+    for (auto &buffer : buffers) {
+        EXPECT_EQ(1u, storage.shards[MapOperationsStorageWhitebox::getShardIndex(buffer.get())].handlers.count(buffer.get()));
+    }
+}
+
+TEST(MapOperationsStorageTest, givenMappingsInDifferentShardsWhenGettingInfoForHostPtrThenMappingIsFound) {
+    MockBuffer buffer1{};
+    MockBuffer buffer2{};
+    MockGraphicsAllocation allocation;
+    MemObjSizeArray size = {{1, 1, 1}};
+    MemObjOffsetArray offset = {{0, 0, 0}};
+    cl_map_flags mapFlags = CL_MAP_WRITE;
+
+    MapOperationsStorageWhitebox storage{};
+    storage.getHandler(&buffer1).add(reinterpret_cast<void *>(0x1000), 0x100, mapFlags, size, offset, 0, &allocation);
+    storage.getHandler(&buffer2).add(reinterpret_cast<void *>(0x2000), 0x100, mapFlags, size, offset, 0, &allocation);
+
+    MapInfo outInfo;
+    EXPECT_TRUE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x2010), 0x10, outInfo));
+    EXPECT_EQ(reinterpret_cast<void *>(0x2000), outInfo.ptr);
+    EXPECT_TRUE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x1000), 0x100, outInfo));
+    EXPECT_EQ(reinterpret_cast<void *>(0x1000), outInfo.ptr);
+    EXPECT_FALSE(storage.getInfoForHostPtr(reinterpret_cast<void *>(0x1800), 0x10, outInfo));
 }
@@ -46,11 +46,13 @@ struct MySharingHandler : public SharingHandler {
         }
     }
 
-    void releaseReusedGraphicsAllocation() override {
+    bool releaseReusedGraphicsAllocation() override {
         auto alloc = getAllocation();
         if (alloc) {
             alloc->decReuseCount();
+            return alloc->peekReuseCount() == 0;
         }
+        return true;
     }
 
     GraphicsAllocation *getAllocation() {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,7 +23,10 @@ class MockHandler : public AsyncEventsHandler {
     using AsyncEventsHandler::allowAsyncProcess;
     using AsyncEventsHandler::asyncMtx;
     using AsyncEventsHandler::asyncProcess;
+    using AsyncEventsHandler::completionHeaps;
     using AsyncEventsHandler::openThread;
+    using AsyncEventsHandler::printStatistics;
+    using AsyncEventsHandler::statistics;
     using AsyncEventsHandler::thread;
 
     ~MockHandler() override {
@@ -57,7 +60,7 @@ class MockHandler : public AsyncEventsHandler {
         openThreadCalled = true;
     }
 
-    bool peekIsListEmpty() { return list.size() == 0; }
+    bool peekIsListEmpty() { return list.size() == 0 && completionHeaps.empty(); }
     bool peekIsRegisterListEmpty() { return registerList.size() == 0; }
     std::atomic<int> transferCounter;
     bool openThreadCalled = false;
@@ -36,6 +36,7 @@ class MockContext : public Context {
     using Context::setupContextType;
     using Context::sharingFunctions;
     using Context::smallBufferPoolAllocator;
+    using Context::smallImagePoolAllocator;
     using Context::specialQueues;
     using Context::svmAllocsManager;
     using Context::usmPoolInitialized;
@@ -65,6 +66,13 @@ class MockContext : public Context {
         using BufferPoolAllocator::params;
     };
 
+    class MockImagePoolAllocator : public ImagePoolAllocator {
+      public:
+        using ImagePoolAllocator::bufferPools;
+        using ImagePoolAllocator::drain;
+        using ImagePoolAllocator::params;
+    };
+
   private:
     ClDevice *pDevice = nullptr;
 };
@@ -21,6 +21,7 @@ class MockOclocArgHelper : public OclocArgHelper {
     using OclocArgHelper::headers;
     using OclocArgHelper::inputs;
     using OclocArgHelper::messagePrinter;
+    using OclocArgHelper::outputs;
 
     using OclocArgHelper::findSourceFile;
 
@@ -11,14 +11,20 @@
 
 #include "opencl/test/unit_test/offline_compiler/mock/mock_argument_helper.h"
 
+#include <atomic>
+#include <map>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <thread>
 
 namespace NEO {
 
 class MockMultiCommand : public MultiCommand {
   public:
     using MultiCommand::argHelper;
+    using MultiCommand::buildWallTimesInMs;
+    using MultiCommand::jobsCount;
     using MultiCommand::lines;
     using MultiCommand::quiet;
     using MultiCommand::retValues;
@@ -40,20 +46,39 @@ class MockMultiCommand : public MultiCommand {
 
     ~MockMultiCommand() override = default;
 
-    int singleBuild(const std::vector<std::string> &args) override {
+    int singleBuild(const std::vector<std::string> &args, std::string &buildOutFileName) override {
         ++singleBuildCalledCount;
 
         if (callBaseSingleBuild) {
-            return MultiCommand::singleBuild(args);
+            return MultiCommand::singleBuild(args, buildOutFileName);
         }
 
+        if (buildOutFileName == quietAndVerboseBuildOutFileName) {
+            argHelper->getPrinterRef().setSuppressMessages(true);
+            argHelper->setVerbose(true);
+        }
+        if (printOutFileNameInSingleBuild) {
+            argHelper->printf("Building %s\n", buildOutFileName.c_str());
+        }
+        if (saveOutputInSingleBuild) {
+            argHelper->OclocArgHelper::saveOutput(buildOutFileName, buildOutFileName.c_str(), buildOutFileName.size() + 1);
+        }
+        {
+            std::lock_guard<std::mutex> lock(singleBuildThreadsMutex);
+            singleBuildThreads[buildOutFileName] = std::this_thread::get_id();
+        }
         return OCLOC_SUCCESS;
     }
 
     std::map<std::string, std::string> filesMap{};
     std::unique_ptr<MockOclocArgHelper> uniqueHelper{};
-    int singleBuildCalledCount{0};
+    std::atomic<int> singleBuildCalledCount{0};
+    std::mutex singleBuildThreadsMutex;
+    std::map<std::string, std::thread::id> singleBuildThreads;
     bool callBaseSingleBuild{true};
+    bool printOutFileNameInSingleBuild{false};
+    bool saveOutputInSingleBuild{false};
+    std::string quietAndVerboseBuildOutFileName{};
     const std::string clCopybufferFilename = "some_kernel.cl";
     std::string kernelSources = "example_kernel(){}";
 };
@@ -1862,6 +1862,113 @@ TEST_F(OclocFatBinaryTest, givenOutputDirectoryFlagWhenBuildingFatbinaryThenArch
     ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(expectedArchivePath));
 }
 
+TEST_F(OclocFatBinaryTest, givenJobsFlagWhenBuildingFatbinaryThenArchiveIsTheSameAsForSequentialBuild) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+    std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    auto buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OCLOC_SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+    const auto sequentialArchive = mockArgHelper.interceptedFiles[outputArchiveName];
+    mockArgHelper.interceptedFiles.clear();
+
+    args.push_back("-jobs");
+    args.push_back("2");
+    buildResult = buildFatBinary(args, &mockArgHelper);
+    ASSERT_EQ(OCLOC_SUCCESS, buildResult);
+    ASSERT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+
+    EXPECT_EQ(sequentialArchive, mockArgHelper.interceptedFiles[outputArchiveName]);
+}
+
+TEST_F(OclocFatBinaryTest, givenNegativeJobsCountWhenBuildingFatbinaryThenErrorIsReported) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-file",
+        spirvFilename,
+        "-spirv_input",
+        "-jobs",
+        "-1",
+        "-device",
+        devices};
+
+    ::StdoutCapture capture;
+    capture.captureStdout();
+    const auto result = buildFatBinary(args, &mockArgHelper);
+    const auto output{capture.getCapturedStdout()};
+
+    EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, result);
+    EXPECT_EQ(std::string{"Error! Invalid number of jobs: -1\n"}, output);
+}
+
+TEST_F(OclocFatBinaryTest, givenNonNumericJobsCountWhenBuildingFatbinaryThenErrorIsReported) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+
+    for (const auto jobs : {"abc", "2x", ""}) {
+        const std::vector<std::string> args = {
+            "ocloc",
+            "-file",
+            spirvFilename,
+            "-spirv_input",
+            "-jobs",
+            jobs,
+            "-device",
+            devices};
+
+        ::StdoutCapture capture;
+        capture.captureStdout();
+        const auto result = buildFatBinary(args, &mockArgHelper);
+        const auto output{capture.getCapturedStdout()};
+
+        EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, result);
+        EXPECT_EQ(std::string{"Error! Invalid number of jobs: "} + jobs + "\n", output);
+    }
+}
+
+TEST_F(OclocFatBinaryTest, givenJobsFlagBeforeDeviceWhenBuildingFatbinaryThenJobsFlagIsNotPassedToTargetCompilers) {
+    const auto devices = prepareTwoDevices(&mockArgHelper);
+    if (devices.empty()) {
+        GTEST_SKIP();
+    }
+    const std::vector<std::string> args = {
+        "ocloc",
+        "-output",
+        outputArchiveName,
+        "-file",
+        spirvFilename,
+        "-output_no_suffix",
+        "-spirv_input",
+        "-jobs",
+        "1",
+        "-device",
+        devices};
+
+    mockArgHelper.getPrinterRef().setSuppressMessages(true);
+    const auto buildResult = buildFatBinary(args, &mockArgHelper);
+    EXPECT_EQ(OCLOC_SUCCESS, buildResult);
+    EXPECT_EQ(1u, mockArgHelper.interceptedFiles.count(outputArchiveName));
+}
+
 TEST_F(OclocFatBinaryTest, givenSpirvInputAndExcludeIrFlagWhenFatBinaryIsRequestedThenArchiveDoesNotContainGenericIrFile) {
     const auto devices = prepareTwoDevices(&mockArgHelper);
     if (devices.empty()) {
@@ -412,6 +412,12 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -jobs <count>                 Number of commands built concurrently.
+                                Output of each command is printed in
+                                input order once all builds finish.
+                                0 - use all available hardware threads.
+                                Default: 1.
+
 )===";
 
     EXPECT_EQ(expectedOutput, output);
@@ -470,7 +476,7 @@ TEST(MultiCommandWhiteboxTest, GivenCommandLineWithMissingApostropheWhenRunningB
 
     mockMultiCommand.argHelper->getPrinterRef().setSuppressMessages(true);
     mockMultiCommand.runBuilds("ocloc");
-    EXPECT_EQ(0, mockMultiCommand.singleBuildCalledCount);
+    EXPECT_EQ(0, mockMultiCommand.singleBuildCalledCount.load());
 
     ASSERT_EQ(1u, mockMultiCommand.retValues.size());
     EXPECT_EQ(OCLOC_INVALID_FILE, mockMultiCommand.retValues[0]);
@@ -490,7 +496,7 @@ TEST(MultiCommandWhiteboxTest, GivenTwoValidCommandLinesAndVerboseModeWhenRunnin
     mockMultiCommand.runBuilds("ocloc");
     const auto output = capture.getCapturedStdout();
 
-    EXPECT_EQ(2, mockMultiCommand.singleBuildCalledCount);
+    EXPECT_EQ(2, mockMultiCommand.singleBuildCalledCount.load());
 
     ASSERT_EQ(2u, mockMultiCommand.retValues.size());
     EXPECT_EQ(OCLOC_SUCCESS, mockMultiCommand.retValues[0]);
@@ -501,6 +507,161 @@ TEST(MultiCommandWhiteboxTest, GivenTwoValidCommandLinesAndVerboseModeWhenRunnin
     EXPECT_EQ(expectedOutput, output);
 }
 
+TEST(MultiCommandWhiteboxTest, GivenMultipleJobsWhenRunningBuildsThenOutputsAreCapturedPerCommandAndPrintedInInputOrder) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = false;
+    mockMultiCommand.jobsCount = 4;
+    mockMultiCommand.callBaseSingleBuild = false;
+    mockMultiCommand.printOutFileNameInSingleBuild = true;
+
+    const std::string validLine{"-file some_kernel.cl -out_dir SomeOutputDirectory -device " + gEnvironment->devicePrefix};
+    const size_t numberOfCommands = 8;
+    for (size_t i = 0; i < numberOfCommands; ++i) {
+        mockMultiCommand.lines.push_back(validLine);
+    }
+    mockMultiCommand.lines.push_back("-out_dir \"Some Directory");
+
+    StdoutCapture capture;
+    capture.captureStdout();
+    mockMultiCommand.runBuilds("ocloc");
+    const auto output = capture.getCapturedStdout();
+
+    EXPECT_EQ(static_cast<int>(numberOfCommands), mockMultiCommand.singleBuildCalledCount.load());
+
+    std::string expectedOutput{};
+    for (size_t i = 0; i < numberOfCommands; ++i) {
+        expectedOutput += "Command number " + std::to_string(i + 1) + ": \n";
+        expectedOutput += "Building build_no_" + std::to_string(i + 1) + "\n";
+    }
+    expectedOutput += "One of the quotes is open in build number " + std::to_string(numberOfCommands + 1) + "\n";
+    EXPECT_EQ(expectedOutput, output);
+
+    ASSERT_EQ(numberOfCommands + 1, mockMultiCommand.retValues.size());
+    for (size_t i = 0; i < numberOfCommands; ++i) {
+        EXPECT_EQ(OCLOC_SUCCESS, mockMultiCommand.retValues[i]);
+    }
+    EXPECT_EQ(OCLOC_INVALID_FILE, mockMultiCommand.retValues[numberOfCommands]);
+    EXPECT_EQ(numberOfCommands + 1, mockMultiCommand.buildWallTimesInMs.size());
+}
+
+TEST(MultiCommandWhiteboxTest, GivenMultipleJobsAndBuildSuppressingMessagesWhenRunningBuildsThenSuppressionAndVerbosityApplyFromThatBuildInInputOrder) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = false;
+    mockMultiCommand.jobsCount = 4;
+    mockMultiCommand.callBaseSingleBuild = false;
+    mockMultiCommand.printOutFileNameInSingleBuild = true;
+    mockMultiCommand.quietAndVerboseBuildOutFileName = "build_no_2";
+
+    const std::string validLine{"-file some_kernel.cl -out_dir SomeOutputDirectory -device " + gEnvironment->devicePrefix};
+    const size_t numberOfCommands = 4;
+    for (size_t i = 0; i < numberOfCommands; ++i) {
+        mockMultiCommand.lines.push_back(validLine);
+    }
+
+    auto &printer = mockMultiCommand.argHelper->getPrinterRef();
+    StdoutCapture capture;
+    capture.captureStdout();
+    mockMultiCommand.runBuilds("ocloc");
+    const auto output = capture.getCapturedStdout();
+
+    EXPECT_EQ(static_cast<int>(numberOfCommands), mockMultiCommand.singleBuildCalledCount.load());
+
+    const auto expectedOutput{"Command number 1: \n"
+                              "Building build_no_1\n"
+                              "Command number 2: \n"};
+    EXPECT_EQ(expectedOutput, output);
+    EXPECT_NE(std::string::npos, printer.getLog().str().find("Building build_no_4\n"));
+
+    EXPECT_TRUE(printer.isSuppressed());
+    EXPECT_TRUE(mockMultiCommand.argHelper->isVerbose());
+}
+
+TEST(MultiCommandWhiteboxTest, GivenMultipleJobsWhenBuildsSaveOutputsThenOutputsAreAddedInInputOrder) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = true;
+    mockMultiCommand.jobsCount = 4;
+    mockMultiCommand.callBaseSingleBuild = false;
+    mockMultiCommand.saveOutputInSingleBuild = true;
+    mockMultiCommand.uniqueHelper->hasOutput = true;
+
+    const std::string validLine{"-file some_kernel.cl -device " + gEnvironment->devicePrefix};
+    const size_t numberOfCommands = 8;
+    for (size_t i = 0; i < numberOfCommands; ++i) {
+        mockMultiCommand.lines.push_back(validLine);
+    }
+
+    mockMultiCommand.runBuilds("ocloc");
+
+    auto &outputs = mockMultiCommand.uniqueHelper->outputs;
+    ASSERT_EQ(numberOfCommands, outputs.size());
+    for (size_t i = 0; i < numberOfCommands; ++i) {
+        EXPECT_EQ("build_no_" + std::to_string(i + 1), outputs[i]->name);
+    }
+
+    for (auto &output : outputs) {
+        delete[] output->data;
+    }
+    outputs.clear();
+    mockMultiCommand.uniqueHelper->hasOutput = false;
+}
+
+TEST(MultiCommandWhiteboxTest, GivenMultipleJobsAndFatbinaryCommandWhenRunningBuildsThenFatbinaryIsBuiltOnCallingThread) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.quiet = true;
+    mockMultiCommand.jobsCount = 4;
+    mockMultiCommand.callBaseSingleBuild = false;
+
+    const std::string validLine{"-file some_kernel.cl -device " + gEnvironment->devicePrefix};
+    const std::string fatbinaryLine{"-file some_kernel.cl -device " + gEnvironment->devicePrefix + "," + gEnvironment->devicePrefix};
+    mockMultiCommand.lines = {validLine, fatbinaryLine, validLine, validLine};
+
+    mockMultiCommand.runBuilds("ocloc");
+
+    EXPECT_EQ(4, mockMultiCommand.singleBuildCalledCount.load());
+    ASSERT_EQ(1u, mockMultiCommand.singleBuildThreads.count("build_no_2"));
+    EXPECT_EQ(std::this_thread::get_id(), mockMultiCommand.singleBuildThreads["build_no_2"]);
+    EXPECT_EQ(4u, mockMultiCommand.retValues.size());
+}
+
+TEST(MultiCommandWhiteboxTest, GivenBuildWallTimesWhenShowingResultsThenWallTimesArePrintedForEachBuild) {
+    MockMultiCommand mockMultiCommand{};
+    mockMultiCommand.retValues = {OCLOC_SUCCESS, OCLOC_INVALID_FILE};
+    mockMultiCommand.buildWallTimesInMs = {1.5, 2.25};
+    mockMultiCommand.jobsCount = 2;
+    mockMultiCommand.quiet = false;
+
+    StdoutCapture capture;
+    capture.captureStdout();
+    mockMultiCommand.showResults();
+    const auto output = capture.getCapturedStdout();
+
+    const auto expectedOutput{"Build command 0: successful\n"
+                              "Build command 0: wall time: 1.50 ms\n"
+                              "Build command 1: failed. Error code: -5151\n"
+                              "Build command 1: wall time: 2.25 ms\n"
+                              "Total wall time of 2 builds using 2 jobs: 0.00 ms\n"};
+    EXPECT_EQ(expectedOutput, output);
+}
+
+TEST(MultiCommandWhiteboxTest, GivenNegativeJobsCountWhenInitializingThenErrorIsReturned) {
+    MockMultiCommand mockMultiCommand{};
+
+    const std::vector<std::string> args = {
+        "ocloc",
+        "multi",
+        "commands.txt",
+        "-jobs",
+        "-2"};
+
+    StdoutCapture capture;
+    capture.captureStdout();
+    const auto result = mockMultiCommand.initialize(args);
+    const auto output = capture.getCapturedStdout();
+
+    EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, result);
+    EXPECT_EQ("Invalid number of jobs: -2\n", output);
+}
+
 TEST(MultiCommandWhiteboxTest, GivenArgsWithQuietModeAndEmptyMulticommandFileWhenInitializingThenQuietFlagIsSetAndErrorIsReturned) {
     MockMultiCommand mockMultiCommand{};
     mockMultiCommand.quiet = false;
@@ -1177,6 +1338,28 @@ TEST_F(OfflineCompilerTests, givenIncorrectConfigFlagWhenParsingCommandLineThenE
     EXPECT_EQ(expectedErrorMessage, output);
 }
 
+TEST_F(OfflineCompilerTests, givenJobsFlagForSingleDeviceBuildWhenParsingCommandLineThenErrorIsReturned) {
+    const std::vector<std::string> argv = {
+        "ocloc",
+        "compile",
+        "-file",
+        clCopybufferFilename.c_str(),
+        "-device",
+        gEnvironment->devicePrefix.c_str(),
+        "-jobs",
+        "2"};
+
+    MockOfflineCompiler mockOfflineCompiler{};
+
+    StdoutCapture capture;
+    capture.captureStdout();
+    const auto result = mockOfflineCompiler.parseCommandLine(argv.size(), argv);
+    const auto output{capture.getCapturedStdout()};
+
+    EXPECT_EQ(OCLOC_INVALID_COMMAND_LINE, result);
+    EXPECT_NE(std::string::npos, output.find("Invalid option (arg 6): -jobs\n"));
+}
+
 TEST_F(OfflineCompilerTests, Given64BitModeFlagWhenParsingThenInternalOptionsContain64BitModeFlag) {
     const std::array<std::string, 2> flagsToTest = {
         "-64", CompilerOptions::arch64bit.str()};
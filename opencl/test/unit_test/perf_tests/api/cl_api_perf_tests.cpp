@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/cpu_overhead_benchmark.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "opencl/test/unit_test/api/cl_api_tests.h"
+
+using namespace NEO;
+
+using ClApiPerfTests = ApiTests;
+
+HWTEST_F(ClApiPerfTests, givenKernelWhenEnqueueNDRangeKernelIsCalledThenCpuOverheadIsReported) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    size_t globalWorkSize[3] = {64, 1, 1};
+    size_t localWorkSize[3] = {16, 1, 1};
+
+    auto result = CpuOverheadBenchmark::measure([&]() { return csr.recursiveLockCounter.load(); }, [&]() {
+        retVal = clEnqueueNDRangeKernel(pCommandQueue, pMultiDeviceKernel, 1, nullptr, globalWorkSize, localWorkSize, 0, nullptr, nullptr);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+    });
+    CpuOverheadBenchmark::record(result);
+
+    EXPECT_EQ(CL_SUCCESS, clFinish(pCommandQueue));
+}
+
+HWTEST_F(ClApiPerfTests, givenKernelWhenEnqueueNDRangeKernelWithEventIsCalledThenCpuOverheadIsReported) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    size_t globalWorkSize[3] = {64, 1, 1};
+    size_t localWorkSize[3] = {16, 1, 1};
+
+    auto result = CpuOverheadBenchmark::measure([&]() { return csr.recursiveLockCounter.load(); }, [&]() {
+        cl_event event = nullptr;
+        retVal = clEnqueueNDRangeKernel(pCommandQueue, pMultiDeviceKernel, 1, nullptr, globalWorkSize, localWorkSize, 0, nullptr, &event);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(CL_SUCCESS, clReleaseEvent(event));
+    });
+    CpuOverheadBenchmark::record(result);
+
+    EXPECT_EQ(CL_SUCCESS, clFinish(pCommandQueue));
+}
+
+HWTEST_F(ClApiPerfTests, givenContextWhenUserEventIsCreatedAndReleasedThenCpuOverheadIsReported) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    auto result = CpuOverheadBenchmark::measure([&]() { return csr.recursiveLockCounter.load(); }, [&]() {
+        auto userEvent = clCreateUserEvent(pContext, &retVal);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(CL_SUCCESS, clReleaseEvent(userEvent));
+    });
+    CpuOverheadBenchmark::record(result);
+}
+
+HWTEST_F(ClApiPerfTests, givenContextWhenBufferIsCreatedAndReleasedThenCpuOverheadIsReported) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    auto result = CpuOverheadBenchmark::measure([&]() { return csr.recursiveLockCounter.load(); }, [&]() {
+        auto buffer = clCreateBuffer(pContext, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, &retVal);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(CL_SUCCESS, clReleaseMemObject(buffer));
+    });
+    CpuOverheadBenchmark::record(result);
+}
+
+HWTEST_F(ClApiPerfTests, givenContextWhenHostUsmIsAllocatedAndFreedThenCpuOverheadIsReported) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    auto result = CpuOverheadBenchmark::measure([&]() { return csr.recursiveLockCounter.load(); }, [&]() {
+        auto ptr = clHostMemAllocINTEL(pContext, nullptr, MemoryConstants::pageSize, 0, &retVal);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(CL_SUCCESS, clMemFreeINTEL(pContext, ptr));
+    });
+    CpuOverheadBenchmark::record(result);
+}
+
+HWTEST_F(ClApiPerfTests, givenContextWhenDeviceUsmIsAllocatedAndFreedThenCpuOverheadIsReported) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+
+    auto result = CpuOverheadBenchmark::measure([&]() { return csr.recursiveLockCounter.load(); }, [&]() {
+        auto ptr = clDeviceMemAllocINTEL(pContext, testedClDevice, nullptr, MemoryConstants::pageSize, 0, &retVal);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+        EXPECT_EQ(CL_SUCCESS, clMemFreeINTEL(pContext, ptr));
+    });
+    CpuOverheadBenchmark::record(result);
+}
+
+HWTEST_F(ClApiPerfTests, givenBufferWhenNonBlockingWriteIsEnqueuedThenCpuOverheadIsReported) {
+    auto &csr = pDevice->getUltCommandStreamReceiver<FamilyType>();
+    auto buffer = clCreateBuffer(pContext, CL_MEM_READ_WRITE, MemoryConstants::pageSize, nullptr, &retVal);
+    ASSERT_EQ(CL_SUCCESS, retVal);
+    uint8_t hostMemory[64] = {};
+
+    auto result = CpuOverheadBenchmark::measure([&]() { return csr.recursiveLockCounter.load(); }, [&]() {
+        retVal = clEnqueueWriteBuffer(pCommandQueue, buffer, CL_FALSE, 0, sizeof(hostMemory), hostMemory, 0, nullptr, nullptr);
+        EXPECT_EQ(CL_SUCCESS, retVal);
+    });
+    CpuOverheadBenchmark::record(result);
+
+    EXPECT_EQ(CL_SUCCESS, clFinish(pCommandQueue));
+    EXPECT_EQ(CL_SUCCESS, clReleaseMemObject(buffer));
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+
+#include "opencl/source/mem_obj/map_operations_handler.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+struct MapOperationsPerfTests : public ::testing::TestWithParam<uint32_t> {
+    static constexpr size_t windowSize = MemoryConstants::pageSize;
+    static constexpr size_t windowsPerThread = 1024;
+    static constexpr uint32_t iterations = 16;
+
+    // Every thread keeps a sliding set of windows mapped and remaps them one by one. With shared buffer
+    // each map and unmap is looked up among all windows mapped by all threads.
+    void runSlidingWindows(MapOperationsStorage &storage, bool bufferPerThread, uint32_t threadsCount) {
+        auto basePtr = reinterpret_cast<void *>(0x10000000u);
+        std::atomic<uint32_t> threadsReady = 0;
+        std::atomic<bool> start = false;
+        std::atomic<uint64_t> failedOperations = 0;
+
+        auto worker = [&](uint32_t threadId) {
+            MemObjSizeArray size = {{windowSize, 1, 1}};
+            MemObjOffsetArray offset = {{0, 0, 0}};
+            cl_map_flags mapFlags = CL_MAP_WRITE;
+            auto threadBasePtr = ptrOffset(basePtr, threadId * windowsPerThread * windowSize);
+            auto memObj = getMemObj(bufferPerThread ? threadId : 0u);
+
+            for (size_t window = 0; window < windowsPerThread; window++) {
+                storage.getHandler(memObj).add(ptrOffset(threadBasePtr, window * windowSize), windowSize, mapFlags, size, offset, 0, &allocation);
+            }
+
+            threadsReady++;
+            while (!start.load()) {
+                std::this_thread::yield();
+            }
+
+            for (uint32_t iteration = 0; iteration < iterations; iteration++) {
+                for (size_t window = 0; window < windowsPerThread; window++) {
+                    auto windowPtr = ptrOffset(threadBasePtr, window * windowSize);
+                    auto &handler = storage.getHandler(memObj);
+                    MapInfo mapInfo;
+                    if (!handler.find(windowPtr, mapInfo)) {
+                        failedOperations++;
+                    }
+                    handler.remove(windowPtr);
+                    if (!handler.add(windowPtr, windowSize, mapFlags, size, offset, 0, &allocation)) {
+                        failedOperations++;
+                    }
+                }
+            }
+        };
+
+        std::vector<std::thread> threads;
+        for (uint32_t threadId = 0; threadId < threadsCount; threadId++) {
+            threads.emplace_back(worker, threadId);
+        }
+        while (threadsReady.load() != threadsCount) {
+            std::this_thread::yield();
+        }
+
+        const auto startTime = std::chrono::steady_clock::now();
+        start.store(true);
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        const auto endTime = std::chrono::steady_clock::now();
+
+        EXPECT_EQ(0u, failedOperations.load());
+        size_t mappedWindows = 0;
+        for (uint32_t threadId = 0; threadId < (bufferPerThread ? threadsCount : 1u); threadId++) {
+            mappedWindows += storage.getHandler(getMemObj(threadId)).size();
+        }
+        EXPECT_EQ(threadsCount * windowsPerThread, mappedWindows);
+
+        const auto operationsCount = static_cast<uint64_t>(threadsCount) * windowsPerThread * iterations;
+        const auto elapsedNs = std::max<int64_t>(1, std::chrono::duration_cast<std::chrono::nanoseconds>(endTime - startTime).count());
+        ::testing::Test::RecordProperty("threadsCount", std::to_string(threadsCount));
+        ::testing::Test::RecordProperty("bufferPerThread", std::to_string(bufferPerThread));
+        ::testing::Test::RecordProperty("mappedWindows", std::to_string(threadsCount * windowsPerThread));
+        ::testing::Test::RecordProperty("mapUnmapPerSecond", std::to_string(operationsCount * 1000000000ull / static_cast<uint64_t>(elapsedNs)));
+    }
+
+    static cl_mem getMemObj(uint32_t index) {
+        return reinterpret_cast<cl_mem>(static_cast<uintptr_t>(0x1000u * (index + 1)));
+    }
+
+    MockGraphicsAllocation allocation;
+};
+
+TEST_P(MapOperationsPerfTests, givenManyWindowsMappedOnOneBufferWhenMappingAndUnmappingConcurrentlyThenThroughputIsReported) {
+    MapOperationsStorage storage;
+    runSlidingWindows(storage, false, GetParam());
+}
+
+TEST_P(MapOperationsPerfTests, givenWindowsMappedOnBufferPerThreadWhenMappingAndUnmappingConcurrentlyThenThroughputIsReported) {
+    MapOperationsStorage storage;
+    runSlidingWindows(storage, true, GetParam());
+}
+
+INSTANTIATE_TEST_SUITE_P(MapOperationsPerfTests,
+                         MapOperationsPerfTests,
+                         ::testing::Values(1u, 2u, 4u, 8u));
@@ -8,9 +8,12 @@
 #include "shared/source/command_stream/wait_status.h"
 #include "shared/source/helpers/local_memory_access_modes.h"
 #include "shared/source/kernel/implicit_args_helper.h"
+#include "shared/source/utilities/completion_reactor.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_command_stream_receiver.h"
 #include "shared/test/common/mocks/mock_device.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
 #include "shared/test/common/test_macros/hw_test.h"
 #include "shared/test/common/test_macros/test_checks_shared.h"
 
@@ -26,6 +29,8 @@
 #include "opencl/test/unit_test/mocks/mock_printf_handler.h"
 #include "opencl/test/unit_test/mocks/mock_program.h"
 
+#include <thread>
+
 using namespace NEO;
 
 using PrintfHandlerTests = ::testing::Test;
@@ -382,6 +387,158 @@ TEST_F(PrintfHandlerTests, GivenAllocationInLocalMemoryWhichRequiresBlitterWhenP
     }
 }
 
+TEST_F(PrintfHandlerTests, givenAsyncPrintfOutputEnabledWhenCheckingIfAsyncOutputIsAllowedThenPreparedHandlerWithoutBlitterReadbackIsAllowed) {
+    DebugManagerStateRestore restore;
+    auto device = std::make_unique<MockClDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(nullptr));
+    MockContext context(device.get());
+
+    auto kernelInfo = std::make_unique<MockKernelInfo>();
+    kernelInfo->setPrintfSurface(sizeof(uintptr_t), 0);
+    MockProgram program(&context, false, toClDeviceVector(*device));
+    uint64_t crossThread[10];
+    MockKernel kernel(&program, *kernelInfo, *device);
+    kernel.setCrossThreadData(&crossThread, sizeof(uint64_t) * 8);
+
+    MockMultiDispatchInfo multiDispatchInfo(device.get(), &kernel);
+    std::unique_ptr<PrintfHandler> printfHandler(PrintfHandler::create(multiDispatchInfo, device->getDevice()));
+    EXPECT_FALSE(printfHandler->isAsyncOutputAllowed());
+
+    debugManager.flags.EnableAsyncPrintfOutput.set(1);
+    EXPECT_FALSE(printfHandler->isAsyncOutputAllowed());
+
+    printfHandler->prepareDispatch(multiDispatchInfo);
+    auto blitterReadbackRequired = device->getProductHelper().isBlitCopyRequiredForLocalMemory(device->getRootDeviceEnvironment(), *printfHandler->getSurface());
+    EXPECT_EQ(!blitterReadbackRequired, printfHandler->isAsyncOutputAllowed());
+
+    debugManager.flags.EnableAsyncPrintfOutput.set(0);
+    EXPECT_FALSE(printfHandler->isAsyncOutputAllowed());
+}
+
+namespace {
+class NoThreadCompletionReactor : public CompletionReactor {
+  public:
+    using CompletionReactor::draining;
+    using CompletionReactor::registerList;
+
+    void openThread() override {}
+};
+
+class MockPendingPrintfOutputs : public PendingPrintfOutputs {
+  public:
+    using PendingPrintfOutputs::gpuHangCheckPeriod;
+};
+
+class CountingPrintfHandler : public MockPrintfHandler {
+  public:
+    CountingPrintfHandler(Device &device, uint32_t &printCalls) : MockPrintfHandler(device), printCalls(printCalls) {}
+
+    bool printEnqueueOutput() override {
+        printCalls++;
+        return true;
+    }
+
+    uint32_t &printCalls;
+};
+
+struct PrintfHandlerAsyncOutputTests : public ::testing::Test {
+    void SetUp() override {
+        auto executionEnvironment = new MockExecutionEnvironment(defaultHwInfo.get(), false, 1u);
+        reactor = new NoThreadCompletionReactor();
+        executionEnvironment->completionReactor.reset(reactor);
+        device = std::make_unique<MockClDevice>(MockDevice::createWithExecutionEnvironment<MockDevice>(nullptr, executionEnvironment, 0u));
+        context = std::make_unique<MockContext>(device.get());
+
+        kernelInfo.setPrintfSurface(sizeof(uintptr_t), 0);
+        program = std::make_unique<MockProgram>(context.get(), false, toClDeviceVector(*device));
+        kernel = std::make_unique<MockKernel>(program.get(), kernelInfo, *device);
+        kernel->setCrossThreadData(&crossThread, sizeof(uint64_t) * 8);
+        kernel->incRefInternal();
+
+        MockMultiDispatchInfo multiDispatchInfo(device.get(), kernel.get());
+        printfHandler = std::make_unique<CountingPrintfHandler>(device->getDevice(), printCalls);
+        printfHandler->prepareDispatch(multiDispatchInfo);
+    }
+
+    NoThreadCompletionReactor *reactor = nullptr;
+    std::unique_ptr<MockClDevice> device;
+    std::unique_ptr<MockContext> context;
+    MockKernelInfo kernelInfo;
+    std::unique_ptr<MockProgram> program;
+    std::unique_ptr<MockKernel> kernel;
+    uint64_t crossThread[10] = {};
+    uint32_t printCalls = 0;
+    std::unique_ptr<PrintfHandler> printfHandler;
+    std::shared_ptr<PendingPrintfOutputs> pendingOutputs = std::make_shared<PendingPrintfOutputs>();
+};
+} // namespace
+
+TEST_F(PrintfHandlerAsyncOutputTests, givenAsyncOutputWhenWatchedTaskCompletesThenOutputIsPrintedAndPendingOutputIsReleased) {
+    PrintfHandler::printEnqueueOutputAsync(std::move(printfHandler), device->getGpgpuCommandStreamReceiver(), 1u, pendingOutputs);
+
+    EXPECT_EQ(nullptr, printfHandler);
+    EXPECT_EQ(1u, pendingOutputs->getCount());
+    EXPECT_EQ(0u, printCalls);
+    ASSERT_EQ(1u, reactor->registerList.size());
+
+    reactor->registerList[0].callback(false);
+    EXPECT_EQ(1u, printCalls);
+    EXPECT_EQ(0u, pendingOutputs->getCount());
+}
+
+TEST_F(PrintfHandlerAsyncOutputTests, givenAsyncOutputWhenGpuHangIsDetectedThenOutputIsNotPrintedAndPendingOutputIsReleased) {
+    PrintfHandler::printEnqueueOutputAsync(std::move(printfHandler), device->getGpgpuCommandStreamReceiver(), 1u, pendingOutputs);
+    ASSERT_EQ(1u, reactor->registerList.size());
+
+    reactor->registerList[0].callback(true);
+    EXPECT_EQ(0u, printCalls);
+    EXPECT_EQ(0u, pendingOutputs->getCount());
+}
+
+TEST_F(PrintfHandlerAsyncOutputTests, givenReactorNotCompletingWatchesAsyncWhenCheckingIfAsyncOutputIsAllowedThenOutputIsPrintedSynchronously) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableAsyncPrintfOutput.set(1);
+    if (device->getProductHelper().isBlitCopyRequiredForLocalMemory(device->getRootDeviceEnvironment(), *printfHandler->getSurface())) {
+        GTEST_SKIP();
+    }
+    EXPECT_TRUE(printfHandler->isAsyncOutputAllowed());
+
+    reactor->draining = true;
+    EXPECT_FALSE(printfHandler->isAsyncOutputAllowed());
+    reactor->draining = false;
+}
+
+TEST_F(PrintfHandlerAsyncOutputTests, givenPendingAsyncOutputWhenOutputIsPrintedOnOtherThreadThenWaitForAllOutputsReturnsReady) {
+    auto &csr = device->getGpgpuCommandStreamReceiver();
+    EXPECT_EQ(WaitStatus::ready, pendingOutputs->waitForAll(csr));
+
+    PrintfHandler::printEnqueueOutputAsync(std::move(printfHandler), csr, 1u, pendingOutputs);
+    ASSERT_EQ(1u, reactor->registerList.size());
+
+    std::thread reactorThread([this] { reactor->registerList[0].callback(false); });
+    EXPECT_EQ(WaitStatus::ready, pendingOutputs->waitForAll(csr));
+    reactorThread.join();
+
+    EXPECT_EQ(1u, printCalls);
+    EXPECT_EQ(0u, pendingOutputs->getCount());
+}
+
+TEST_F(PrintfHandlerAsyncOutputTests, givenPendingAsyncOutputWhenGpuHangIsDetectedThenWaitForAllOutputsReturnsGpuHang) {
+    MockCommandStreamReceiver csr(*device->getExecutionEnvironment(), 0, device->getDeviceBitfield());
+    csr.isGpuHangDetectedReturnValue = true;
+    auto hangCheckedOutputs = std::make_shared<MockPendingPrintfOutputs>();
+    hangCheckedOutputs->gpuHangCheckPeriod = std::chrono::microseconds(0);
+
+    PrintfHandler::printEnqueueOutputAsync(std::move(printfHandler), csr, 1u, hangCheckedOutputs);
+    ASSERT_EQ(1u, reactor->registerList.size());
+
+    EXPECT_EQ(WaitStatus::gpuHang, hangCheckedOutputs->waitForAll(csr));
+    EXPECT_EQ(1u, hangCheckedOutputs->getCount());
+
+    reactor->registerList[0].callback(true);
+    EXPECT_EQ(0u, hangCheckedOutputs->getCount());
+    EXPECT_EQ(WaitStatus::ready, hangCheckedOutputs->waitForAll(csr));
+}
+
 using PrintfHandlerMultiRootDeviceTests = MultiRootDeviceFixture;
 
 TEST_F(PrintfHandlerMultiRootDeviceTests, GivenPrintfSurfaceThenItHasCorrectRootDeviceIndex) {
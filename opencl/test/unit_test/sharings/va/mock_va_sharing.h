@@ -32,6 +32,7 @@ class VASharingFunctionsMock : public VASharingFunctions {
     VAStatus queryImageFormatsReturnStatus = VA_STATUS_SUCCESS;
     VAStatus syncSurfaceReturnStatus = VA_STATUS_SUCCESS;
     VAStatus deriveImageReturnStatus = VA_STATUS_SUCCESS;
+    VAStatus querySurfaceStatusReturnStatus = VA_STATUS_SUCCESS;
 
     bool isValidDisplayCalled = false;
     bool deriveImageCalled = false;
@@ -121,6 +122,11 @@ class VASharingFunctionsMock : public VASharingFunctions {
         return syncSurfaceReturnStatus;
     }
 
+    VAStatus querySurfaceStatus(VASurfaceID vaSurface, VASurfaceStatus *status) override {
+        *status = VASurfaceReady;
+        return querySurfaceStatusReturnStatus;
+    }
+
     VAStatus queryImageFormats(VADisplay vaDisplay, VAImageFormat *formatList, int *numFormats) override {
         if (queryImageFormatsReturnStatus != VA_STATUS_SUCCESS) {
             return queryImageFormatsReturnStatus;
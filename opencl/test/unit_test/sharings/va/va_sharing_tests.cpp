@@ -16,6 +16,7 @@
 #include "shared/test/common/helpers/ult_hw_config.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/libult/linux/drm_mock.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
 #include "shared/test/common/test_macros/test.h"
 
 #include "opencl/source/cl_device/cl_device.h"
@@ -1192,6 +1193,138 @@ TEST_F(VaSharingTests, givenEnabledExtendedVaFormatsAndNV12FormatWhenCreatingSha
     EXPECT_EQ(CL_SUCCESS, errCode);
 }
 
+namespace {
+int fstatReturningFdAsInode(int fd, struct stat *buf) {
+    buf->st_dev = 1;
+    buf->st_ino = static_cast<ino_t>(fd);
+    return 0;
+}
+} // namespace
+
+TEST_F(VaSharingTests, givenVaSurfaceImportCacheEnabledWhenSameSurfaceIsCreatedTwiceThenImportedAllocationIsReusedAndExportedHandleIsClosed) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.VaSurfaceImportCacheSize.set(4);
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> fstatBackup(&SysCalls::sysCallsFstat, fstatReturningFdAsInode);
+    VariableBackup<uint32_t> closeCalledBackup(&SysCalls::closeFuncCalled);
+    vaSharing->sharingFunctions.haveExportSurfaceHandle = true;
+
+    auto vaSurface1 = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                              CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, vaSurface1);
+    auto closeCalledAfterImport = SysCalls::closeFuncCalled;
+
+    auto vaSurface2 = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                              CL_MEM_READ_ONLY, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, vaSurface2);
+    EXPECT_EQ(closeCalledAfterImport + 1, SysCalls::closeFuncCalled);
+
+    auto graphicsAllocation = vaSurface1->getGraphicsAllocation(rootDeviceIndex);
+    EXPECT_EQ(graphicsAllocation, vaSurface2->getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(vaSurface1->getImageDesc().image_width, vaSurface2->getImageDesc().image_width);
+    EXPECT_EQ(vaSurface1->getImageDesc().image_row_pitch, vaSurface2->getImageDesc().image_row_pitch);
+    EXPECT_EQ(3u, graphicsAllocation->peekReuseCount());
+
+    vaSurface1.reset();
+    vaSurface2.reset();
+    EXPECT_EQ(1u, graphicsAllocation->peekReuseCount());
+
+    auto vaSurface3 = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                              CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, vaSurface3);
+    EXPECT_EQ(graphicsAllocation, vaSurface3->getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(closeCalledAfterImport + 2, SysCalls::closeFuncCalled);
+}
+
+TEST_F(VaSharingTests, givenVaSurfaceImportCacheEnabledWhenDifferentPlanesAreCreatedThenSeparateAllocationsAreImported) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.VaSurfaceImportCacheSize.set(4);
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> fstatBackup(&SysCalls::sysCallsFstat, fstatReturningFdAsInode);
+    vaSharing->sharingFunctions.haveExportSurfaceHandle = true;
+
+    auto vaSurfacePlane0 = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                                   CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    auto vaSurfacePlane1 = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                                   CL_MEM_READ_WRITE, 0, &vaSurfaceId, 1, &errCode));
+    ASSERT_NE(nullptr, vaSurfacePlane0);
+    ASSERT_NE(nullptr, vaSurfacePlane1);
+    EXPECT_NE(vaSurfacePlane0->getGraphicsAllocation(rootDeviceIndex), vaSurfacePlane1->getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(2u, vaSurfacePlane0->getGraphicsAllocation(rootDeviceIndex)->peekReuseCount());
+    EXPECT_EQ(2u, vaSurfacePlane1->getGraphicsAllocation(rootDeviceIndex)->peekReuseCount());
+}
+
+TEST_F(VaSharingTests, givenFullVaSurfaceImportCacheWhenNewSurfaceIsImportedThenLeastRecentlyUsedSurfaceIsEvicted) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.VaSurfaceImportCacheSize.set(1);
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> fstatBackup(&SysCalls::sysCallsFstat, fstatReturningFdAsInode);
+    vaSharing->sharingFunctions.haveExportSurfaceHandle = true;
+
+    auto vaSurface1 = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                              CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, vaSurface1);
+    auto graphicsAllocation1 = vaSurface1->getGraphicsAllocation(rootDeviceIndex);
+    EXPECT_EQ(2u, graphicsAllocation1->peekReuseCount());
+
+    vaSharing->sharingFunctions.mockVaSurfaceDesc.objects[0].fd++;
+    auto vaSurface2 = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                              CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, vaSurface2);
+    EXPECT_NE(graphicsAllocation1, vaSurface2->getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(1u, graphicsAllocation1->peekReuseCount());
+    EXPECT_EQ(2u, vaSurface2->getGraphicsAllocation(rootDeviceIndex)->peekReuseCount());
+}
+
+TEST_F(VaSharingTests, givenCachedVaSurfaceDestroyedByApplicationWhenSurfaceIsCreatedThenCachedAllocationIsDroppedAndSurfaceIsImportedAgain) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.VaSurfaceImportCacheSize.set(4);
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> fstatBackup(&SysCalls::sysCallsFstat, fstatReturningFdAsInode);
+    vaSharing->sharingFunctions.haveExportSurfaceHandle = true;
+
+    auto vaSurface1 = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                              CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, vaSurface1);
+    auto graphicsAllocation1 = vaSurface1->getGraphicsAllocation(rootDeviceIndex);
+    EXPECT_EQ(2u, graphicsAllocation1->peekReuseCount());
+
+    vaSharing->sharingFunctions.querySurfaceStatusReturnStatus = VA_STATUS_ERROR_INVALID_SURFACE;
+    auto vaSurface2 = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                              CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, vaSurface2);
+    EXPECT_NE(graphicsAllocation1, vaSurface2->getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(1u, graphicsAllocation1->peekReuseCount());
+}
+
+TEST_F(VaSharingTests, givenCachedVaSurfaceWhenLastImageIsReleasedThenAllocationIsKeptByCache) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.VaSurfaceImportCacheSize.set(4);
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> fstatBackup(&SysCalls::sysCallsFstat, fstatReturningFdAsInode);
+    vaSharing->sharingFunctions.haveExportSurfaceHandle = true;
+
+    auto vaSurface = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                             CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, vaSurface);
+    auto graphicsAllocation = vaSurface->getGraphicsAllocation(rootDeviceIndex);
+
+    EXPECT_FALSE(vaSurface->peekSharingHandler()->releaseReusedGraphicsAllocation());
+    EXPECT_EQ(1u, graphicsAllocation->peekReuseCount());
+    graphicsAllocation->incReuseCount();
+}
+
+TEST_F(VaSharingTests, givenVaSurfaceImportCacheEnabledWhenDmaBufIdentityIsUnknownThenSurfaceIsNotCached) {
+    DebugManagerStateRestore restore;
+    debugManager.flags.VaSurfaceImportCacheSize.set(4);
+    VariableBackup<decltype(SysCalls::sysCallsFstat)> fstatBackup(&SysCalls::sysCallsFstat, [](int fd, struct stat *buf) -> int { return -1; });
+    vaSharing->sharingFunctions.haveExportSurfaceHandle = true;
+
+    auto vaSurface1 = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                              CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    auto vaSurface2 = std::unique_ptr<Image>(VASurface::createSharedVaSurface(&context, &vaSharing->sharingFunctions,
+                                                                              CL_MEM_READ_WRITE, 0, &vaSurfaceId, 0, &errCode));
+    ASSERT_NE(nullptr, vaSurface1);
+    ASSERT_NE(nullptr, vaSurface2);
+    EXPECT_NE(vaSurface1->getGraphicsAllocation(rootDeviceIndex), vaSurface2->getGraphicsAllocation(rootDeviceIndex));
+    EXPECT_EQ(0u, vaSurface1->getGraphicsAllocation(rootDeviceIndex)->peekReuseCount());
+}
+
 using ApiVaSharingTests = VaSharingTests;
 
 TEST_F(ApiVaSharingTests, givenSupportedImageTypeWhenGettingSupportedVAApiFormatsThenCorrectListIsReturned) {
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/api_capture_log.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+// Prints per-function CPU time of API calls recorded with EnableApiCapture=1 as CSV.
+int main(int argc, char *argv[]) {
+    if (argc != 2) {
+        fprintf(stderr, "Usage: %s <api capture file>\n", argv[0]);
+        return 1;
+    }
+
+    std::ifstream captureFile(argv[1], std::ios::binary);
+    if (!captureFile.good()) {
+        fprintf(stderr, "Error! Couldn't open api capture file: %s\n", argv[1]);
+        return 1;
+    }
+    std::vector<uint8_t> captureData{std::istreambuf_iterator<char>(captureFile), std::istreambuf_iterator<char>()};
+
+    HostSideTracing::ApiCaptureLog captureLog;
+    if (!captureLog.parse(captureData.data(), captureData.size())) {
+        fprintf(stderr, "Error! Invalid api capture file: %s\n", argv[1]);
+        return 1;
+    }
+
+    printf("%s", captureLog.printStatistics().c_str());
+    return 0;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "opencl/source/tracing/api_capture_log.h"
+#include "opencl/source/tracing/api_capture_replayer.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dlfcn.h>
+#endif
+
+namespace {
+#if defined(_WIN32)
+const char *defaultLibraryName = "OpenCL.dll";
+void *loadLibrary(const char *name) { return LoadLibraryA(name); }
+void *loadFunction(void *library, const char *name) { return reinterpret_cast<void *>(GetProcAddress(static_cast<HMODULE>(library), name)); }
+#else
+const char *defaultLibraryName = "libOpenCL.so.1";
+void *loadLibrary(const char *name) { return dlopen(name, RTLD_NOW); }
+void *loadFunction(void *library, const char *name) { return dlsym(library, name); }
+#endif
+
+template <typename FunctionT>
+bool load(void *library, FunctionT &function, const char *name) {
+    function = reinterpret_cast<FunctionT>(loadFunction(library, name));
+    if (!function) {
+        fprintf(stderr, "Error! Couldn't load function: %s\n", name);
+    }
+    return function != nullptr;
+}
+
+bool loadDispatch(void *library, HostSideTracing::ApiCaptureReplayDispatch &dispatch) {
+    return load(library, dispatch.getPlatformIDs, "clGetPlatformIDs") &&
+           load(library, dispatch.getDeviceIDs, "clGetDeviceIDs") &&
+           load(library, dispatch.createContext, "clCreateContext") &&
+           load(library, dispatch.retainContext, "clRetainContext") &&
+           load(library, dispatch.releaseContext, "clReleaseContext") &&
+           load(library, dispatch.createCommandQueueWithProperties, "clCreateCommandQueueWithProperties") &&
+           load(library, dispatch.retainCommandQueue, "clRetainCommandQueue") &&
+           load(library, dispatch.releaseCommandQueue, "clReleaseCommandQueue") &&
+           load(library, dispatch.createBuffer, "clCreateBuffer") &&
+           load(library, dispatch.retainMemObject, "clRetainMemObject") &&
+           load(library, dispatch.releaseMemObject, "clReleaseMemObject") &&
+           load(library, dispatch.createProgramWithSource, "clCreateProgramWithSource") &&
+           load(library, dispatch.buildProgram, "clBuildProgram") &&
+           load(library, dispatch.retainProgram, "clRetainProgram") &&
+           load(library, dispatch.releaseProgram, "clReleaseProgram") &&
+           load(library, dispatch.createKernel, "clCreateKernel") &&
+           load(library, dispatch.setKernelArg, "clSetKernelArg") &&
+           load(library, dispatch.retainKernel, "clRetainKernel") &&
+           load(library, dispatch.releaseKernel, "clReleaseKernel") &&
+           load(library, dispatch.enqueueNDRangeKernel, "clEnqueueNDRangeKernel") &&
+           load(library, dispatch.enqueueReadBuffer, "clEnqueueReadBuffer") &&
+           load(library, dispatch.enqueueWriteBuffer, "clEnqueueWriteBuffer") &&
+           load(library, dispatch.enqueueCopyBuffer, "clEnqueueCopyBuffer") &&
+           load(library, dispatch.enqueueFillBuffer, "clEnqueueFillBuffer") &&
+           load(library, dispatch.waitForEvents, "clWaitForEvents") &&
+           load(library, dispatch.retainEvent, "clRetainEvent") &&
+           load(library, dispatch.releaseEvent, "clReleaseEvent") &&
+           load(library, dispatch.flush, "clFlush") &&
+           load(library, dispatch.finish, "clFinish");
+}
+} // namespace
+
+// Re-issues OpenCL calls recorded with EnableApiCapture=1 and prints per-function CPU time
+// of the replayed calls as CSV, in the same format as api_capture_reader.
+int main(int argc, char *argv[]) {
+    const char *captureFileName = nullptr;
+    const char *libraryName = defaultLibraryName;
+    auto timing = HostSideTracing::ApiCaptureReplayer::Timing::asFastAsPossible;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--original-timing") == 0) {
+            timing = HostSideTracing::ApiCaptureReplayer::Timing::original;
+        } else if (strcmp(argv[i], "--library") == 0 && i + 1 < argc) {
+            libraryName = argv[++i];
+        } else if (!captureFileName) {
+            captureFileName = argv[i];
+        } else {
+            captureFileName = nullptr;
+            break;
+        }
+    }
+    if (!captureFileName) {
+        fprintf(stderr, "Usage: %s <api capture file> [--original-timing] [--library <OpenCL library>]\n", argv[0]);
+        return 1;
+    }
+
+    std::ifstream captureFile(captureFileName, std::ios::binary);
+    if (!captureFile.good()) {
+        fprintf(stderr, "Error! Couldn't open api capture file: %s\n", captureFileName);
+        return 1;
+    }
+    std::vector<uint8_t> captureData{std::istreambuf_iterator<char>(captureFile), std::istreambuf_iterator<char>()};
+
+    HostSideTracing::ApiCaptureLog captureLog;
+    if (!captureLog.parse(captureData.data(), captureData.size())) {
+        fprintf(stderr, "Error! Invalid api capture file: %s\n", captureFileName);
+        return 1;
+    }
+
+    auto library = loadLibrary(libraryName);
+    if (!library) {
+        fprintf(stderr, "Error! Couldn't load OpenCL library: %s\n", libraryName);
+        return 1;
+    }
+    HostSideTracing::ApiCaptureReplayDispatch dispatch{};
+    if (!loadDispatch(library, dispatch)) {
+        return 1;
+    }
+
+    HostSideTracing::ApiCaptureReplayer replayer(dispatch, timing);
+    if (!replayer.replay(captureLog)) {
+        fprintf(stderr, "Error! No OpenCL device available for replay\n");
+        return 1;
+    }
+
+    printf("%s", HostSideTracing::printApiCaptureStatistics(replayer.getStatistics()).c_str());
+    if (!replayer.getSkippedCalls().empty()) {
+        fprintf(stderr, "%s", replayer.printSkippedCalls().c_str());
+    }
+    return 0;
+}
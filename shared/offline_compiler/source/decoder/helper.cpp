@@ -17,7 +17,9 @@
 #include "igfxfmid.h"
 
 #include <algorithm>
+#include <charconv>
 #include <fstream>
+#include <thread>
 
 void (*abortOclocExecution)(int) = abortOclocExecutionDefaultHandler;
 
@@ -101,6 +103,17 @@ PRODUCT_FAMILY getProductFamilyFromDeviceName(const std::string &deviceName) {
     return IGFX_UNKNOWN;
 }
 
+bool parseJobsCount(const std::string &value, uint32_t &jobsCount) {
+    uint32_t jobs = 0;
+    const auto valueEnd = value.data() + value.size();
+    const auto [parsedEnd, error] = std::from_chars(value.data(), valueEnd, jobs);
+    if (value.empty() || error != std::errc{} || parsedEnd != valueEnd) {
+        return false;
+    }
+    jobsCount = (jobs == 0) ? std::max(1u, std::thread::hardware_concurrency()) : jobs;
+    return true;
+}
+
 void setProductFamilyForIga(const std::string &device, IgaWrapper *iga, OclocArgHelper *argHelper) {
     auto productFamily = argHelper->productConfigHelper->getProductFamilyFromDeviceName(device);
     if (productFamily == IGFX_UNKNOWN) {
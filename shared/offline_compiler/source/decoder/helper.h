@@ -10,7 +10,10 @@
 
 #include "igfxfmid.h"
 
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -34,12 +37,19 @@ size_t findPos(const std::vector<std::string> &lines, const std::string &whatToF
 
 PRODUCT_FAMILY getProductFamilyFromDeviceName(const std::string &deviceName);
 
+bool parseJobsCount(const std::string &value, uint32_t &jobsCount);
+
 class MessagePrinter : NEO::NonCopyableAndNonMovableClass {
   public:
     explicit MessagePrinter() = default;
     explicit MessagePrinter(bool suppressMessages) : suppressMessages(suppressMessages) {}
 
     void printf(const char *message) {
+        std::lock_guard<std::mutex> lock(printMutex);
+        if (capturedOutputForThread) {
+            *capturedOutputForThread << message;
+            return;
+        }
         if (!suppressMessages) {
             ::printf("%s", message);
         }
@@ -48,6 +58,11 @@ class MessagePrinter : NEO::NonCopyableAndNonMovableClass {
 
     template <typename... Args>
     void printf(const char *format, Args... args) {
+        std::lock_guard<std::mutex> lock(printMutex);
+        if (capturedOutputForThread) {
+            *capturedOutputForThread << stringFormat(format, args...);
+            return;
+        }
         if (!suppressMessages) {
             ::printf(format, args...);
         }
@@ -58,11 +73,24 @@ class MessagePrinter : NEO::NonCopyableAndNonMovableClass {
         return ss;
     }
 
-    bool isSuppressed() const { return suppressMessages; }
+    bool isSuppressed() const {
+        return capturedOutputForThread ? suppressMessagesForThread : suppressMessages.load();
+    }
+    // While output of the calling thread is captured, suppression only applies to that thread.
     void setSuppressMessages(bool suppress) {
+        if (capturedOutputForThread) {
+            suppressMessagesForThread = suppress;
+            return;
+        }
         suppressMessages = suppress;
     }
 
+    // Messages printed by the calling thread are redirected to given stream instead of stdout and log.
+    void setCapturedOutputForCurrentThread(std::stringstream *capturedOutput) {
+        capturedOutputForThread = capturedOutput;
+        suppressMessagesForThread = suppressMessages;
+    }
+
   private:
     template <typename... Args>
     std::string stringFormat(const std::string &format, Args... args) {
@@ -76,6 +104,9 @@ class MessagePrinter : NEO::NonCopyableAndNonMovableClass {
         return outputString.c_str();
     }
 
+    static inline thread_local std::stringstream *capturedOutputForThread = nullptr;
+    static inline thread_local bool suppressMessagesForThread = false;
     std::stringstream ss;
-    bool suppressMessages = false;
+    std::mutex printMutex;
+    std::atomic<bool> suppressMessages = false;
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2024 Intel Corporation
+ * Copyright (C) 2019-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -15,10 +15,15 @@
 #include "shared/offline_compiler/source/utilities/safety_caller.h"
 #include "shared/source/utilities/const_stringref.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <memory>
+#include <thread>
 
 namespace NEO {
-int MultiCommand::singleBuild(const std::vector<std::string> &args) {
+int MultiCommand::singleBuild(const std::vector<std::string> &args, std::string &buildOutFileName) {
     int retVal = OCLOC_SUCCESS;
 
     if (requestedFatBinary(args, argHelper)) {
@@ -26,14 +31,15 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
     } else {
         std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(args.size(), args, true, retVal, argHelper)};
         if (retVal == OCLOC_SUCCESS) {
-            retVal = buildWithSafetyGuard(pCompiler.get());
+            // signal based safety guard is process-wide, so it is not used for builds running on worker threads
+            retVal = (jobsCount > 1) ? pCompiler->build() : buildWithSafetyGuard(pCompiler.get());
 
             std::string &buildLog = pCompiler->getBuildLog();
             if (buildLog.empty() == false) {
                 argHelper->printf("%s\n", buildLog.c_str());
             }
         }
-        outFileName += ".bin";
+        buildOutFileName += ".bin";
     }
     if (retVal == OCLOC_SUCCESS) {
         if (!quiet)
@@ -42,14 +48,16 @@ int MultiCommand::singleBuild(const std::vector<std::string> &args) {
         argHelper->printf("Build failed with error code: %d\n", retVal);
     }
 
-    if (retVal == OCLOC_SUCCESS) {
-        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + outFileName;
+    return retVal;
+}
+
+void MultiCommand::addToOutputFileList(int buildRetVal, const std::string &buildOutFileName) {
+    if (buildRetVal == OCLOC_SUCCESS) {
+        outputFile << getCurrentDirectoryOwn(outDirForBuilds) + buildOutFileName;
     } else {
         outputFile << "Unsuccessful build";
     }
     outputFile << '\n';
-
-    return retVal;
 }
 
 MultiCommand *MultiCommand::create(const std::vector<std::string> &args, int &retVal, OclocArgHelper *helper) {
@@ -107,6 +115,11 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
             pathToCommandFile = args[++argIndex];
         } else if (hasMoreArgs && ConstStringRef("-output_file_list") == currArg) {
             outputFileList = args[++argIndex];
+        } else if (hasMoreArgs && ConstStringRef("-jobs") == currArg) {
+            if (!parseJobsCount(args[++argIndex], jobsCount)) {
+                argHelper->printf("Invalid number of jobs: %s\n", args[argIndex].c_str());
+                return OCLOC_INVALID_COMMAND_LINE;
+            }
         } else if (ConstStringRef("-q") == currArg) {
             quiet = true;
         } else {
@@ -138,6 +151,11 @@ int MultiCommand::initialize(const std::vector<std::string> &args) {
 }
 
 void MultiCommand::runBuilds(const std::string &argZero) {
+    if (jobsCount > 1 && lines.size() > 1) {
+        runBuildsConcurrently(argZero);
+        return;
+    }
+
     for (size_t i = 0; i < lines.size(); ++i) {
         std::vector<std::string> args = {argZero};
 
@@ -152,11 +170,110 @@ void MultiCommand::runBuilds(const std::string &argZero) {
         }
 
         addAdditionalOptionsToSingleCommandLine(args, i);
-        retVal = singleBuild(args);
+        retVal = singleBuild(args, outFileName);
+        addToOutputFileList(retVal, outFileName);
         retValues.push_back(retVal);
     }
 }
 
+void MultiCommand::runBuildsConcurrently(const std::string &argZero) {
+    struct CommandBuild {
+        std::vector<std::string> args;
+        std::string outFileName;
+        std::stringstream output;
+        std::vector<std::unique_ptr<Output>> savedOutputs;
+        int retVal = OCLOC_SUCCESS;
+        double wallTimeInMs = 0.0;
+        bool parsed = false;
+        bool fatBinary = false;
+        bool suppressMessages = false;
+        bool verbose = false;
+    };
+
+    auto &printer = argHelper->getPrinterRef();
+    std::vector<CommandBuild> builds(lines.size());
+    for (size_t i = 0; i < lines.size(); ++i) {
+        auto &build = builds[i];
+        build.args = {argZero};
+
+        printer.setCapturedOutputForCurrentThread(&build.output);
+        build.retVal = splitLineInSeparateArgs(build.args, lines[i], i);
+        printer.setCapturedOutputForCurrentThread(nullptr);
+        if (build.retVal != OCLOC_SUCCESS) {
+            continue;
+        }
+
+        addAdditionalOptionsToSingleCommandLine(build.args, i);
+        build.outFileName = outFileName;
+        build.parsed = true;
+        build.fatBinary = requestedFatBinary(build.args, argHelper);
+    }
+
+    auto runCommandBuild = [&](CommandBuild &build) {
+        printer.setCapturedOutputForCurrentThread(&build.output);
+        argHelper->setCapturedOutputsForCurrentThread(&build.savedOutputs);
+        const auto buildStart = std::chrono::steady_clock::now();
+        build.retVal = singleBuild(build.args, build.outFileName);
+        build.wallTimeInMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - buildStart).count();
+        build.suppressMessages = printer.isSuppressed();
+        build.verbose = argHelper->isVerbose();
+        argHelper->setCapturedOutputsForCurrentThread(nullptr);
+        printer.setCapturedOutputForCurrentThread(nullptr);
+    };
+
+    std::atomic<size_t> nextBuildId{0};
+    auto runCommandBuilds = [&]() {
+        for (auto buildId = nextBuildId++; buildId < builds.size(); buildId = nextBuildId++) {
+            auto &build = builds[buildId];
+            if (!build.parsed || build.fatBinary) {
+                continue;
+            }
+            runCommandBuild(build);
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    const auto workersCount = std::min(static_cast<size_t>(jobsCount), builds.size());
+    std::vector<std::thread> workers;
+    for (size_t workerId = 1; workerId < workersCount; workerId++) {
+        workers.emplace_back(runCommandBuilds);
+    }
+    runCommandBuilds();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    // fatbinary builds use the process-wide safety guard, so they are built once no worker thread is running
+    for (auto &build : builds) {
+        if (build.parsed && build.fatBinary) {
+            runCommandBuild(build);
+        }
+    }
+    totalBuildsWallTimeInMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    for (size_t i = 0; i < builds.size(); ++i) {
+        auto &build = builds[i];
+        if (build.parsed && !quiet) {
+            argHelper->printf("Command number %zu: \n", i + 1);
+        }
+        // -qq and -v given to a build stay in effect for the following ones, as when building sequentially
+        if (build.suppressMessages) {
+            printer.setSuppressMessages(true);
+        }
+        if (build.verbose) {
+            argHelper->setVerbose(true);
+        }
+        argHelper->printf(build.output.str().c_str());
+        argHelper->appendCapturedOutputs(build.savedOutputs);
+
+        if (build.parsed) {
+            addToOutputFileList(build.retVal, build.outFileName);
+        }
+        retValues.push_back(build.retVal);
+        buildWallTimesInMs.push_back(build.wallTimeInMs);
+    }
+}
+
 void MultiCommand::printHelp() {
     argHelper->printf(R"===(Compiles multiple files using a config file.
 
@@ -172,6 +289,12 @@ Usage: ocloc multi <file_name>
   -output_file_list             Name of optional file containing 
                                 paths to outputs .bin files
 
+  -jobs <count>                 Number of commands built concurrently.
+                                Output of each command is printed in
+                                input order once all builds finish.
+                                0 - use all available hardware threads.
+                                Default: 1.
+
 )===");
 }
 
@@ -214,9 +337,15 @@ int MultiCommand::showResults() {
             } else {
                 argHelper->printf("Build command %d: successful\n", indexRetVal);
             }
+            if (static_cast<size_t>(indexRetVal) < buildWallTimesInMs.size()) {
+                argHelper->printf("Build command %d: wall time: %.2f ms\n", indexRetVal, buildWallTimesInMs[indexRetVal]);
+            }
         }
         indexRetVal++;
     }
+    if (!quiet && !buildWallTimesInMs.empty()) {
+        argHelper->printf("Total wall time of %zu builds using %u jobs: %.2f ms\n", buildWallTimesInMs.size(), jobsCount, totalBuildsWallTimeInMs);
+    }
     return retValue;
 }
 } // namespace NEO
@@ -9,6 +9,7 @@
 
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 
+#include <cstdint>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -32,17 +33,22 @@ class MultiCommand : NEO::NonCopyableAndNonMovableClass {
     int initialize(const std::vector<std::string> &args);
     int splitLineInSeparateArgs(std::vector<std::string> &qargs, const std::string &command, size_t numberOfBuild);
     int showResults();
-    MOCKABLE_VIRTUAL int singleBuild(const std::vector<std::string> &args);
+    MOCKABLE_VIRTUAL int singleBuild(const std::vector<std::string> &args, std::string &buildOutFileName);
     void addAdditionalOptionsToSingleCommandLine(std::vector<std::string> &, size_t buildId);
+    void addToOutputFileList(int buildRetVal, const std::string &buildOutFileName);
     void printHelp();
     void runBuilds(const std::string &argZero);
+    void runBuildsConcurrently(const std::string &argZero);
 
     OclocArgHelper *argHelper = nullptr;
     std::vector<int> retValues;
+    std::vector<double> buildWallTimesInMs;
+    double totalBuildsWallTimeInMs = 0.0;
     std::vector<std::string> lines;
     std::string outFileName;
     std::string pathToCommandFile;
     std::stringstream outputFile;
+    uint32_t jobsCount = 1;
     bool quiet = false;
 };
 
@@ -11,8 +11,10 @@
 #include "shared/source/utilities/const_stringref.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <fstream>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <string>
@@ -61,10 +63,14 @@ class OclocArgHelper {
     bool sourceFileExists(const std::string &filename) const;
 
     inline void addOutput(const std::string &filename, const void *data, const size_t &size) {
-        outputs.push_back(std::make_unique<Output>(filename, data, size));
+        auto &outputsForThread = capturedOutputsForThread ? *capturedOutputsForThread : outputs;
+        outputsForThread.push_back(std::make_unique<Output>(filename, data, size));
     }
 
-    bool verbose = false;
+    static inline thread_local std::vector<std::unique_ptr<Output>> *capturedOutputsForThread = nullptr;
+    static inline thread_local bool verboseForThread = false;
+
+    std::atomic<bool> verbose = false;
 
   public:
     OclocArgHelper();
@@ -97,15 +103,30 @@ class OclocArgHelper {
     }
 
     bool isVerbose() const {
-        return verbose;
+        return capturedOutputsForThread ? verboseForThread : verbose.load();
     }
 
+    // While outputs of the calling thread are captured, verbosity only applies to that thread.
     void setVerbose(bool verbose) {
+        if (capturedOutputsForThread) {
+            verboseForThread = verbose;
+            return;
+        }
         this->verbose = verbose;
     }
 
     MOCKABLE_VIRTUAL void saveOutput(const std::string &filename, const void *pData, const size_t &dataSize);
 
+    // Outputs saved by the calling thread are collected in given container instead of shared outputs.
+    void setCapturedOutputsForCurrentThread(std::vector<std::unique_ptr<Output>> *capturedOutputs) {
+        capturedOutputsForThread = capturedOutputs;
+        verboseForThread = verbose;
+    }
+    void appendCapturedOutputs(std::vector<std::unique_ptr<Output>> &capturedOutputs) {
+        std::move(capturedOutputs.begin(), capturedOutputs.end(), std::back_inserter(outputs));
+        capturedOutputs.clear();
+    }
+
     MessagePrinter &getPrinterRef() { return messagePrinter; }
     void printf(const char *message) {
         messagePrinter.printf(message);
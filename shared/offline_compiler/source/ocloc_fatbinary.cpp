@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,10 +26,13 @@
 #include "platforms.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <cstdio>
+#include <cstdlib>
 #include <set>
+#include <thread>
 
 namespace NEO {
 
@@ -281,30 +284,25 @@ int getDeviceArgValueIdx(const std::vector<std::string> &args) {
     return -1;
 }
 
-int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
-                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
-
-    if (retVal == 0) {
-        retVal = buildWithSafetyGuard(pCompiler);
-        std::string buildLog = pCompiler->getBuildLog();
-        if (buildLog.empty() == false) {
-            argHelper->printf("%s\n", buildLog.c_str());
-        }
-        if (retVal == 0) {
-            if (!pCompiler->isQuiet())
-                argHelper->printf("Build succeeded for : %s.\n", product.c_str());
-        } else {
-            argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
-            argHelper->printf("Command was:");
-            for (const auto &arg : argsCopy)
-                argHelper->printf(" %s", arg.c_str());
-            argHelper->printf("\n");
-        }
+int printBuildResultForTarget(int retVal, const std::vector<std::string> &argsCopy, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+    std::string buildLog = pCompiler->getBuildLog();
+    if (buildLog.empty() == false) {
+        argHelper->printf("%s\n", buildLog.c_str());
     }
-    if (retVal) {
-        return retVal;
+    if (retVal == 0) {
+        if (!pCompiler->isQuiet())
+            argHelper->printf("Build succeeded for : %s.\n", product.c_str());
+    } else {
+        argHelper->printf("Build failed for : %s with error code: %d\n", product.c_str(), retVal);
+        argHelper->printf("Command was:");
+        for (const auto &arg : argsCopy)
+            argHelper->printf(" %s", arg.c_str());
+        argHelper->printf("\n");
     }
+    return retVal;
+}
 
+void appendTargetToFatBinary(const std::string &pointerSize, Ar::ArEncoder &fatbinary, OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
     std::string entryName("");
     if (product.find(".") != std::string::npos) {
         entryName = product;
@@ -321,9 +319,71 @@ int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy
     }
 
     fatbinary.appendFileEntry(pointerSize + "." + entryName, pCompiler->getPackedDeviceBinaryOutput());
+}
+
+int buildFatBinaryForTarget(int retVal, const std::vector<std::string> &argsCopy, std::string pointerSize, Ar::ArEncoder &fatbinary,
+                            OfflineCompiler *pCompiler, OclocArgHelper *argHelper, const std::string &product) {
+
+    if (retVal == 0) {
+        retVal = buildWithSafetyGuard(pCompiler);
+        retVal = printBuildResultForTarget(retVal, argsCopy, pCompiler, argHelper, product);
+    }
+    if (retVal) {
+        return retVal;
+    }
+
+    appendTargetToFatBinary(pointerSize, fatbinary, pCompiler, argHelper, product);
     return retVal;
 }
 
+int buildFatBinaryForTargetsConcurrently(const std::vector<std::string> &argsCopy, size_t deviceArgIndex, const std::vector<ConstStringRef> &targetProducts, uint32_t jobsCount,
+                                         const std::string &pointerSize, Ar::ArEncoder &fatbinary, OclocArgHelper *argHelper, std::string &optionsForIr) {
+    std::vector<std::vector<std::string>> targetsArgs(targetProducts.size(), argsCopy);
+    std::vector<std::unique_ptr<OfflineCompiler>> compilers(targetProducts.size());
+    for (size_t targetId = 0; targetId < targetProducts.size(); targetId++) {
+        int retVal = 0;
+        targetsArgs[targetId][deviceArgIndex] = targetProducts[targetId].str();
+
+        compilers[targetId].reset(OfflineCompiler::create(targetsArgs[targetId].size(), targetsArgs[targetId], false, retVal, argHelper));
+        if (OCLOC_SUCCESS != retVal) {
+            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+            return retVal;
+        }
+    }
+
+    // Signal based safety guard is process-wide, so worker threads invoke build directly.
+    std::vector<int> buildResults(compilers.size(), OCLOC_SUCCESS);
+    std::atomic<size_t> nextTargetId{0};
+    auto buildTargets = [&]() {
+        for (auto targetId = nextTargetId++; targetId < compilers.size(); targetId = nextTargetId++) {
+            buildResults[targetId] = compilers[targetId]->build();
+        }
+    };
+
+    const auto workersCount = std::min(static_cast<size_t>(jobsCount), compilers.size());
+    std::vector<std::thread> workers;
+    for (size_t workerId = 1; workerId < workersCount; workerId++) {
+        workers.emplace_back(buildTargets);
+    }
+    buildTargets();
+    for (auto &worker : workers) {
+        worker.join();
+    }
+
+    for (size_t targetId = 0; targetId < compilers.size(); targetId++) {
+        const auto product = targetProducts[targetId].str();
+        const auto retVal = printBuildResultForTarget(buildResults[targetId], targetsArgs[targetId], compilers[targetId].get(), argHelper, product);
+        if (retVal) {
+            return retVal;
+        }
+        appendTargetToFatBinary(pointerSize, fatbinary, compilers[targetId].get(), argHelper, product);
+        if (optionsForIr.empty()) {
+            optionsForIr = compilers[targetId]->getOptions();
+        }
+    }
+    return OCLOC_SUCCESS;
+}
+
 int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelper) {
     std::string pointerSizeInBits = (sizeof(void *) == 4) ? "32" : "64";
     size_t deviceArgIndex = -1;
@@ -332,6 +392,8 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
     std::string outputDirectory = "";
     bool spirvInput = false;
     bool excludeIr = false;
+    uint32_t jobsCount = 1;
+    std::vector<size_t> jobsArgIndices;
     std::set<std::string> deviceAcronymsFromDeviceOptions;
 
     std::vector<std::string> argsCopy(args);
@@ -365,6 +427,21 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
                 deviceAcronymsFromDeviceOptions.insert(deviceAcronym.str());
             }
             argIndex += 2;
+        } else if ((ConstStringRef("-jobs") == currArg) && hasMoreArgs) {
+            if (!parseJobsCount(args[argIndex + 1], jobsCount)) {
+                argHelper->printf("Error! Invalid number of jobs: %s\n", args[argIndex + 1].c_str());
+                return OCLOC_INVALID_COMMAND_LINE;
+            }
+            jobsArgIndices.push_back(argIndex);
+            ++argIndex;
+        }
+    }
+
+    // -jobs is handled here, per-target compilers don't accept it
+    for (auto jobsArgIndex = jobsArgIndices.rbegin(); jobsArgIndex != jobsArgIndices.rend(); ++jobsArgIndex) {
+        argsCopy.erase(argsCopy.begin() + *jobsArgIndex, argsCopy.begin() + *jobsArgIndex + 2);
+        if (deviceArgIndex != static_cast<size_t>(-1) && deviceArgIndex > *jobsArgIndex) {
+            deviceArgIndex -= 2;
         }
     }
 
@@ -392,22 +469,29 @@ int buildFatBinary(const std::vector<std::string> &args, OclocArgHelper *argHelp
         }
     }
     std::string optionsForIr;
-    for (const auto &product : targetProducts) {
-        int retVal = 0;
-        argsCopy[deviceArgIndex] = product.str();
-
-        std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
-        if (OCLOC_SUCCESS != retVal) {
-            argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
-            return retVal;
-        }
-
-        retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+    if (jobsCount > 1 && targetProducts.size() > 1) {
+        const auto retVal = buildFatBinaryForTargetsConcurrently(argsCopy, deviceArgIndex, targetProducts, jobsCount, pointerSizeInBits, fatbinary, argHelper, optionsForIr);
         if (retVal) {
             return retVal;
         }
-        if (optionsForIr.empty()) {
-            optionsForIr = pCompiler->getOptions();
+    } else {
+        for (const auto &product : targetProducts) {
+            int retVal = 0;
+            argsCopy[deviceArgIndex] = product.str();
+
+            std::unique_ptr<OfflineCompiler> pCompiler{OfflineCompiler::create(argsCopy.size(), argsCopy, false, retVal, argHelper)};
+            if (OCLOC_SUCCESS != retVal) {
+                argHelper->printf("Error! Couldn't create OfflineCompiler. Exiting.\n");
+                return retVal;
+            }
+
+            retVal = buildFatBinaryForTarget(retVal, argsCopy, pointerSizeInBits, fatbinary, pCompiler.get(), argHelper, product.str());
+            if (retVal) {
+                return retVal;
+            }
+            if (optionsForIr.empty()) {
+                optionsForIr = pCompiler->getOptions();
+            }
         }
     }
 
@@ -1457,6 +1457,11 @@ Usage: ocloc [compile] -file <filename> -device <device_type> [-output <filename
 
   -config                                   Target hardware info config for a single device,
                                             e.g 1x4x8.
+
+  -jobs <count>                             Number of target devices built concurrently.
+                                            Valid only when multiple target devices are requested.
+                                            0 - use all available hardware threads.
+                                            Default: 1.
 %s
 Examples :
   Compile file to Intel Compute GPU device binary (out = source_file_Gen9core.bin)
@@ -26,6 +26,7 @@
 #include "shared/source/helpers/flat_batch_buffer_helper.h"
 #include "shared/source/helpers/flush_stamp.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/in_order_cmd_helpers.h"
 #include "shared/source/helpers/pause_on_gpu_properties.h"
 #include "shared/source/helpers/ray_tracing_helper.h"
 #include "shared/source/memory_manager/allocation_properties.h"
@@ -73,6 +74,12 @@ CommandStreamReceiver::CommandStreamReceiver(ExecutionEnvironment &executionEnvi
         indirectHeap[i] = nullptr;
     }
     internalAllocationStorage = std::make_unique<InternalAllocationStorage>(*this);
+    if (debugManager.flags.EnableAdaptiveWaitPolicy.get() == 1) {
+        adaptiveWaitPolicy = std::make_unique<WaitUtils::AdaptiveWaitPolicy>();
+    }
+    if (debugManager.flags.EnableInOrderSemaphoreWaitElision.get() == 1) {
+        inOrderSatisfiedCounters = std::make_unique<InOrderSatisfiedCounters>();
+    }
     const auto &hwInfo = peekHwInfo();
     uint32_t subDeviceCount = static_cast<uint32_t>(deviceBitfield.count());
     auto &gfxCoreHelper = getGfxCoreHelper();
@@ -496,6 +503,7 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
         }
     }
     volatile TagAddressType *partitionAddress = pollAddress;
+    auto waitPolicy = adaptiveWaitPolicy.get();
 
     waitStartTime = std::chrono::high_resolution_clock::now();
     lastHangCheckTime = waitStartTime;
@@ -503,8 +511,12 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
         while (*partitionAddress < taskCountToWait && (!params.enableTimeout || timeDiff <= params.waitTimeout)) {
             this->downloadTagAllocation(taskCountToWait);
 
-            if (!params.indefinitelyPoll && WaitUtils::waitFunction(partitionAddress, taskCountToWait, timeDiff)) {
-                break;
+            if (!params.indefinitelyPoll) {
+                bool waitCompleted = waitPolicy ? waitPolicy->wait(partitionAddress, taskCountToWait, timeDiff)
+                                                : WaitUtils::waitFunction(partitionAddress, taskCountToWait, timeDiff);
+                if (waitCompleted) {
+                    break;
+                }
             }
 
             currentTime = std::chrono::high_resolution_clock::now();
@@ -526,6 +538,11 @@ WaitStatus CommandStreamReceiver::baseWaitFunction(volatile TagAddressType *poll
         partitionAddress = ptrOffset(partitionAddress, this->immWritePostSyncWriteOffset);
     }
 
+    if (waitPolicy) {
+        currentTime = std::chrono::high_resolution_clock::now();
+        waitPolicy->recordCompletion(std::chrono::duration_cast<std::chrono::microseconds>(currentTime - waitStartTime).count());
+    }
+
     return WaitStatus::ready;
 }
 
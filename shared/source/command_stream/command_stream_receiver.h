@@ -74,6 +74,11 @@ class TimestampPackets;
 template <typename T1>
 class TagAllocator;
 class TagNodeBase;
+class InOrderSatisfiedCounters;
+
+namespace WaitUtils {
+class AdaptiveWaitPolicy;
+} // namespace WaitUtils
 
 enum class DispatchMode {
     deviceDefault = 0,          // default for given device
@@ -172,6 +177,8 @@ class CommandStreamReceiver : NEO::NonCopyableAndNonMovableClass {
     TaskCountType peekBarrierCount() const { return this->barrierCount.load(); }
     volatile TagAddressType *getTagAddress() const { return tagAddress; }
     volatile TagAddressType *getBarrierCountTagAddress() const { return this->barrierCountTagAddress; }
+    WaitUtils::AdaptiveWaitPolicy *getAdaptiveWaitPolicy() const { return adaptiveWaitPolicy.get(); }
+    InOrderSatisfiedCounters *getInOrderSatisfiedCounters() const { return inOrderSatisfiedCounters.get(); }
     uint64_t getBarrierCountGpuAddress() const;
     uint64_t getDebugPauseStateGPUAddress() const;
 
@@ -583,6 +590,8 @@ class CommandStreamReceiver : NEO::NonCopyableAndNonMovableClass {
     std::atomic<uint32_t> requestedPreallocationsAmount{0};
 
     std::unique_ptr<KmdNotifyHelper> kmdNotifyHelper;
+    std::unique_ptr<WaitUtils::AdaptiveWaitPolicy> adaptiveWaitPolicy;
+    std::unique_ptr<InOrderSatisfiedCounters> inOrderSatisfiedCounters;
     std::unique_ptr<ScratchSpaceController> scratchSpaceController;
     std::unique_ptr<TagAllocatorBase> profilingTimeStampAllocator;
     std::unique_ptr<TagAllocatorBase> perfCounterAllocator;
@@ -11,6 +11,8 @@
 
 namespace NEO {
 
+std::atomic<uint64_t> LinearStream::nextBufferId{0};
+
 LinearStream::LinearStream(GraphicsAllocation *gfxAllocation, void *buffer, size_t bufferSize)
     : maxAvailableSpace(bufferSize), buffer(buffer), graphicsAllocation(gfxAllocation) {
 }
@@ -11,6 +11,7 @@
 #include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/helpers/ptr_math.h"
 
+#include <atomic>
 #include <cstdint>
 
 namespace NEO {
@@ -41,6 +42,7 @@ class LinearStream : NEO::NonCopyableAndNonMovableClass {
     void replaceBuffer(void *buffer, size_t bufferSize);
     GraphicsAllocation *getGraphicsAllocation() const;
     void replaceGraphicsAllocation(GraphicsAllocation *gfxAllocation);
+    uint64_t getBufferId() const { return bufferId; }
 
     template <typename Cmd>
     Cmd *getSpaceForCmd() {
@@ -56,6 +58,10 @@ class LinearStream : NEO::NonCopyableAndNonMovableClass {
     CommandContainer *cmdContainer{nullptr};
     size_t batchBufferEndSize{0};
     uint64_t gpuBase{0};
+
+    // unique for every buffer placed in a stream, offsets recorded in a replaced buffer are stale
+    static std::atomic<uint64_t> nextBufferId;
+    uint64_t bufferId{nextBufferId++};
 };
 
 inline void *LinearStream::getCpuBase() const {
@@ -103,6 +109,7 @@ inline void LinearStream::replaceBuffer(void *buffer, size_t bufferSize) {
     this->buffer = buffer;
     maxAvailableSpace = bufferSize;
     sizeUsed = 0;
+    bufferId = nextBufferId++;
 }
 
 inline GraphicsAllocation *LinearStream::getGraphicsAllocation() const {
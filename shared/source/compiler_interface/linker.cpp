@@ -25,6 +25,7 @@
 
 #include "RelocationInfo.h"
 
+#include <algorithm>
 #include <sstream>
 #include <unordered_map>
 
@@ -263,7 +264,7 @@ bool LinkerInput::addSymbol(Elf::Elf<numBits> &elf, const SectionNameToSegmentId
 
             traits.exportsFunctions = true;
             exportedFunctionsSegmentId = static_cast<int32_t>(symbolInfo.instructionSegmentId);
-            extFuncSymbols.push_back({symbolName, symbolInfo});
+            addExtFuncSymbol(symbolName, symbolInfo);
         }
     } else {
         return false;
@@ -295,23 +296,45 @@ void LinkerInput::decodeElfSymbolTableAndRelocations(Elf::Elf<numBits> &elf, con
     }
 }
 
-void LinkerInput::parseRelocationForExtFuncUsage(const RelocationInfo &relocInfo, const std::string &kernelName) {
-    auto extFuncSymIt = std::find_if(extFuncSymbols.begin(), extFuncSymbols.end(), [relocInfo](auto &pair) {
-        return pair.first == relocInfo.symbolName;
+void LinkerInput::addExtFuncSymbol(const std::string &symbolName, const SymbolInfo &symbolInfo) {
+    auto symbolId = extFuncSymbols.size();
+    extFuncSymbols.push_back({symbolName, symbolInfo});
+    extFuncSymbolIdsByName.emplace(symbolName, symbolId);
+
+    auto insertPos = std::upper_bound(extFuncSymbolIdsSortedByOffset.begin(), extFuncSymbolIdsSortedByOffset.end(), symbolInfo.offset, [this](uint64_t symbolOffset, size_t id) {
+        return symbolOffset < extFuncSymbols[id].second.offset;
     });
-    if (extFuncSymIt != extFuncSymbols.end()) {
-        if (kernelName == Zebin::Elf::SectionNames::externalFunctions.str()) {
-            auto callerIt = std::find_if(extFuncSymbols.begin(), extFuncSymbols.end(), [relocInfo](auto &pair) {
-                auto &symbol = pair.second;
-                return relocInfo.offset >= symbol.offset && relocInfo.offset < symbol.offset + symbol.size;
-            });
-            if (callerIt != extFuncSymbols.end()) {
-                extFunDependencies.push_back({relocInfo.symbolName, callerIt->first});
-            }
-        } else {
-            kernelDependencies.push_back({relocInfo.symbolName, kernelName});
+    extFuncSymbolIdsSortedByOffset.insert(insertPos, symbolId);
+}
+
+const std::pair<std::string, SymbolInfo> *LinkerInput::findExtFuncSymbolContainingOffset(uint64_t offset) const {
+    auto it = std::upper_bound(extFuncSymbolIdsSortedByOffset.begin(), extFuncSymbolIdsSortedByOffset.end(), offset, [this](uint64_t symbolOffset, size_t id) {
+        return symbolOffset < extFuncSymbols[id].second.offset;
+    });
+    while (it != extFuncSymbolIdsSortedByOffset.begin()) {
+        --it;
+        auto &symbol = extFuncSymbols[*it].second;
+        if (offset < symbol.offset + symbol.size) {
+            return &extFuncSymbols[*it];
+        }
+        if (symbol.size != 0U) {
+            break;
         }
     }
+    return nullptr;
+}
+
+void LinkerInput::parseRelocationForExtFuncUsage(const RelocationInfo &relocInfo, const std::string &kernelName) {
+    if (extFuncSymbolIdsByName.find(relocInfo.symbolName) == extFuncSymbolIdsByName.end()) {
+        return;
+    }
+    if (kernelName == Zebin::Elf::SectionNames::externalFunctions.str()) {
+        if (auto caller = findExtFuncSymbolContainingOffset(relocInfo.offset)) {
+            extFunDependencies.push_back({relocInfo.symbolName, caller->first});
+        }
+    } else {
+        kernelDependencies.push_back({relocInfo.symbolName, kernelName});
+    }
 }
 
 LinkingStatus Linker::link(const SegmentInfo &globalVariablesSegInfo, const SegmentInfo &globalConstantsSegInfo, const SegmentInfo &exportedFunctionsSegInfo,
@@ -534,13 +557,17 @@ void Linker::patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const
     if (isAnyRelocationPerformed) {
         auto &rootDeviceEnvironment = pDevice->getRootDeviceEnvironment();
         auto &productHelper = pDevice->getProductHelper();
+        MemoryTransfers dataSegmentsTransfers;
         if (globalConstantsSeg) {
             bool useBlitter = productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *globalConstantsSeg);
-            MemoryTransferHelper::transferMemoryToAllocation(useBlitter, *pDevice, globalConstantsSeg, 0, constantsData.data(), constantsData.size());
+            dataSegmentsTransfers.push_back({globalConstantsSeg, 0, constantsData.data(), constantsData.size(), useBlitter});
         }
         if (globalVariablesSeg) {
             bool useBlitter = productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *globalVariablesSeg);
-            MemoryTransferHelper::transferMemoryToAllocation(useBlitter, *pDevice, globalVariablesSeg, 0, variablesData.data(), variablesData.size());
+            dataSegmentsTransfers.push_back({globalVariablesSeg, 0, variablesData.data(), variablesData.size(), useBlitter});
+        }
+        if (!dataSegmentsTransfers.empty()) {
+            MemoryTransferHelper::transferMemoryToAllocations(*pDevice, dataSegmentsTransfers);
         }
     }
 }
@@ -157,6 +157,10 @@ struct LinkerInput : NEO::NonCopyableAndNonMovableClass {
         return textRelocations;
     }
 
+    bool hasRelocationsInInstructionSegment(size_t instructionsSegmentId) const {
+        return (instructionsSegmentId < textRelocations.size()) && (false == textRelocations[instructionsSegmentId].empty());
+    }
+
     const Relocations &getDataRelocations() const {
         return dataRelocations;
     }
@@ -179,10 +183,14 @@ struct LinkerInput : NEO::NonCopyableAndNonMovableClass {
 
   protected:
     void parseRelocationForExtFuncUsage(const RelocationInfo &relocInfo, const std::string &kernelName);
+    void addExtFuncSymbol(const std::string &symbolName, const SymbolInfo &symbolInfo);
+    const std::pair<std::string, SymbolInfo> *findExtFuncSymbolContainingOffset(uint64_t offset) const;
 
     Traits traits;
     SymbolMap symbols;
     std::vector<std::pair<std::string, SymbolInfo>> extFuncSymbols;
+    std::unordered_map<std::string, size_t> extFuncSymbolIdsByName;
+    std::vector<size_t> extFuncSymbolIdsSortedByOffset;
     Relocations dataRelocations;
     RelocationsPerInstSegment textRelocations;
     std::vector<ExternalFunctionUsageKernel> kernelDependencies;
@@ -103,6 +103,9 @@ DECLARE_DEBUG_VARIABLE(std::string, OverrideDeviceName, std::string("unk"), "Ove
 DECLARE_DEBUG_VARIABLE(std::string, OverridePlatformName, std::string("unk"), "Override platform name to provided string; ignored when unk")
 DECLARE_DEBUG_VARIABLE(std::string, WddmResidencyLoggerOutputDirectory, std::string("unk"), "Selects non-default output directory for Wddm Residency logger file")
 DECLARE_DEBUG_VARIABLE(std::string, ToggleBitIn57GpuVa, std::string("unk"), "Toggles specific bit in GPU VA for given allocation type from heap extended. Format <allocation type 1>:<bit number 1>,<allocation type 2>:<bit number 2>")
+DECLARE_DEBUG_VARIABLE(std::string, KernelTimingTraceFile, std::string("unk"), "Output file of kernel timing trace, kernel_timing_trace.json or kernel_timing_trace.bin is used when unk")
+DECLARE_DEBUG_VARIABLE(std::string, ApiCaptureFile, std::string("unk"), "Output file of API capture, api_capture.bin is used when unk")
+DECLARE_DEBUG_VARIABLE(std::string, LocalWorkSizeAutotuneCacheFile, std::string("unk"), "File storing tuned local work sizes, lws_autotune.cache in compiler cache directory is used when unk, results are not persisted when compiler cache is disabled")
 DECLARE_DEBUG_VARIABLE(std::string, DisableIndirectDetectionForKernelNames, std::string("unk"), "If kernel name contains flag value (pass part of kernel name) OR flag value contains kernel name (pass list of exact names), disable indirect detection for it; ignored when unk")
 DECLARE_DEBUG_VARIABLE(int64_t, OverrideMultiStoragePlacement, -1, "Place memory only in selected tiles indicated by bit mask; ignore when -1")
 DECLARE_DEBUG_VARIABLE(int64_t, ForceCompressionDisabledForCompressedBlitCopies, -1, "If compression is required, set AUX_CCS_E, but force CompressionEnable filed; 0 should result in uncompressed read/write; values = -1: default, 0: disabled, 1: enabled")
@@ -338,6 +341,15 @@ DECLARE_DEBUG_VARIABLE(bool, LogAllocationType, false, "Logs allocation type to
 DECLARE_DEBUG_VARIABLE(bool, LogAllocationStdout, false, "Log allocations to stdout instead of file")
 DECLARE_DEBUG_VARIABLE(bool, LogMemoryObject, false, "Logs memory object ptrs, sizes and operations")
 DECLARE_DEBUG_VARIABLE(bool, LogWaitingForCompletion, false, "Logs waiting for completion")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelTimingTrace, -1, "-1: default (disabled), 0: disabled, 1: record start and end timestamps of kernels appended without signal event to immediate command lists and write them to KernelTimingTraceFile, in-order lists signal their counter with a barrier after traced kernels")
+DECLARE_DEBUG_VARIABLE(int32_t, KernelTimingTraceFormat, 0, "Format of kernel timing trace, 0: Chrome trace JSON, 1: compact binary")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalWorkSizeAutotune, -1, "-1: default (disabled), 0: disabled, 1: measure candidate local work sizes of launches without local work size provided by application and reuse the fastest one")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableSurfaceStateBlockReuse, -1, "-1: default (disabled), 0: disabled, 1: point binding table of kernel with unchanged surface states at block emitted by its previous enqueue instead of copying it again")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncPrintfOutput, -1, "-1: default (disabled), 0: disabled, 1: enqueue of kernel using printf does not wait for its completion, output is printed by completion reactor thread and flushed by clFinish and blocking calls")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyMaxWorkersCount, -1, "-1: default (1), >0: maximal number of threads splitting host side copies of buffers and images, 1 disables splitting")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuCopyNonTemporalThreshold, -1, "-1: default (4MB), 0: disabled, >0: size in bytes above which host side copies of buffers and images use non-temporal stores")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableApiCapture, -1, "-1: default (disabled), 0: disabled, 1: write every OpenCL API call with its arguments, return value and CPU time to ApiCaptureFile")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableLazyDeviceInitialization, -1, "-1: default (disabled), 0: disabled, 1: defer initialization and state init submission of non-default engines to their first use; devices, engines, CSRs, tag allocations and state SIP are still created eagerly")
 DECLARE_DEBUG_VARIABLE(bool, LogUsmReuse, false, "Logs operations of usm reuse to csv file")
 DECLARE_DEBUG_VARIABLE(bool, ResidencyDebugEnable, false, "enables debug messages and checks for Residency Model")
 DECLARE_DEBUG_VARIABLE(bool, EventsDebugEnable, false, "enables debug messages for events, virtual events, blocked enqueues, events trees etc.")
@@ -360,6 +372,13 @@ DECLARE_DEBUG_VARIABLE(bool, PrintIoctlEntries, false, "Print ioctl being called
 DECLARE_DEBUG_VARIABLE(bool, PrintUmdSharedMigration, false, "Print log message when shared allocation is being migrated by UMD")
 DECLARE_DEBUG_VARIABLE(bool, PrintImageBlitBlockCopyCmdDetails, false, "Prints XY_BLOCK_COPY_BLT command details")
 DECLARE_DEBUG_VARIABLE(bool, PrintCompletionFenceUsage, false, "Prints all usages of DRM completion fences")
+DECLARE_DEBUG_VARIABLE(bool, PrintWaitListCompaction, false, "Prints number of wait list dependencies elided by compaction")
+DECLARE_DEBUG_VARIABLE(bool, PrintInOrderSemaphoreWaitElision, false, "Prints in-order semaphore waits skipped because they are already satisfied on the engine")
+DECLARE_DEBUG_VARIABLE(bool, PrintEventUnblockBatch, false, "Prints number of events unblocked and submissions deferred by each event unblock batch")
+DECLARE_DEBUG_VARIABLE(bool, PrintImmediateCmdListDeferredFlush, false, "Prints number of accumulated appends and reason of each deferred flush of immediate command list")
+DECLARE_DEBUG_VARIABLE(bool, PrintDeviceInitializationTimes, false, "Prints time spent in each phase of device initialization")
+DECLARE_DEBUG_VARIABLE(bool, PrintLocalWorkSizeAutotune, false, "Prints local work size selected by autotuner for each kernel and global work size")
+DECLARE_DEBUG_VARIABLE(bool, PrintAsyncEventsHandlerStatistics, false, "Prints OCL async events handler statistics (processed events, callback latency) when handler thread is closed")
 DECLARE_DEBUG_VARIABLE(bool, PrintKernelDispatchParameters, false, "Prints kernel parameters used in tg dispatch size heuristic on encode dispatch kernel")
 DECLARE_DEBUG_VARIABLE(bool, LogGdiCalls, false, "Log GDI calls")
 DECLARE_DEBUG_VARIABLE(bool, LogGdiCallsToFile, false, "Log GDI calls to file")
@@ -399,6 +418,15 @@ DECLARE_DEBUG_VARIABLE(int32_t, PerformImplicitFlushForIdleGpu, -1, "-1: platfor
 DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalkerForAllQueues, -1, "Enable cache flush after walker even if queue doesn't require it")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideUseKmdWaitFunction, -1, "-1: default (L0: disabled), 0: disabled, 1: enabled. It uses only busy loop to wait or busy loop with KMD wait function, when KMD fallback is enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ResolveDependenciesViaPipeControls, -1, "-1: default , 0: disabled, 1: enabled. If enabled, instead of programming semaphores, dependencies are resolved using task levels")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableWaitListCompaction, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, wait list dependencies are collapsed to one per timeline and completed ones are dropped")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableInOrderSemaphoreWaitElision, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, in-order counter waits already satisfied by semaphores submitted earlier to the same engine are skipped")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableEventUnblockBatching, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, commands unblocked by an event status change are processed iteratively and submitted in one batched flush per CSR")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableImmediateCmdListDeferredFlush, -1, "-1: default (disabled), 0: disabled, 1: enabled. If enabled, independent appends on out-of-order immediate command lists are accumulated and submitted together")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListDeferredFlushMaxAppends, -1, "-1: default (32), >0: number of accumulated appends that forces deferred flush of immediate command list")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListDeferredFlushMaxBytes, -1, "-1: default (64KB), >=0: size in bytes of accumulated commands that forces deferred flush of immediate command list")
+DECLARE_DEBUG_VARIABLE(int32_t, ImmediateCmdListDeferredFlushTimeoutUs, -1, "-1: default (100), >=0: time in microseconds since first accumulated append after which next append forces deferred flush of immediate command list")
+DECLARE_DEBUG_VARIABLE(int32_t, LocalWorkSizeAutotuneSamples, -1, "-1: default (3), >0: number of measurements of each candidate local work size before autotuner selects the fastest one")
+DECLARE_DEBUG_VARIABLE(int32_t, LocalWorkSizeAutotuneMaxCandidates, -1, "-1: default (8), >0: maximal number of candidate local work sizes measured by autotuner, including the default one")
 DECLARE_DEBUG_VARIABLE(int32_t, MakeIndirectAllocationsResidentAsPack, -1, "-1: default, 0:disabled, 1: enabled. If enabled, driver handles all indirect allocations as one pack instead of making them resident individually.")
 DECLARE_DEBUG_VARIABLE(int32_t, DetectIndirectAccessInKernel, -1, "-1: default, 0:disabled, 1: enabled. If enabled and indirect accesses are not detected in kernel, indirect allocations will not be allowed even if set by API.")
 DECLARE_DEBUG_VARIABLE(int32_t, MakeEachAllocationResident, -1, "-1: default, 0: disabled, 1: bind every allocation at creation time, 2: bind all created allocations in flush")
@@ -506,6 +534,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, EnableCacheFlushAfterWalker, -1, "-1: platform b
 DECLARE_DEBUG_VARIABLE(int32_t, EnableLocalMemory, -1, "-1: default behavior, 0: disabled, 1: enabled, Allows allocating graphics memory in Local Memory")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableStatelessToStatefulBufferOffsetOpt, -1, "-1: don't override, 0: disable, 1: enable, Enables buffer-offset improvement of the stateless to stateful optimization")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableVaLibCalls, -1, "-1: default, 0: disable, 1: enable cl-va sharing lib calls")
+DECLARE_DEBUG_VARIABLE(int32_t, VaSurfaceImportCacheSize, -1, "-1: default (0), 0: disabled, >0: number of imported dma-buf VA surfaces kept per context and reused by later cl-va sharing calls for the same surface and plane")
 DECLARE_DEBUG_VARIABLE(int32_t, CreateMultipleRootDevices, 0, "0: default - disable, 1+: Driver will create multiple (N) devices during initialization.")
 DECLARE_DEBUG_VARIABLE(int32_t, CreateMultipleSubDevices, 0, "0: default - disable, 1+: Driver will create multiple (N) sub devices during initialization.")
 DECLARE_DEBUG_VARIABLE(int32_t, LimitAmountOfReturnedDevices, 0, "0: default - disable, 1+: Driver will limit the number of devices returned from clGetDeviceIds to N.")
@@ -533,6 +562,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmSize, -1, "Force per subslice slm siz
 DECLARE_DEBUG_VARIABLE(int32_t, UseCyclesPerSecondTimer, 0, "0: default behavior, 0: disabled: Report L0 timer in nanosecond units, 1: enabled: Report L0 timer in cycles per second")
 DECLARE_DEBUG_VARIABLE(int32_t, WaitLoopCount, -1, "-1: use default, >=0: number of iterations in wait loop")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableWaitpkg, -1, "-1: use default, 0: disable, 1: UMONITOR/UMWAIT 2: TPAUSE")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveWaitPolicy, -1, "-1: default (disabled), 0: disabled, 1: enabled - choose spin, monitor wait or sleep based on per engine completion latency histogram")
 DECLARE_DEBUG_VARIABLE(int32_t, GTPinAllocateBufferInSharedMemory, -1, "Force GTPin to allocate buffer in shared memory")
 DECLARE_DEBUG_VARIABLE(int32_t, AlignLocalMemoryVaTo2MB, -1, "Allow 2MB pages for allocations with size>=2MB. On Linux it means aligned VA, on Windows it means aligned size. -1: default, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableUserFenceForCompletionWait, -1, "-1: default (disabled), 0: disable, 1: enable : Use Wait User Fence instead Gem Wait")
@@ -590,6 +620,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override d
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalForceCopyThroughLock, -1, "Force copy through lock pointer on zeAppendMemoryCopy for all cases -1: default 0: disable 1: enable ")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallBufferPoolAllocator, -1, "Experimentally enable pool allocator for clCreateBuffer under 4KB.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSmallImagePoolAllocator, -1, "Experimentally enable pool allocator for small linear 2D images in clCreateImage, -1: default (disabled), 0: disabled, 1: enabled for single device contexts")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLockWaitlistSizeThreshold, -1, "If less than given value, driver will wait for Waitlist on host, instead of sending appendBarrier. If 0, always use barrier.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableL0DebuggerForOpenCL, false, "Experimentally enable debugging OCL with L0 Debug API. When enabled - Level Zero debugging is disabled.")
 DECLARE_DEBUG_VARIABLE(bool, ExperimentalEnableTileAttach, true, "Experimentally enable attaching to tiles (subdevices).")
@@ -35,6 +35,8 @@
 #include "shared/source/unified_memory/usm_memory_support.h"
 #include "shared/source/utilities/software_tags_manager.h"
 
+#include <chrono>
+
 namespace NEO {
 
 decltype(&PerformanceCounters::create) Device::createPerformanceCountersFunc = PerformanceCounters::create;
@@ -43,7 +45,7 @@ extern CommandStreamReceiver *createCommandStream(ExecutionEnvironment &executio
                                                   const DeviceBitfield deviceBitfield);
 
 Device::Device(ExecutionEnvironment *executionEnvironment, const uint32_t rootDeviceIndex)
-    : executionEnvironment(executionEnvironment), rootDeviceIndex(rootDeviceIndex), isaPoolAllocator(this), deviceTimestampPoolAllocator(this) {
+    : executionEnvironment(executionEnvironment), rootDeviceIndex(rootDeviceIndex), isaPoolAllocator(this), deviceTimestampPoolAllocator(this, false), hostTimestampPoolAllocator(this, true) {
     this->executionEnvironment->incRefInternal();
     this->executionEnvironment->rootDeviceEnvironments[rootDeviceIndex]->setDummyBlitProperties(rootDeviceIndex);
     if (auto ailHelper = this->executionEnvironment->rootDeviceEnvironments[rootDeviceIndex]->getAILConfigurationHelper(); ailHelper && ailHelper->isAdjustMicrosecondResolutionRequired()) {
@@ -54,6 +56,9 @@ Device::Device(ExecutionEnvironment *executionEnvironment, const uint32_t rootDe
 Device::~Device() {
     DEBUG_BREAK_IF(nullptr == executionEnvironment->memoryManager.get());
 
+    // pending completion watches may refer to CSRs of this device
+    executionEnvironment->drainCompletionReactor();
+
     if (performanceCounters) {
         performanceCounters->shutdown();
     }
@@ -74,6 +79,7 @@ Device::~Device() {
     syncBufferHandler.reset();
     isaPoolAllocator.releasePools();
     deviceTimestampPoolAllocator.releasePools();
+    hostTimestampPoolAllocator.releasePools();
     if (deviceUsmMemAllocPoolsManager) {
         deviceUsmMemAllocPoolsManager->cleanup();
     }
@@ -135,23 +141,37 @@ bool Device::createSubDevices() {
     return true;
 }
 
+template <typename PhaseT>
+bool Device::measureInitializationPhase(const char *phaseName, PhaseT &&phase) {
+    if (!debugManager.flags.PrintDeviceInitializationTimes.get()) {
+        return phase();
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    auto ret = phase();
+    auto elapsedUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    printDebugString(true, stdout, "Device initialization, root device %u, device bitfield 0x%lx, %s: %lld us\n",
+                     getRootDeviceIndex(), getDeviceBitfield().to_ulong(), phaseName, static_cast<long long>(elapsedUs));
+    return ret;
+}
+
 bool Device::createDeviceImpl() {
     preemptionMode = PreemptionHelper::getDefaultPreemptionMode(getHardwareInfo());
 
     if (!isSubDevice()) {
         // init sub devices first
-        if (!createSubDevices()) {
+        if (!measureInitializationPhase("sub devices", [this]() { return createSubDevices(); })) {
             return false;
         }
 
         // initialize common resources once
-        if (!initializeCommonResources()) {
+        if (!measureInitializationPhase("common resources", [this]() { return initializeCommonResources(); })) {
             return false;
         }
     }
 
     // create engines
-    if (!initDeviceWithEngines()) {
+    if (!measureInitializationPhase("engines creation", [this]() { return initDeviceWithEngines(); })) {
         return false;
     }
 
@@ -165,7 +185,7 @@ bool Device::createDeviceImpl() {
     }
 
     // continue proper init for all devices
-    return initDeviceFully();
+    return measureInitializationPhase("engines initialization", [this]() { return initDeviceFully(); });
 }
 
 bool Device::initDeviceWithEngines() {
@@ -597,10 +617,15 @@ bool Device::initializeEngines() {
         bool isHeaplessStateInit = engine.osContext->getIsPrimaryEngine() && compilerProductHelper.isHeaplessStateInitEnabled(heaplessEnabled);
         bool initializeDevice = (engine.osContext->isPartOfContextGroup() || isHeaplessStateInit) && !firstSubmissionDone;
 
+        if (initializeDevice && Device::isLazyInitializationEnabled() && !engine.osContext->getIsDefaultEngine()) {
+            // resources and initial state are created on first use of the engine
+            initializeDevice = false;
+        }
+
         if (initializeDevice) {
             engine.commandStreamReceiver->initializeResources(false, this->getPreemptionMode());
 
-            if (debugManager.flags.DeferStateInitSubmissionToFirstRegularUsage.get() != 1) {
+            if (!Device::isStateInitSubmissionDeferred()) {
                 engine.commandStreamReceiver->initializeDeviceWithFirstSubmission(*this);
             }
         }
@@ -658,6 +683,13 @@ EngineControl *Device::getSecondaryEngineCsr(EngineTypeUsage engineTypeUsage, bo
 
         if (!commandStreamReceiver->isInitialized()) {
 
+            if (Device::isLazyInitializationEnabled() && commandStreamReceiver->getPrimaryCsr()) {
+                // secondary contexts are created within context group of already initialized primary context
+                if (!commandStreamReceiver->getPrimaryCsr()->initializeResources(false, this->getPreemptionMode())) {
+                    return nullptr;
+                }
+            }
+
             if (commandStreamReceiver->needsPageTableManager()) {
                 commandStreamReceiver->createPageTableManager();
             }
@@ -707,6 +739,14 @@ bool Device::isInitDeviceWithFirstSubmissionSupported(CommandStreamReceiverType
            Device::isInitDeviceWithFirstSubmissionEnabled(csrType);
 }
 
+bool Device::isLazyInitializationEnabled() {
+    return debugManager.flags.EnableLazyDeviceInitialization.get() == 1;
+}
+
+bool Device::isStateInitSubmissionDeferred() {
+    return debugManager.flags.DeferStateInitSubmissionToFirstRegularUsage.get() == 1 || Device::isLazyInitializationEnabled();
+}
+
 double Device::getPlatformHostTimerResolution() const {
     if (getOSTime()) {
         return getOSTime()->getHostTimerResolution();
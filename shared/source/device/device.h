@@ -147,6 +147,8 @@ class Device : public ReferenceTrackedObject<Device>, NEO::NonCopyableAndNonMova
     bool isFullRangeSvm() const;
     static bool isBlitSplitEnabled();
     static bool isInitDeviceWithFirstSubmissionEnabled(CommandStreamReceiverType csrType);
+    static bool isLazyInitializationEnabled();
+    static bool isStateInitSubmissionDeferred();
     static std::vector<DeviceVector> groupDevices(DeviceVector devices);
     bool isBcsSplitSupported();
     bool isInitDeviceWithFirstSubmissionSupported(CommandStreamReceiverType csrType);
@@ -205,6 +207,9 @@ class Device : public ReferenceTrackedObject<Device>, NEO::NonCopyableAndNonMova
     TimestampPoolAllocator &getDeviceTimestampPoolAllocator() {
         return deviceTimestampPoolAllocator;
     }
+    TimestampPoolAllocator &getHostTimestampPoolAllocator() {
+        return hostTimestampPoolAllocator;
+    }
     UsmMemAllocPoolsManager *getUsmMemAllocPoolsManager() {
         return deviceUsmMemAllocPoolsManager.get();
     }
@@ -279,6 +284,8 @@ class Device : public ReferenceTrackedObject<Device>, NEO::NonCopyableAndNonMova
     bool initializeCommonResources();
     bool initDeviceFully();
     void initUsmReuseLimits();
+    template <typename PhaseT>
+    bool measureInitializationPhase(const char *phaseName, PhaseT &&phase);
     virtual bool createEngines();
 
     void addEngineToEngineGroup(EngineControl &engine);
@@ -335,6 +342,7 @@ class Device : public ReferenceTrackedObject<Device>, NEO::NonCopyableAndNonMova
 
     ISAPoolAllocator isaPoolAllocator;
     TimestampPoolAllocator deviceTimestampPoolAllocator;
+    TimestampPoolAllocator hostTimestampPoolAllocator;
     std::unique_ptr<UsmMemAllocPoolsManager> deviceUsmMemAllocPoolsManager;
     std::unique_ptr<UsmMemAllocPool> usmMemAllocPool;
 
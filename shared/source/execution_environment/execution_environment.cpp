@@ -17,6 +17,7 @@
 #include "shared/source/helpers/driver_model_type.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/strided_copy.h"
 #include "shared/source/helpers/string_helpers.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/os_agnostic_memory_manager.h"
@@ -26,6 +27,9 @@
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/utilities/completion_reactor.h"
+#include "shared/source/utilities/kernel_timing_trace.h"
+#include "shared/source/utilities/local_work_size_autotuner.h"
 
 namespace NEO {
 ExecutionEnvironment::ExecutionEnvironment() {
@@ -46,12 +50,16 @@ void ExecutionEnvironment::releaseRootDeviceEnvironmentResources(RootDeviceEnvir
 }
 
 ExecutionEnvironment::~ExecutionEnvironment() {
+    if (completionReactor) {
+        completionReactor->closeThread();
+    }
     if (directSubmissionController) {
         directSubmissionController->stopThread();
     }
     if (unifiedMemoryReuseCleaner) {
         unifiedMemoryReuseCleaner->stopThread();
     }
+    StridedCopy::shutdownWorkers();
     if (memoryManager) {
         memoryManager->commonCleanup();
         for (const auto &rootDeviceEnvironment : this->rootDeviceEnvironments) {
@@ -166,6 +174,64 @@ void ExecutionEnvironment::initializeUnifiedMemoryReuseCleaner(bool isAnyDirectS
     }
 }
 
+CompletionReactor *ExecutionEnvironment::getCompletionReactor() {
+    std::lock_guard<std::mutex> lock(initializeCompletionReactorMutex);
+    if (!this->completionReactor) {
+        this->completionReactor = std::make_unique<CompletionReactor>();
+    }
+    return this->completionReactor.get();
+}
+
+void ExecutionEnvironment::drainCompletionReactor() {
+    CompletionReactor *reactor = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(initializeCompletionReactorMutex);
+        reactor = this->completionReactor.get();
+    }
+    if (reactor) {
+        reactor->closeThread();
+    }
+}
+
+KernelTimingTrace *ExecutionEnvironment::getKernelTimingTrace() {
+    if (!KernelTimingTrace::isEnabled()) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(initializeKernelTimingTraceMutex);
+    if (!this->kernelTimingTrace) {
+        auto format = static_cast<KernelTimingTrace::Format>(debugManager.flags.KernelTimingTraceFormat.get());
+        auto fileName = debugManager.flags.KernelTimingTraceFile.get();
+        if (fileName == "unk") {
+            fileName = KernelTimingTrace::getDefaultFileName(format);
+        }
+        this->kernelTimingTrace = std::make_unique<KernelTimingTrace>(fileName, format);
+    }
+    return this->kernelTimingTrace.get();
+}
+
+LocalWorkSizeAutotuner *ExecutionEnvironment::getLocalWorkSizeAutotuner() {
+    if (!LocalWorkSizeAutotuner::isEnabled()) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(initializeLocalWorkSizeAutotunerMutex);
+    if (!this->localWorkSizeAutotuner) {
+        auto cacheFile = debugManager.flags.LocalWorkSizeAutotuneCacheFile.get();
+        if (cacheFile == "unk") {
+            cacheFile = LocalWorkSizeAutotuner::getDefaultCacheFilePath();
+        }
+        uint32_t samplesPerCandidate = LocalWorkSizeAutotuner::defaultSamplesPerCandidate;
+        if (debugManager.flags.LocalWorkSizeAutotuneSamples.get() > 0) {
+            samplesPerCandidate = static_cast<uint32_t>(debugManager.flags.LocalWorkSizeAutotuneSamples.get());
+        }
+        uint32_t maxCandidates = LocalWorkSizeAutotuner::defaultMaxCandidates;
+        if (debugManager.flags.LocalWorkSizeAutotuneMaxCandidates.get() > 0) {
+            maxCandidates = static_cast<uint32_t>(debugManager.flags.LocalWorkSizeAutotuneMaxCandidates.get());
+        }
+        this->localWorkSizeAutotuner = std::make_unique<LocalWorkSizeAutotuner>(cacheFile, samplesPerCandidate, maxCandidates);
+    }
+    return this->localWorkSizeAutotuner.get();
+}
+
 void ExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices) {
     if (rootDeviceEnvironments.size() < numRootDevices) {
         rootDeviceEnvironments.resize(numRootDevices);
@@ -178,6 +244,12 @@ void ExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices
 }
 
 void ExecutionEnvironment::prepareForCleanup() const {
+    if (completionReactor) {
+        completionReactor->closeThread();
+    }
+    if (kernelTimingTrace) {
+        kernelTimingTrace->flush();
+    }
     for (auto &rootDeviceEnvironment : rootDeviceEnvironments) {
         if (rootDeviceEnvironment) {
             rootDeviceEnvironment->prepareForCleanup();
@@ -18,7 +18,10 @@
 #include <vector>
 
 namespace NEO {
+class CompletionReactor;
 class DirectSubmissionController;
+class KernelTimingTrace;
+class LocalWorkSizeAutotuner;
 class UnifiedMemoryReuseCleaner;
 class GfxCoreHelper;
 class MemoryManager;
@@ -67,10 +70,17 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
 
     DirectSubmissionController *initializeDirectSubmissionController();
     void initializeUnifiedMemoryReuseCleaner(bool isAnyDirectSubmissionLightEnabled);
+    CompletionReactor *getCompletionReactor();
+    void drainCompletionReactor();
+    KernelTimingTrace *getKernelTimingTrace();
+    LocalWorkSizeAutotuner *getLocalWorkSizeAutotuner();
 
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<UnifiedMemoryReuseCleaner> unifiedMemoryReuseCleaner;
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
+    std::unique_ptr<CompletionReactor> completionReactor;
+    std::unique_ptr<KernelTimingTrace> kernelTimingTrace;
+    std::unique_ptr<LocalWorkSizeAutotuner> localWorkSizeAutotuner;
     std::unique_ptr<OsEnvironment> osEnvironment;
     std::vector<std::unique_ptr<RootDeviceEnvironment>> rootDeviceEnvironments;
     void releaseRootDeviceEnvironmentResources(RootDeviceEnvironment *rootDeviceEnvironment);
@@ -95,6 +105,9 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     std::unordered_map<uint32_t, uint32_t> rootDeviceNumCcsMap;
     std::mutex initializeDirectSubmissionControllerMutex;
     std::mutex initializeUnifiedMemoryReuseCleanerMutex;
+    std::mutex initializeCompletionReactorMutex;
+    std::mutex initializeKernelTimingTraceMutex;
+    std::mutex initializeLocalWorkSizeAutotunerMutex;
     std::vector<std::tuple<std::string, uint32_t>> deviceCcsModeVec;
 };
 } // namespace NEO
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/strided_copy.h"
+
+#include <cstring>
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace NEO {
+
+namespace {
+#if defined(__ARM_NEON)
+// STNP hints that the written lines are not reused, there is no intrinsic for it so it is emitted directly
+inline void storePairNonTemporal(uint8_t *dst, uint8x16_t v0, uint8x16_t v1) {
+#if defined(__GNUC__)
+    __asm__ volatile("stnp %q[v0], %q[v1], [%[dst]]"
+                     :
+                     : [v0] "w"(v0), [v1] "w"(v1), [dst] "r"(dst)
+                     : "memory");
+#else
+    vst1q_u8(dst, v0);
+    vst1q_u8(dst + sizeof(uint8x16_t), v1);
+#endif
+}
+#endif
+} // namespace
+
+void copyRowNonTemporalSimd(void *dst, const void *src, size_t size) {
+#if defined(__ARM_NEON)
+    constexpr size_t vectorSize = sizeof(uint8x16_t);
+    constexpr size_t unrollCount = 4;
+
+    auto dstBytes = static_cast<uint8_t *>(dst);
+    auto srcBytes = static_cast<const uint8_t *>(src);
+    for (; size >= unrollCount * vectorSize; size -= unrollCount * vectorSize) {
+        auto v0 = vld1q_u8(srcBytes);
+        auto v1 = vld1q_u8(srcBytes + vectorSize);
+        auto v2 = vld1q_u8(srcBytes + 2 * vectorSize);
+        auto v3 = vld1q_u8(srcBytes + 3 * vectorSize);
+        storePairNonTemporal(dstBytes, v0, v1);
+        storePairNonTemporal(dstBytes + 2 * vectorSize, v2, v3);
+        srcBytes += unrollCount * vectorSize;
+        dstBytes += unrollCount * vectorSize;
+    }
+    memcpy(dstBytes, srcBytes, size);
+#if defined(__GNUC__)
+    // non-temporal stores are not ordered with later stores, make them visible before the copy is reported done
+    __asm__ volatile("dmb ishst" ::: "memory");
+#endif
+#else
+    memcpy(dst, src, size);
+#endif
+}
+
+} // namespace NEO
@@ -18,8 +18,28 @@ namespace NEO {
 
 namespace BlitHelperFunctions {
 BlitMemoryToAllocationFunc blitMemoryToAllocation = BlitHelper::blitMemoryToAllocation;
+BlitMemoryToAllocationsFunc blitMemoryToAllocations = BlitHelper::blitMemoryToAllocations;
 } // namespace BlitHelperFunctions
 
+namespace {
+EngineControl *getBcsEngineForMemoryBank(const Device &device, uint32_t tileId, Device *&pDeviceForBlit) {
+    auto pRootDevice = device.getRootDevice();
+    UNRECOVERABLE_IF(!pRootDevice->getDeviceBitfield().test(tileId));
+    pDeviceForBlit = pRootDevice->getNearestGenericSubDevice(tileId);
+    auto &selectorCopyEngine = pDeviceForBlit->getSelectorCopyEngine();
+    auto deviceBitfield = pDeviceForBlit->getDeviceBitfield();
+    auto internalUsage = true;
+    auto bcsEngineType = EngineHelpers::getBcsEngineType(pDeviceForBlit->getRootDeviceEnvironment(), deviceBitfield, selectorCopyEngine, internalUsage);
+    auto bcsEngineUsage = device.getGfxCoreHelper().preferInternalBcsEngine() ? EngineUsage::internal : EngineUsage::regular;
+    auto bcsEngine = pDeviceForBlit->tryGetEngine(bcsEngineType, bcsEngineUsage);
+    if (bcsEngine) {
+        bcsEngine->commandStreamReceiver->initializeResources(false, device.getPreemptionMode());
+        bcsEngine->commandStreamReceiver->initDirectSubmission();
+    }
+    return bcsEngine;
+}
+} // namespace
+
 BlitOperationResult BlitHelper::blitMemoryToAllocation(const Device &device, GraphicsAllocation *memory, size_t offset, const void *hostPtr,
                                                        const Vec3<size_t> &size) {
     auto memoryBanks = memory->storageInfo.getMemoryBanks();
@@ -32,31 +52,19 @@ BlitOperationResult BlitHelper::blitMemoryToAllocationBanks(const Device &device
     if (!hwInfo.capabilityTable.blitterOperationsSupported) {
         return BlitOperationResult::unsupported;
     }
-    auto &gfxCoreHelper = device.getGfxCoreHelper();
-
     UNRECOVERABLE_IF(memoryBanks.none());
 
-    auto pRootDevice = device.getRootDevice();
-
     for (uint8_t tileId = 0u; tileId < 4u; tileId++) {
         if (!memoryBanks.test(tileId)) {
             continue;
         }
 
-        UNRECOVERABLE_IF(!pRootDevice->getDeviceBitfield().test(tileId));
-        auto pDeviceForBlit = pRootDevice->getNearestGenericSubDevice(tileId);
-        auto &selectorCopyEngine = pDeviceForBlit->getSelectorCopyEngine();
-        auto deviceBitfield = pDeviceForBlit->getDeviceBitfield();
-        auto internalUsage = true;
-        auto bcsEngineType = EngineHelpers::getBcsEngineType(pDeviceForBlit->getRootDeviceEnvironment(), deviceBitfield, selectorCopyEngine, internalUsage);
-        auto bcsEngineUsage = gfxCoreHelper.preferInternalBcsEngine() ? EngineUsage::internal : EngineUsage::regular;
-        auto bcsEngine = pDeviceForBlit->tryGetEngine(bcsEngineType, bcsEngineUsage);
+        Device *pDeviceForBlit = nullptr;
+        auto bcsEngine = getBcsEngineForMemoryBank(device, tileId, pDeviceForBlit);
         if (!bcsEngine) {
             return BlitOperationResult::unsupported;
         }
 
-        bcsEngine->commandStreamReceiver->initializeResources(false, device.getPreemptionMode());
-        bcsEngine->commandStreamReceiver->initDirectSubmission();
         BlitPropertiesContainer blitPropertiesContainer;
         blitPropertiesContainer.push_back(
             BlitProperties::constructPropertiesForReadWrite(BlitterConstants::BlitDirection::hostPtrToBuffer,
@@ -74,4 +82,50 @@ BlitOperationResult BlitHelper::blitMemoryToAllocationBanks(const Device &device
     return BlitOperationResult::success;
 }
 
+BlitOperationResult BlitHelper::blitMemoryToAllocations(const Device &device, const BlitMemoryToAllocationTransfers &transfers) {
+    const auto &hwInfo = device.getHardwareInfo();
+    if (!hwInfo.capabilityTable.blitterOperationsSupported) {
+        return BlitOperationResult::unsupported;
+    }
+
+    DeviceBitfield memoryBanks;
+    for (const auto &transfer : transfers) {
+        DeviceBitfield transferMemoryBanks{transfer.memory->storageInfo.getMemoryBanks()};
+        UNRECOVERABLE_IF(transferMemoryBanks.none());
+        memoryBanks |= transferMemoryBanks;
+    }
+
+    for (uint8_t tileId = 0u; tileId < 4u; tileId++) {
+        if (!memoryBanks.test(tileId)) {
+            continue;
+        }
+
+        Device *pDeviceForBlit = nullptr;
+        auto bcsEngine = getBcsEngineForMemoryBank(device, tileId, pDeviceForBlit);
+        if (!bcsEngine) {
+            return BlitOperationResult::unsupported;
+        }
+
+        BlitPropertiesContainer blitPropertiesContainer;
+        for (const auto &transfer : transfers) {
+            if (!DeviceBitfield{transfer.memory->storageInfo.getMemoryBanks()}.test(tileId)) {
+                continue;
+            }
+            blitPropertiesContainer.push_back(
+                BlitProperties::constructPropertiesForReadWrite(BlitterConstants::BlitDirection::hostPtrToBuffer,
+                                                                *bcsEngine->commandStreamReceiver, transfer.memory, nullptr,
+                                                                transfer.hostPtr,
+                                                                (transfer.memory->getGpuAddress() + transfer.offset),
+                                                                0, 0, 0, transfer.size, 0, 0, 0, 0));
+        }
+
+        const auto newTaskCount = bcsEngine->commandStreamReceiver->flushBcsTask(blitPropertiesContainer, true, *pDeviceForBlit);
+        if (newTaskCount == CompletionStamp::gpuHang) {
+            return BlitOperationResult::gpuHang;
+        }
+    }
+
+    return BlitOperationResult::success;
+}
+
 } // namespace NEO
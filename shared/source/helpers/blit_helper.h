@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2023 Intel Corporation
+ * Copyright (C) 2023-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,7 @@
 #pragma once
 #include "shared/source/helpers/device_bitfield.h"
 #include "shared/source/helpers/vec.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include <functional>
 
@@ -23,6 +24,14 @@ enum class BlitOperationResult {
     gpuHang
 };
 
+struct BlitMemoryToAllocationTransfer {
+    GraphicsAllocation *memory = nullptr;
+    size_t offset = 0;
+    const void *hostPtr = nullptr;
+    Vec3<size_t> size = {0, 0, 0};
+};
+using BlitMemoryToAllocationTransfers = StackVec<BlitMemoryToAllocationTransfer, 8>;
+
 namespace BlitHelperFunctions {
 using BlitMemoryToAllocationFunc = std::function<BlitOperationResult(const Device &device,
                                                                      GraphicsAllocation *memory,
@@ -30,6 +39,9 @@ using BlitMemoryToAllocationFunc = std::function<BlitOperationResult(const Devic
                                                                      const void *hostPtr,
                                                                      const Vec3<size_t> &size)>;
 extern BlitMemoryToAllocationFunc blitMemoryToAllocation;
+using BlitMemoryToAllocationsFunc = std::function<BlitOperationResult(const Device &device,
+                                                                      const BlitMemoryToAllocationTransfers &transfers)>;
+extern BlitMemoryToAllocationsFunc blitMemoryToAllocations;
 } // namespace BlitHelperFunctions
 
 struct BlitHelper {
@@ -37,6 +49,7 @@ struct BlitHelper {
                                                       const Vec3<size_t> &size);
     static BlitOperationResult blitMemoryToAllocationBanks(const Device &device, GraphicsAllocation *memory, size_t offset, const void *hostPtr,
                                                            const Vec3<size_t> &size, DeviceBitfield memoryBanks);
+    static BlitOperationResult blitMemoryToAllocations(const Device &device, const BlitMemoryToAllocationTransfers &transfers);
 };
 
 } // namespace NEO
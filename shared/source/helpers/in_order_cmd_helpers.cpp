@@ -13,12 +13,17 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/utilities/tag_allocator.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <string.h>
 #include <vector>
 
 namespace NEO {
 
+namespace {
+std::atomic<uint64_t> timelineIdCounter{1};
+} // namespace
+
 std::shared_ptr<InOrderExecInfo> InOrderExecInfo::create(TagNodeBase *deviceCounterNode, TagNodeBase *hostCounterNode, NEO::Device &device, uint32_t partitionCount, bool regularCmdList) {
     bool atomicDeviceSignalling = device.getGfxCoreHelper().inOrderAtomicSignallingEnabled(device.getRootDeviceEnvironment());
 
@@ -98,6 +103,9 @@ void InOrderExecInfo::uploadToTbx(TagNodeBase &node, size_t size) {
 }
 
 void InOrderExecInfo::initializeAllocationsFromHost() {
+    // counter is restarted, values already waited on the previous timeline are meaningless
+    timelineId = timelineIdCounter.fetch_add(1);
+
     if (deviceCounterNode) {
         const size_t deviceAllocationWriteSize = sizeof(uint64_t) * numDevicePartitionsToWait;
         memset(ptrOffset(deviceCounterNode->getCpuBase(), allocationOffset), 0, deviceAllocationWriteSize);
@@ -165,4 +173,35 @@ void InOrderExecInfo::releaseNotUsedTempTimestampNodes(bool forceReturn) {
     tempTimestampNodes.swap(tempVector);
 }
 
+bool InOrderSatisfiedCounters::isSatisfied(uint64_t timelineId, uint32_t offset, uint64_t waitValue) {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    for (auto &entry : entries) {
+        if (entry.timelineId == timelineId && entry.offset == offset) {
+            if (entry.waitValue >= waitValue) {
+                elidedWaits++;
+                return true;
+            }
+            return false;
+        }
+    }
+    return false;
+}
+
+void InOrderSatisfiedCounters::markSatisfied(uint64_t timelineId, uint32_t offset, uint64_t waitValue) {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    for (auto &entry : entries) {
+        if (entry.timelineId == timelineId && entry.offset == offset) {
+            entry.waitValue = std::max(entry.waitValue, waitValue);
+            return;
+        }
+    }
+
+    if (entries.size() == maxEntries) {
+        entries.erase(entries.begin());
+    }
+    entries.push_back({timelineId, waitValue, offset});
+}
+
 } // namespace NEO
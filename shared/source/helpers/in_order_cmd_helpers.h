@@ -12,6 +12,7 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/allocation_type.h"
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -80,6 +81,7 @@ class InOrderExecInfo : public NEO::NonCopyableClass {
     void setAllocationOffset(uint32_t newOffset) { allocationOffset = newOffset; }
     void initializeAllocationsFromHost();
     uint32_t getAllocationOffset() const { return allocationOffset; }
+    uint64_t getTimelineId() const { return timelineId; }
 
     void reset();
     bool isExternalMemoryExecInfo() const { return deviceCounterNode == nullptr; }
@@ -114,6 +116,7 @@ class InOrderExecInfo : public NEO::NonCopyableClass {
     uint64_t counterValue = 0;
     uint64_t lastWaitedCounterValue = 0;
     uint64_t regularCmdListSubmissionCounter = 0;
+    uint64_t timelineId = 0;
     uint64_t deviceAddress = 0;
     uint64_t *hostAddress = nullptr;
     uint32_t numDevicePartitionsToWait = 0;
@@ -126,6 +129,28 @@ class InOrderExecInfo : public NEO::NonCopyableClass {
     bool isTbx = false;
 };
 
+// Counter values that semaphores already submitted to a given engine have waited for.
+// Work submitted later to the same engine is ordered after these semaphores, so it doesn't need to wait again.
+class InOrderSatisfiedCounters : public NEO::NonCopyableAndNonMovableClass {
+  public:
+    static constexpr size_t maxEntries = 64;
+
+    bool isSatisfied(uint64_t timelineId, uint32_t offset, uint64_t waitValue);
+    void markSatisfied(uint64_t timelineId, uint32_t offset, uint64_t waitValue);
+    uint64_t getElidedWaitsCount() const { return elidedWaits.load(); }
+
+  protected:
+    struct Entry {
+        uint64_t timelineId;
+        uint64_t waitValue;
+        uint32_t offset;
+    };
+
+    std::mutex mutex;
+    std::vector<Entry> entries;
+    std::atomic<uint64_t> elidedWaits{0};
+};
+
 namespace InOrderPatchCommandHelpers {
 inline uint64_t getAppendCounterValue(const InOrderExecInfo &inOrderExecInfo) {
     if (inOrderExecInfo.isRegularCmdList() && inOrderExecInfo.getRegularCmdListSubmissionCounter() > 1) {
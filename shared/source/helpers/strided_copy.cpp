@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/strided_copy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+
+namespace {
+void copyRowCached(void *dst, const void *src, size_t size) {
+    memcpy(dst, src, size);
+}
+
+// Worker threads are kept between copies, creating them for every transfer would cost as much as copies close to the split size
+class StridedCopyWorkerPool : NEO::NonCopyableAndNonMovableClass {
+  public:
+    ~StridedCopyWorkerPool() {
+        shutdown();
+    }
+
+    // Joins idle workers, waits for a copy in progress first. Next copy creates workers again.
+    void shutdown() {
+        std::lock_guard<std::mutex> runLock(runMtx);
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopped = true;
+        }
+        workAvailable.notify_all();
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        std::lock_guard<std::mutex> lock(mtx);
+        workers.clear();
+        stopped = false;
+    }
+
+    // Calls work for every worker id, work of worker 0 is done on calling thread
+    void run(uint32_t workersCount, const std::function<void(uint32_t)> &work) {
+        std::unique_lock<std::mutex> runLock(runMtx, std::defer_lock);
+        if (workersCount == 1 || !runLock.try_lock()) {
+            // pool is busy with copy from other thread, its parts are copied one by one
+            for (uint32_t workerId = 0; workerId < workersCount; workerId++) {
+                work(workerId);
+            }
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            while (workers.size() < workersCount - 1) {
+                workers.emplace_back(&StridedCopyWorkerPool::workerProcess, this, static_cast<uint32_t>(workers.size() + 1), generation);
+            }
+            currentWork = &work;
+            activeWorkersCount = workersCount;
+            pendingWorkersCount = workersCount - 1;
+            generation++;
+        }
+        workAvailable.notify_all();
+
+        work(0u);
+
+        std::unique_lock<std::mutex> lock(mtx);
+        workDone.wait(lock, [this] { return pendingWorkersCount == 0; });
+        currentWork = nullptr;
+    }
+
+  protected:
+    void workerProcess(uint32_t workerId, uint64_t seenGeneration) {
+        std::unique_lock<std::mutex> lock(mtx);
+        while (true) {
+            workAvailable.wait(lock, [&] { return stopped || generation != seenGeneration; });
+            if (stopped) {
+                return;
+            }
+            seenGeneration = generation;
+            if (workerId >= activeWorkersCount) {
+                continue;
+            }
+
+            auto work = currentWork;
+            lock.unlock();
+            (*work)(workerId);
+            lock.lock();
+
+            if (--pendingWorkersCount == 0) {
+                workDone.notify_one();
+            }
+        }
+    }
+
+    std::vector<std::thread> workers;
+    std::mutex runMtx;
+    std::mutex mtx;
+    std::condition_variable workAvailable;
+    std::condition_variable workDone;
+    const std::function<void(uint32_t)> *currentWork = nullptr;
+    uint32_t activeWorkersCount = 0;
+    uint32_t pendingWorkersCount = 0;
+    uint64_t generation = 0;
+    bool stopped = false;
+};
+
+StridedCopyWorkerPool &getWorkerPool() {
+    static StridedCopyWorkerPool workerPool;
+    return workerPool;
+}
+
+void runWorkers(uint32_t workersCount, const std::function<void(uint32_t)> &work) {
+    getWorkerPool().run(workersCount, work);
+}
+} // namespace
+
+void (*StridedCopy::copyRowNonTemporal)(void *dst, const void *src, size_t size) = copyRowCached;
+
+// Initialize non-temporal row copy based on CPU capabilities
+StridedCopy::StridedCopy() {
+    auto &cpuInfo = CpuInfo::getInstance();
+    if (cpuInfo.isFeatureSupported(CpuInfo::featureAvX2) || cpuInfo.isFeatureSupported(CpuInfo::featureNeon)) {
+        StridedCopy::copyRowNonTemporal = copyRowNonTemporalSimd;
+    }
+}
+
+StridedCopy StridedCopy::initializer;
+
+void StridedCopy::copy(void *dst, const void *src, size_t size) {
+    StridedCopyRegion region{};
+    region.dst = dst;
+    region.dstRowPitch = size;
+    region.src = src;
+    region.srcRowPitch = size;
+    region.rowSize = size;
+    copyRegion(region);
+}
+
+void StridedCopy::copyRegion(const StridedCopyRegion &region) {
+    const auto rowsCount = region.rowCount * region.sliceCount;
+    const auto totalSize = region.rowSize * rowsCount;
+    if (totalSize == 0) {
+        return;
+    }
+
+    const auto nonTemporalThreshold = getNonTemporalThreshold();
+    const bool nonTemporal = nonTemporalThreshold != 0 && totalSize >= nonTemporalThreshold;
+    const auto workersCount = getWorkersCount(totalSize);
+
+    if (isContiguous(region)) {
+        const auto chunkSize = alignUp((totalSize + workersCount - 1) / workersCount, MemoryConstants::cacheLineSize);
+        runWorkers(workersCount, [&](uint32_t workerId) {
+            const auto offset = std::min(totalSize, chunkSize * workerId);
+            const auto size = std::min(chunkSize, totalSize - offset);
+            auto rowCopy = nonTemporal ? StridedCopy::copyRowNonTemporal : copyRowCached;
+            rowCopy(ptrOffset(region.dst, offset), ptrOffset(region.src, offset), size);
+        });
+        return;
+    }
+
+    const auto rowWorkersCount = static_cast<uint32_t>(std::min(static_cast<size_t>(workersCount), rowsCount));
+    const auto rowsPerWorker = (rowsCount + rowWorkersCount - 1) / rowWorkersCount;
+    runWorkers(rowWorkersCount, [&](uint32_t workerId) {
+        const auto firstRow = std::min(rowsCount, rowsPerWorker * workerId);
+        const auto lastRow = std::min(rowsCount, firstRow + rowsPerWorker);
+        copyRows(region, firstRow, lastRow, nonTemporal);
+    });
+}
+
+void StridedCopy::copyRows(const StridedCopyRegion &region, size_t firstRow, size_t lastRow, bool nonTemporal) {
+    auto rowCopy = nonTemporal ? StridedCopy::copyRowNonTemporal : copyRowCached;
+    for (auto row = firstRow; row < lastRow; row++) {
+        const auto slice = row / region.rowCount;
+        const auto rowInSlice = row % region.rowCount;
+        rowCopy(ptrOffset(region.dst, slice * region.dstSlicePitch + rowInSlice * region.dstRowPitch),
+                ptrOffset(region.src, slice * region.srcSlicePitch + rowInSlice * region.srcRowPitch),
+                region.rowSize);
+    }
+}
+
+void StridedCopy::shutdownWorkers() {
+    getWorkerPool().shutdown();
+}
+
+bool StridedCopy::isContiguous(const StridedCopyRegion &region) {
+    if (region.rowCount * region.sliceCount == 1) {
+        return true;
+    }
+    if (region.rowSize != region.dstRowPitch || region.rowSize != region.srcRowPitch) {
+        return false;
+    }
+    const auto sliceSize = region.rowSize * region.rowCount;
+    return region.sliceCount == 1 || (sliceSize == region.dstSlicePitch && sliceSize == region.srcSlicePitch);
+}
+
+size_t StridedCopy::getNonTemporalThreshold() {
+    if (debugManager.flags.CpuCopyNonTemporalThreshold.get() != -1) {
+        return static_cast<size_t>(debugManager.flags.CpuCopyNonTemporalThreshold.get());
+    }
+    return defaultNonTemporalThreshold;
+}
+
+uint32_t StridedCopy::getWorkersCount(size_t size) {
+    uint32_t maxWorkersCount = defaultMaxWorkersCount;
+    if (debugManager.flags.CpuCopyMaxWorkersCount.get() != -1) {
+        maxWorkersCount = static_cast<uint32_t>(std::max(1, debugManager.flags.CpuCopyMaxWorkersCount.get()));
+    }
+    maxWorkersCount = std::min(maxWorkersCount, std::max(1u, std::thread::hardware_concurrency()));
+
+    const auto workersCount = static_cast<uint32_t>(std::min(static_cast<size_t>(maxWorkersCount), size / minSizePerWorker));
+    return std::max(1u, workersCount);
+}
+
+} // namespace NEO
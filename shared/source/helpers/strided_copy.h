@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/constants.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+
+struct StridedCopyRegion {
+    void *dst = nullptr;
+    size_t dstRowPitch = 0;
+    size_t dstSlicePitch = 0;
+    const void *src = nullptr;
+    size_t srcRowPitch = 0;
+    size_t srcSlicePitch = 0;
+    size_t rowSize = 0;
+    size_t rowCount = 1;
+    size_t sliceCount = 1;
+};
+
+// CPU copy engine for host side transfers of buffers and images.
+// Destinations above the non-temporal threshold are written with streaming stores to avoid polluting the cache,
+// large regions can be split between worker threads, splitting is opt-in through CpuCopyMaxWorkersCount.
+class StridedCopy {
+  public:
+    static constexpr size_t defaultNonTemporalThreshold = 4 * MemoryConstants::megaByte;
+    static constexpr size_t minSizePerWorker = 2 * MemoryConstants::megaByte;
+    static constexpr uint32_t defaultMaxWorkersCount = 1u;
+
+    static void copy(void *dst, const void *src, size_t size);
+    static void copyRegion(const StridedCopyRegion &region);
+    // Joins worker threads, called by execution environment so none of them is left for static destruction
+    static void shutdownWorkers();
+
+    static bool isContiguous(const StridedCopyRegion &region);
+    static size_t getNonTemporalThreshold();
+    static uint32_t getWorkersCount(size_t size);
+
+    static void (*copyRowNonTemporal)(void *dst, const void *src, size_t size);
+
+  protected:
+    static void copyRows(const StridedCopyRegion &region, size_t firstRow, size_t lastRow, bool nonTemporal);
+
+    StridedCopy();
+    static StridedCopy initializer;
+};
+
+void copyRowNonTemporalSimd(void *dst, const void *src, size_t size);
+
+} // namespace NEO
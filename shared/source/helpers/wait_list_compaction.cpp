@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/wait_list_compaction.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+WaitListCompactor::WaitListCompactor(size_t waitListSize) {
+    required.resize(waitListSize, 1u);
+    stats.waits = static_cast<uint32_t>(waitListSize);
+}
+
+bool WaitListCompactor::isEnabled() {
+    return debugManager.flags.EnableWaitListCompaction.get() == 1;
+}
+
+void WaitListCompactor::addCompletedWait(size_t index) {
+    required[index] = 0u;
+    stats.elidedCompleted++;
+}
+
+void WaitListCompactor::addTimelineWait(size_t index, const WaitListTimeline &timeline, uint64_t waitValue) {
+    timelineWaits.push_back({timeline, waitValue, index});
+}
+
+void WaitListCompactor::compact() {
+    StackVec<TimelineWait, 16> latestWaits;
+    for (auto &timelineWait : timelineWaits) {
+        auto latestWait = std::find_if(latestWaits.begin(), latestWaits.end(), [&timelineWait](const TimelineWait &wait) { return wait.timeline == timelineWait.timeline; });
+        if (latestWait == latestWaits.end()) {
+            latestWaits.push_back(timelineWait);
+        } else {
+            latestWait->waitValue = std::max(latestWait->waitValue, timelineWait.waitValue);
+        }
+    }
+
+    // waits with value equal to the latest one are kept, value alone doesn't identify a single submission
+    for (auto &timelineWait : timelineWaits) {
+        auto latestWait = std::find_if(latestWaits.begin(), latestWaits.end(), [&timelineWait](const TimelineWait &wait) { return wait.timeline == timelineWait.timeline; });
+        if (timelineWait.waitValue < latestWait->waitValue) {
+            required[timelineWait.index] = 0u;
+            stats.elidedSuperseded++;
+        }
+    }
+    timelineWaits.clear();
+}
+
+void WaitListCompactor::printStats(const char *source) const {
+    if (stats.getElided() == 0) {
+        return;
+    }
+    PRINT_DEBUG_STRING(debugManager.flags.PrintWaitListCompaction.get(), stdout,
+                       "%s: wait list %u, elided %u (completed %u, superseded %u)\n",
+                       source, stats.waits, stats.getElided(), stats.elidedCompleted, stats.elidedSuperseded);
+}
+
+} // namespace NEO
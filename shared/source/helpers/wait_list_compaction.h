@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/utilities/stackvec.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+
+// Dependencies on the same timeline are ordered, so waiting for the highest value is sufficient
+struct WaitListTimeline {
+    const void *owner = nullptr;
+    uint64_t subTimeline = 0;
+
+    bool operator==(const WaitListTimeline &other) const {
+        return owner == other.owner && subTimeline == other.subTimeline;
+    }
+};
+
+struct WaitListCompactionStats {
+    uint32_t waits = 0;
+    uint32_t elidedCompleted = 0;
+    uint32_t elidedSuperseded = 0;
+
+    uint32_t getElided() const { return elidedCompleted + elidedSuperseded; }
+};
+
+class WaitListCompactor : NEO::NonCopyableAndNonMovableClass {
+  public:
+    explicit WaitListCompactor(size_t waitListSize);
+
+    static bool isEnabled();
+
+    void addCompletedWait(size_t index);
+    void addTimelineWait(size_t index, const WaitListTimeline &timeline, uint64_t waitValue);
+    void compact();
+
+    bool isRequired(size_t index) const { return required[index] != 0; }
+    const WaitListCompactionStats &getStats() const { return stats; }
+    void printStats(const char *source) const;
+
+  protected:
+    struct TimelineWait {
+        WaitListTimeline timeline;
+        uint64_t waitValue;
+        size_t index;
+    };
+
+    StackVec<TimelineWait, 32> timelineWaits;
+    StackVec<uint8_t, 64> required;
+    WaitListCompactionStats stats;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<WaitListCompactor>);
+
+} // namespace NEO
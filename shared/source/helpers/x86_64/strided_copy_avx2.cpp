@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/strided_copy.h"
+
+#include <algorithm>
+#include <cstring>
+
+#if __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace NEO {
+
+void copyRowNonTemporalSimd(void *dst, const void *src, size_t size) {
+#if __AVX2__
+    constexpr size_t vectorSize = sizeof(__m256i);
+    constexpr size_t unrollCount = 4;
+
+    // streaming stores require aligned destination
+    auto head = std::min(size, ptrDiff(alignUp(dst, vectorSize), dst));
+    memcpy(dst, src, head);
+    auto dstVector = reinterpret_cast<__m256i *>(ptrOffset(dst, head));
+    auto srcVector = reinterpret_cast<const __m256i *>(ptrOffset(src, head));
+    size -= head;
+
+    for (; size >= unrollCount * vectorSize; size -= unrollCount * vectorSize) {
+        auto v0 = _mm256_loadu_si256(srcVector);
+        auto v1 = _mm256_loadu_si256(srcVector + 1);
+        auto v2 = _mm256_loadu_si256(srcVector + 2);
+        auto v3 = _mm256_loadu_si256(srcVector + 3);
+        _mm256_stream_si256(dstVector, v0);
+        _mm256_stream_si256(dstVector + 1, v1);
+        _mm256_stream_si256(dstVector + 2, v2);
+        _mm256_stream_si256(dstVector + 3, v3);
+        srcVector += unrollCount;
+        dstVector += unrollCount;
+    }
+    for (; size >= vectorSize; size -= vectorSize) {
+        _mm256_stream_si256(dstVector++, _mm256_loadu_si256(srcVector++));
+    }
+    memcpy(dstVector, srcVector, size);
+    _mm_sfence();
+#else
+    memcpy(dst, src, size);
+#endif
+}
+
+} // namespace NEO
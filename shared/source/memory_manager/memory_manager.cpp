@@ -1211,6 +1211,31 @@ bool MemoryTransferHelper::transferMemoryToAllocationBanks(const Device &device,
     }
     return true;
 }
+bool MemoryTransferHelper::transferMemoryToAllocations(const Device &device, const MemoryTransfers &transfers) {
+    BlitMemoryToAllocationTransfers blitTransfers;
+    for (const auto &transfer : transfers) {
+        if (transfer.useBlitter) {
+            blitTransfers.push_back({transfer.dstAllocation, transfer.dstOffset, transfer.srcMemory, {transfer.srcSize, 1, 1}});
+        }
+    }
+
+    bool blitSuccess = false;
+    if (blitTransfers.size() == 1u) {
+        const auto &blitTransfer = blitTransfers[0];
+        blitSuccess = BlitHelperFunctions::blitMemoryToAllocation(device, blitTransfer.memory, blitTransfer.offset, blitTransfer.hostPtr, blitTransfer.size) == BlitOperationResult::success;
+    } else if (blitTransfers.size() > 1u) {
+        blitSuccess = BlitHelperFunctions::blitMemoryToAllocations(device, blitTransfers) == BlitOperationResult::success;
+    }
+
+    bool success = true;
+    for (const auto &transfer : transfers) {
+        if (transfer.useBlitter && blitSuccess) {
+            continue;
+        }
+        success &= device.getMemoryManager()->copyMemoryToAllocation(transfer.dstAllocation, transfer.dstOffset, transfer.srcMemory, transfer.srcSize);
+    }
+    return success;
+}
 
 uint64_t MemoryManager::adjustToggleBitFlagForGpuVa(AllocationType inputAllocationType, uint64_t gpuAddress) {
     if (debugManager.flags.ToggleBitIn57GpuVa.get() != "unk") {
@@ -93,10 +93,20 @@ struct CustomHeapAllocatorConfig {
 
 constexpr size_t paddingBufferSize = 2 * MemoryConstants::megaByte;
 
+struct MemoryTransfer {
+    GraphicsAllocation *dstAllocation = nullptr;
+    size_t dstOffset = 0;
+    const void *srcMemory = nullptr;
+    size_t srcSize = 0;
+    bool useBlitter = false;
+};
+using MemoryTransfers = StackVec<MemoryTransfer, 8>;
+
 namespace MemoryTransferHelper {
 bool transferMemoryToAllocation(bool useBlitter, const Device &device, GraphicsAllocation *dstAllocation, size_t dstOffset, const void *srcMemory, size_t srcSize);
 bool transferMemoryToAllocationBanks(const Device &device, GraphicsAllocation *dstAllocation, size_t dstOffset, const void *srcMemory,
                                      size_t srcSize, DeviceBitfield dstMemoryBanks);
+bool transferMemoryToAllocations(const Device &device, const MemoryTransfers &transfers);
 } // namespace MemoryTransferHelper
 
 class MemoryManager {
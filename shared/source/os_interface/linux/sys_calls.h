@@ -59,5 +59,7 @@ long sysconf(int name);
 int mkfifo(const char *pathname, mode_t mode);
 int pidfdopen(pid_t pid, unsigned int flags);
 int pidfdgetfd(int pidfd, int targetfd, unsigned int flags);
+int eventfd(unsigned int initval, int flags);
+int dup(int oldfd);
 } // namespace SysCalls
 } // namespace NEO
@@ -15,6 +15,7 @@
 #include <poll.h>
 #include <stdio.h>
 #include <string>
+#include <sys/eventfd.h>
 #include <sys/file.h>
 #include <sys/ioctl.h>
 #include <sys/stat.h>
@@ -212,5 +213,12 @@ long sysconf(int name) {
 int mkfifo(const char *pathname, mode_t mode) {
     return ::mkfifo(pathname, mode);
 }
+int eventfd(unsigned int initval, int flags) {
+    return ::eventfd(initval, flags);
+}
+
+int dup(int oldfd) {
+    return ::dup(oldfd);
+}
 } // namespace SysCalls
 } // namespace NEO
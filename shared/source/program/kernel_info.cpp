@@ -10,6 +10,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/kernel_helpers.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/memory_manager/allocation_properties.h"
@@ -55,7 +56,7 @@ int32_t KernelInfo::getArgNumByName(const char *name) const {
     return -1;
 }
 
-bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa) {
+bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa, MemoryTransfers *pendingTransfers) {
     UNRECOVERABLE_IF(kernelAllocation);
     auto kernelIsaSize = heapInfo.kernelHeapSize;
     const auto allocType = internalIsa ? AllocationType::kernelIsaInternal : AllocationType::kernelIsa;
@@ -66,6 +67,18 @@ bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa)
         properties.alignment = MemoryConstants::pageSize2M;
     }
 
+    auto transferIsa = [&]() {
+        auto &rootDeviceEnvironment = device.getRootDeviceEnvironment();
+        auto &productHelper = device.getProductHelper();
+        auto useBlitter = productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelAllocation);
+        if (pendingTransfers) {
+            pendingTransfers->push_back({kernelAllocation, 0, heapInfo.pKernelHeap, static_cast<size_t>(kernelIsaSize), useBlitter});
+            return true;
+        }
+        return MemoryTransferHelper::transferMemoryToAllocation(useBlitter, device, kernelAllocation, 0, heapInfo.pKernelHeap,
+                                                                static_cast<size_t>(kernelIsaSize));
+    };
+
     if (device.getMemoryManager()->isKernelBinaryReuseEnabled()) {
         auto lock = device.getMemoryManager()->lockKernelAllocationMap();
         auto kernelName = this->kernelDescriptor.kernelMetadata.kernelName;
@@ -74,12 +87,7 @@ bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa)
         if (kernelAllocations != storedAllocations.end()) {
             kernelAllocation = kernelAllocations->second.kernelAllocation;
             kernelAllocations->second.reuseCounter++;
-            auto &rootDeviceEnvironment = device.getRootDeviceEnvironment();
-            auto &productHelper = device.getProductHelper();
-
-            return MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelAllocation),
-                                                                    device, kernelAllocation, 0, heapInfo.pKernelHeap,
-                                                                    static_cast<size_t>(kernelIsaSize));
+            return transferIsa();
         } else {
             kernelAllocation = device.getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
             storedAllocations.insert(std::make_pair(kernelName, MemoryManager::KernelAllocationInfo(kernelAllocation, 1u)));
@@ -92,12 +100,15 @@ bool KernelInfo::createKernelAllocation(const Device &device, bool internalIsa)
         return false;
     }
 
-    auto &rootDeviceEnvironment = device.getRootDeviceEnvironment();
-    auto &productHelper = device.getProductHelper();
+    return transferIsa();
+}
 
-    return MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *kernelAllocation),
-                                                            device, kernelAllocation, 0, heapInfo.pKernelHeap,
-                                                            static_cast<size_t>(kernelIsaSize));
+void KernelInfo::storeUnpatchedIsaHash() {
+    // relocations are applied later on, hash of ISA as decoded from binary is stable across processes
+    if (debugManager.flags.EnableLocalWorkSizeAutotune.get() != 1 || nullptr == heapInfo.pKernelHeap) {
+        return;
+    }
+    unpatchedIsaHash = Hash::hash(static_cast<const char *>(heapInfo.pKernelHeap), heapInfo.kernelHeapSize);
 }
 
 void KernelInfo::apply(const DeviceInfoKernelPayloadConstants &constants) {
@@ -10,6 +10,7 @@
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/program/heap_info.h"
 #include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include <cstdint>
 #include <string>
@@ -30,6 +31,7 @@ class DispatchInfo;
 struct KernelArgumentType;
 class GraphicsAllocation;
 class MemoryManager;
+struct MemoryTransfer;
 
 static const float yTilingRatioValue = 1.3862943611198906188344642429164f;
 
@@ -84,8 +86,9 @@ struct KernelInfo : NEO::NonCopyableAndNonMovableClass {
     uint32_t getConstantBufferSize() const;
     int32_t getArgNumByName(const char *name) const;
 
-    bool createKernelAllocation(const Device &device, bool internalIsa);
+    bool createKernelAllocation(const Device &device, bool internalIsa, StackVec<MemoryTransfer, 8> *pendingTransfers = nullptr);
     void apply(const DeviceInfoKernelPayloadConstants &constants);
+    void storeUnpatchedIsaHash();
 
     HeapInfo heapInfo = {};
     std::vector<std::pair<uint32_t, uint32_t>> childrenKernelsIdOffset;
@@ -93,6 +96,7 @@ struct KernelInfo : NEO::NonCopyableAndNonMovableClass {
     const BuiltinDispatchInfoBuilder *builtinDispatchBuilder = nullptr;
     uint32_t systemKernelOffset = 0;
     uint64_t kernelId = 0;
+    uint64_t unpatchedIsaHash = 0;
     bool isKernelHeapSubstituted = false;
     GraphicsAllocation *kernelAllocation = nullptr;
     DebugData debugData;
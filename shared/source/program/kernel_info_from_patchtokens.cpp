@@ -31,6 +31,7 @@ void populateKernelInfo(KernelInfo &dst, const PatchTokenBinary::KernelFromPatch
     dst.heapInfo.pGsh = src.heaps.generalState.begin();
     dst.heapInfo.pDsh = src.heaps.dynamicState.begin();
     dst.heapInfo.pSsh = src.heaps.surfaceState.begin();
+    dst.storeUnpatchedIsaHash();
 
     if (src.tokens.executionEnvironment != nullptr) {
         dst.kernelDescriptor.kernelAttributes.hasIndirectStatelessAccess = (src.tokens.executionEnvironment->IndirectStatelessCount > 0);
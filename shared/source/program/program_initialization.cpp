@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2024 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -20,7 +20,8 @@
 namespace NEO {
 
 GraphicsAllocation *allocateGlobalsSurface(NEO::SVMAllocsManager *const svmAllocManager, NEO::Device &device, size_t totalSize, size_t zeroInitSize, bool constant,
-                                           LinkerInput *const linkerInput, const void *initData) {
+                                           LinkerInput *const linkerInput, const void *initData,
+                                           MemoryTransfers *pendingInitTransfers) {
     bool globalsAreExported = false;
     GraphicsAllocation *gpuAllocation = nullptr;
     const auto rootDeviceIndex = device.getRootDeviceIndex();
@@ -65,8 +66,12 @@ GraphicsAllocation *allocateGlobalsSurface(NEO::SVMAllocsManager *const svmAlloc
     bool isOnlyBssData = (totalSize == zeroInitSize);
     if (false == isOnlyBssData) {
         auto initSize = totalSize - zeroInitSize;
-        auto success = MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *gpuAllocation),
-                                                                        device, gpuAllocation, 0, initData, initSize);
+        auto useBlitter = productHelper.isBlitCopyRequiredForLocalMemory(rootDeviceEnvironment, *gpuAllocation);
+        if (pendingInitTransfers) {
+            pendingInitTransfers->push_back({gpuAllocation, 0, initData, initSize, useBlitter});
+            return gpuAllocation;
+        }
+        auto success = MemoryTransferHelper::transferMemoryToAllocation(useBlitter, device, gpuAllocation, 0, initData, initSize);
         UNRECOVERABLE_IF(!success);
     }
     return gpuAllocation;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/stackvec.h"
+
 #include <cstddef>
 
 namespace NEO {
@@ -15,9 +17,11 @@ class Device;
 class GraphicsAllocation;
 class SVMAllocsManager;
 struct LinkerInput;
+struct MemoryTransfer;
 
 GraphicsAllocation *allocateGlobalsSurface(SVMAllocsManager *const svmAllocManager, Device &device,
                                            size_t totalSize, size_t zeroInitSize, bool constant,
-                                           LinkerInput *const linkerInput, const void *initData);
+                                           LinkerInput *const linkerInput, const void *initData,
+                                           StackVec<MemoryTransfer, 8> *pendingInitTransfers = nullptr);
 
 } // namespace NEO
@@ -0,0 +1,284 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/completion_reactor.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/sleep.h"
+#include "shared/source/os_interface/os_thread.h"
+#include "shared/source/utilities/cpuintrinsics.h"
+
+#include <algorithm>
+#include <iterator>
+
+namespace NEO {
+
+CompletionReactor::CompletionReactor() {
+    registerList.reserve(64);
+    watches.reserve(64);
+}
+
+CompletionReactor::~CompletionReactor() {
+    closeThread();
+}
+
+CompletionWatch CompletionReactor::createTaskCountWatch(CommandStreamReceiver &csr, TaskCountType taskCount) {
+    CompletionWatch watch;
+    watch.csr = &csr;
+    watch.pollAddress = csr.getTagAddress();
+    watch.waitValue = taskCount;
+    watch.partitionCount = csr.getActivePartitions();
+    watch.partitionOffset = csr.getImmWritePostSyncWriteOffset();
+    watch.pollAllocation = csr.getTagAllocation();
+    return watch;
+}
+
+void CompletionReactor::registerWatch(CompletionWatch &&watch) {
+    UNRECOVERABLE_IF(!watch.pollAddress && !watch.completionCheck);
+
+    if (watch.notificationFd != CompletionWatch::invalidNotificationFd) {
+        // caller may close its fd at any time, signal own copy of it
+        watch.notificationFd = duplicateNotificationFd(watch.notificationFd);
+    }
+
+    std::unique_lock<std::mutex> lock(reactorMtx);
+    // Create on first use, watches registered while draining are picked up by the draining thread
+    if (!draining) {
+        openThread();
+    }
+
+    registerList.push_back(std::move(watch));
+    reactorCond.notify_one();
+}
+
+void *CompletionReactor::reactorProcess(void *arg) {
+    auto self = reinterpret_cast<CompletionReactor *>(arg);
+    self->reactorThreadId = std::this_thread::get_id();
+    std::unique_lock<std::mutex> lock(self->reactorMtx, std::defer_lock);
+
+    while (true) {
+        lock.lock();
+        self->transferRegisterList();
+        if (!self->allowReactorProcess) {
+            lock.unlock();
+            self->processWatches();
+            break;
+        }
+        if (self->watches.empty()) {
+            self->reactorCond.wait(lock);
+            self->transferRegisterList();
+        }
+        lock.unlock();
+
+        if (self->processWatches()) {
+            self->idleIterations = 0;
+            self->pollingBackoff = std::chrono::microseconds(0);
+        } else if (!self->watches.empty()) {
+            self->waitForProgress();
+        }
+    }
+    return nullptr;
+}
+
+bool CompletionReactor::isWatchCompleted(const CompletionWatch &watch) {
+    if (watch.completionCheck) {
+        return watch.completionCheck();
+    }
+
+    auto pollAddress = watch.pollAddress;
+    for (uint32_t i = 0; i < watch.partitionCount; i++) {
+        if (*pollAddress < watch.waitValue) {
+            return false;
+        }
+        pollAddress = ptrOffset(pollAddress, watch.partitionOffset);
+    }
+    return true;
+}
+
+CompletionReactor::WatchState CompletionReactor::checkWatch(CompletionWatch &watch) {
+    if (!watch.cancellationToken) {
+        return isWatchCompleted(watch) ? WatchState::completed : WatchState::pending;
+    }
+
+    std::lock_guard<std::mutex> lock(watch.cancellationToken->mtx);
+    if (watch.cancellationToken->cancelled) {
+        return WatchState::cancelled;
+    }
+    return isWatchCompleted(watch) ? WatchState::completed : WatchState::pending;
+}
+
+bool CompletionReactor::processWatches() {
+    auto currentTime = std::chrono::high_resolution_clock::now();
+    const bool checkGpuHang = std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastHangCheckTime) >= gpuHangCheckPeriod;
+    if (checkGpuHang) {
+        lastHangCheckTime = currentTime;
+        hungCsrs.clear();
+        for (auto &watch : watches) {
+            if (watch.csr && std::find(hungCsrs.begin(), hungCsrs.end(), watch.csr) == hungCsrs.end() && watch.csr->isGpuHangDetected()) {
+                hungCsrs.push_back(watch.csr);
+            }
+        }
+    }
+
+    bool progress = false;
+    std::vector<CompletionWatch> pendingWatches;
+    pendingWatches.reserve(watches.size());
+
+    for (auto &watch : watches) {
+        auto watchState = checkWatch(watch);
+        if (watchState == WatchState::cancelled) {
+            releaseWatch(watch);
+            progress = true;
+        } else if (watchState == WatchState::completed) {
+            completeWatch(watch, false);
+            progress = true;
+        } else if (checkGpuHang && std::find(hungCsrs.begin(), hungCsrs.end(), watch.csr) != hungCsrs.end()) {
+            completeWatch(watch, true);
+            progress = true;
+        } else {
+            pendingWatches.push_back(std::move(watch));
+        }
+    }
+
+    watches.swap(pendingWatches);
+    return progress;
+}
+
+void CompletionReactor::waitForProgress() {
+    auto commonCsr = watches[0].csr;
+    bool userFenceWait = commonCsr && commonCsr->waitUserFenceSupported();
+    auto earliestWatch = &watches[0];
+    for (auto &watch : watches) {
+        if (watch.csr != commonCsr || !watch.pollAddress || watch.completionCheck) {
+            userFenceWait = false;
+            break;
+        }
+        if (watch.waitValue < earliestWatch->waitValue) {
+            earliestWatch = &watch;
+        }
+    }
+
+    if (userFenceWait) {
+        auto timeout = std::chrono::duration_cast<std::chrono::nanoseconds>(userFenceWaitTimeout).count();
+        commonCsr->waitUserFence(earliestWatch->waitValue, castToUint64(const_cast<TagAddressType *>(earliestWatch->pollAddress)), timeout,
+                                 false, InterruptId::notUsed, earliestWatch->pollAllocation);
+        return;
+    }
+
+    if (idleIterations++ < spinIterationsBeforeBackoff) {
+        CpuIntrinsics::pause();
+        return;
+    }
+
+    pollingBackoff = std::min(std::max(pollingBackoff * 2, std::chrono::microseconds(1)), std::chrono::duration_cast<std::chrono::microseconds>(maxPollingBackoff));
+    NEO::sleep(pollingBackoff);
+}
+
+void CompletionReactor::completeWatch(CompletionWatch &watch, bool gpuHangDetected) {
+    if (watch.callback) {
+        watch.callback(gpuHangDetected);
+    }
+    if (watch.notificationFd != CompletionWatch::invalidNotificationFd) {
+        signalNotificationFd(watch.notificationFd);
+    }
+    releaseWatch(watch);
+}
+
+void CompletionReactor::releaseWatch(CompletionWatch &watch) {
+    if (watch.notificationFd != CompletionWatch::invalidNotificationFd) {
+        closeNotificationFd(watch.notificationFd);
+        watch.notificationFd = CompletionWatch::invalidNotificationFd;
+    }
+    watch.callback = nullptr;
+    watch.completionCheck = nullptr;
+    watch.cancellationToken.reset();
+}
+
+void CompletionReactor::drainWatches() {
+    const auto drainStart = std::chrono::steady_clock::now();
+    while (!watches.empty()) {
+        if (processWatches() || watches.empty()) {
+            continue;
+        }
+        if (std::chrono::steady_clock::now() - drainStart >= drainTimeout) {
+            // results of watches that didn't complete can't be consumed, fail them so that their owners release resources
+            for (auto &watch : watches) {
+                if (checkWatch(watch) == WatchState::cancelled) {
+                    releaseWatch(watch);
+                } else {
+                    completeWatch(watch, true);
+                }
+            }
+            watches.clear();
+            break;
+        }
+        waitForProgress();
+    }
+    idleIterations = 0;
+    pollingBackoff = std::chrono::microseconds(0);
+}
+
+void CompletionReactor::closeThread() {
+    // Callbacks may release last reference to objects that close the reactor, thread can't join itself
+    if (isReactorThread()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> drainLock(drainMtx);
+    std::unique_lock<std::mutex> lock(reactorMtx);
+    if (allowReactorProcess) {
+        allowReactorProcess = false;
+        reactorCond.notify_one();
+        lock.unlock();
+        thread->join();
+        lock.lock();
+        thread.reset(nullptr);
+        reactorThreadId = std::thread::id();
+    }
+
+    // Pending watches are flushed on calling thread, objects they refer to may be destroyed right after
+    draining = true;
+    while (true) {
+        transferRegisterList();
+        if (watches.empty()) {
+            break;
+        }
+        lock.unlock();
+        drainWatches();
+        lock.lock();
+    }
+    draining = false;
+}
+
+bool CompletionReactor::isReactorThread() const {
+    return reactorThreadId.load() == std::this_thread::get_id();
+}
+
+bool CompletionReactor::canCompleteWatchesAsync() {
+    if (isReactorThread()) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(reactorMtx);
+    return !draining;
+}
+
+void CompletionReactor::openThread() {
+    if (!thread.get()) {
+        DEBUG_BREAK_IF(allowReactorProcess);
+        allowReactorProcess = true;
+        thread = Thread::createFunc(reactorProcess, reinterpret_cast<void *>(this));
+    }
+}
+
+void CompletionReactor::transferRegisterList() {
+    std::move(registerList.begin(), registerList.end(), std::back_inserter(watches));
+    registerList.clear();
+}
+
+} // namespace NEO
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/helpers/common_types.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+class GraphicsAllocation;
+class Thread;
+
+// Lets the owner of watched object drop its pending watches before the object goes away.
+// Completion checks run with the mutex held, so no check is in flight once cancel() returns.
+class CompletionWatchToken : NEO::NonCopyableAndNonMovableClass {
+  public:
+    void cancel() {
+        std::lock_guard<std::mutex> lock(mtx);
+        cancelled = true;
+    }
+
+  protected:
+    friend class CompletionReactor;
+
+    std::mutex mtx;
+    bool cancelled = false;
+};
+
+struct CompletionWatch {
+    using Callback = std::function<void(bool gpuHangDetected)>;
+
+    // CSR used for GPU hang detection and KMD user fence waits
+    CommandStreamReceiver *csr = nullptr;
+
+    // Watched memory (CSR tag or in-order counter), completed when all partitions reach waitValue
+    volatile TagAddressType *pollAddress = nullptr;
+    uint64_t waitValue = 0;
+    uint32_t partitionCount = 1;
+    uint32_t partitionOffset = 0;
+    GraphicsAllocation *pollAllocation = nullptr;
+
+    // Used instead of pollAddress when completion can't be expressed as single memory location
+    std::function<bool()> completionCheck;
+
+    Callback callback;
+    // Duplicated by the reactor on registration, the caller keeps ownership of the passed fd
+    int notificationFd = invalidNotificationFd;
+
+    std::shared_ptr<CompletionWatchToken> cancellationToken;
+
+    static constexpr int invalidNotificationFd = -1;
+};
+
+class CompletionReactor : NEO::NonCopyableAndNonMovableClass {
+  public:
+    static constexpr size_t spinIterationsBeforeBackoff = 64u;
+    static constexpr auto maxPollingBackoff = std::chrono::microseconds(500u);
+    static constexpr auto userFenceWaitTimeout = std::chrono::milliseconds(1u);
+
+    CompletionReactor();
+    virtual ~CompletionReactor();
+
+    static CompletionWatch createTaskCountWatch(CommandStreamReceiver &csr, TaskCountType taskCount);
+    static int createNotificationFd();
+    static void signalNotificationFd(int notificationFd);
+    static int duplicateNotificationFd(int notificationFd);
+    static void closeNotificationFd(int notificationFd);
+
+    void registerWatch(CompletionWatch &&watch);
+    void closeThread();
+    bool isReactorThread() const;
+    // False when watch registered by calling thread would be completed only after it returns (reactor thread, closing reactor)
+    bool canCompleteWatchesAsync();
+
+  protected:
+    static void *reactorProcess(void *arg);
+    MOCKABLE_VIRTUAL void openThread();
+    void transferRegisterList();
+    bool processWatches();
+    void waitForProgress();
+    enum class WatchState {
+        pending,
+        completed,
+        cancelled
+    };
+
+    void drainWatches();
+    void completeWatch(CompletionWatch &watch, bool gpuHangDetected);
+    void releaseWatch(CompletionWatch &watch);
+    static bool isWatchCompleted(const CompletionWatch &watch);
+    static WatchState checkWatch(CompletionWatch &watch);
+
+    std::vector<CompletionWatch> registerList;
+    std::vector<CompletionWatch> watches;
+    std::vector<CommandStreamReceiver *> hungCsrs;
+
+    std::unique_ptr<Thread> thread;
+    std::mutex reactorMtx;
+    std::mutex drainMtx;
+    std::condition_variable reactorCond;
+    std::atomic<bool> allowReactorProcess{false};
+    std::atomic<std::thread::id> reactorThreadId{};
+    bool draining = false;
+
+    std::chrono::microseconds gpuHangCheckPeriod{CommonConstants::gpuHangCheckTimeInUS};
+    std::chrono::milliseconds drainTimeout{1000};
+    std::chrono::high_resolution_clock::time_point lastHangCheckTime{};
+    std::chrono::microseconds pollingBackoff{0};
+    size_t idleIterations = 0;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<CompletionReactor>);
+
+} // namespace NEO
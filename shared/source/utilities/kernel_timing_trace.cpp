@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/kernel_timing_trace.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/source/utilities/completion_reactor.h"
+#include "shared/source/utilities/io_functions.h"
+#include "shared/source/utilities/tag_allocator.h"
+
+#include <algorithm>
+
+namespace NEO {
+
+namespace {
+std::string formatMicroseconds(uint64_t timeInNs) {
+    auto fraction = std::to_string(timeInNs % 1000);
+    return std::to_string(timeInNs / 1000) + "." + std::string(3 - fraction.size(), '0') + fraction;
+}
+
+std::string escapeJsonString(const std::string &input) {
+    std::string output;
+    output.reserve(input.size());
+    for (auto character : input) {
+        if (character == '"' || character == '\\') {
+            output.push_back('\\');
+        }
+        output.push_back(character);
+    }
+    return output;
+}
+} // namespace
+
+uint64_t KernelTimingDeviceClock::toHostNs(uint64_t gpuTicks) const {
+    auto deltaTicks = (gpuTicks - anchor.gpuTimeStamp) & timestampMask;
+    return anchor.cpuTimeinNS + static_cast<uint64_t>(deltaTicks * timerResolution);
+}
+
+KernelTimingTrace::KernelTimingTrace(const std::string &fileName, Format format) : fileName(fileName), format(format) {
+    events.reserve(eventsFlushThreshold);
+}
+
+KernelTimingTrace::~KernelTimingTrace() {
+    flush();
+    finalizeFile();
+}
+
+bool KernelTimingTrace::isEnabled() {
+    return debugManager.flags.EnableKernelTimingTrace.get() == 1;
+}
+
+std::string KernelTimingTrace::getDefaultFileName(Format format) {
+    return format == Format::binary ? "kernel_timing_trace.bin" : "kernel_timing_trace.json";
+}
+
+KernelTimingDeviceClock KernelTimingTrace::getDeviceClock(Device &device) {
+    std::lock_guard<std::mutex> lock(traceMtx);
+    auto clockIt = deviceClocks.find(device.getRootDeviceIndex());
+    if (clockIt != deviceClocks.end()) {
+        // GPU and CPU clocks drift apart, so the anchor is refreshed periodically
+        uint64_t cpuTimeNs = 0;
+        if (device.getOSTime()->getCpuTime(&cpuTimeNs) && cpuTimeNs - clockIt->second.anchor.cpuTimeinNS < clockReanchorIntervalNs) {
+            return clockIt->second;
+        }
+    }
+
+    KernelTimingDeviceClock clock;
+    device.getOSTime()->getGpuCpuTime(&clock.anchor);
+    clock.timerResolution = device.getProfilingTimerResolution();
+    clock.timestampMask = maxNBitValue(device.getHardwareInfo().capabilityTable.kernelTimestampValidBits);
+    deviceClocks[device.getRootDeviceIndex()] = clock;
+    return clock;
+}
+
+void KernelTimingTrace::submit(Device &device, CommandStreamReceiver &csr, TaskCountType taskCount, uint32_t queueId, std::vector<KernelTimingRecord> &&records) {
+    if (records.empty()) {
+        return;
+    }
+
+    auto clock = getDeviceClock(device);
+    auto rootDeviceIndex = device.getRootDeviceIndex();
+
+    auto watch = CompletionReactor::createTaskCountWatch(csr, taskCount);
+    watch.callback = [this, clock, rootDeviceIndex, queueId, records = std::move(records)](bool gpuHangDetected) mutable {
+        processRecords(clock, rootDeviceIndex, queueId, records, gpuHangDetected);
+    };
+    csr.peekExecutionEnvironment().getCompletionReactor()->registerWatch(std::move(watch));
+}
+
+void KernelTimingTrace::processRecords(const KernelTimingDeviceClock &clock, uint32_t rootDeviceIndex, uint32_t queueId, std::vector<KernelTimingRecord> &records, bool gpuHangDetected) {
+    std::lock_guard<std::mutex> lock(traceMtx);
+    for (auto &record : records) {
+        if (!gpuHangDetected) {
+            // each partition writes its own packet, kernel spans from the earliest start to the latest end
+            auto startTicks = record.timestampNode->getGlobalStartValue(0);
+            auto endTicks = record.timestampNode->getGlobalEndValue(0);
+            for (uint32_t packetId = 1; packetId < record.timestampNode->getPacketsUsed(); packetId++) {
+                startTicks = std::min(startTicks, record.timestampNode->getGlobalStartValue(packetId));
+                endTicks = std::max(endTicks, record.timestampNode->getGlobalEndValue(packetId));
+            }
+
+            KernelTimingTraceEvent event;
+            event.name = std::move(record.name);
+            event.apiCallId = record.apiCallId;
+            event.startNs = clock.toHostNs(startTicks);
+            event.endNs = event.startNs + static_cast<uint64_t>(((endTicks - startTicks) & clock.timestampMask) * clock.timerResolution);
+            event.rootDeviceIndex = rootDeviceIndex;
+            event.queueId = queueId;
+            events.push_back(std::move(event));
+        }
+        record.timestampNode->returnTag();
+    }
+    records.clear();
+
+    if (events.size() >= eventsFlushThreshold) {
+        writeEvents();
+    }
+}
+
+void KernelTimingTrace::flush() {
+    std::lock_guard<std::mutex> lock(traceMtx);
+    writeEvents();
+    if (traceFile) {
+        IoFunctions::fflushPtr(traceFile);
+    }
+}
+
+void KernelTimingTrace::writeEvents() {
+    deviceClocks.clear();
+    if (events.empty()) {
+        return;
+    }
+
+    if (!traceFile && !fileOpenFailed) {
+        traceFile = IoFunctions::fopenPtr(fileName.c_str(), "wb");
+        fileOpenFailed = (traceFile == nullptr);
+        if (traceFile) {
+            if (format == Format::binary) {
+                uint32_t header[] = {binaryTraceMagic, binaryTraceVersion};
+                writeToFile(header, sizeof(header));
+            } else {
+                const char header[] = "[\n";
+                writeToFile(header, sizeof(header) - 1);
+            }
+        }
+    }
+
+    if (!traceFile) {
+        events.clear();
+        return;
+    }
+
+    for (auto &event : events) {
+        if (format == Format::binary) {
+            uint64_t values64[] = {event.apiCallId, event.startNs, event.endNs};
+            uint32_t values32[] = {event.rootDeviceIndex, event.queueId, static_cast<uint32_t>(event.name.size())};
+            writeToFile(values64, sizeof(values64));
+            writeToFile(values32, sizeof(values32));
+            writeToFile(event.name.c_str(), event.name.size());
+        } else {
+            std::string jsonEvent = (writtenEvents > 0 ? ",\n" : "");
+            jsonEvent += "{\"name\":\"" + escapeJsonString(event.name) + "\",\"cat\":\"kernel\",\"ph\":\"X\"" +
+                         ",\"ts\":" + formatMicroseconds(event.startNs) +
+                         ",\"dur\":" + formatMicroseconds(event.endNs - event.startNs) +
+                         ",\"pid\":" + std::to_string(event.rootDeviceIndex) +
+                         ",\"tid\":" + std::to_string(event.queueId) +
+                         ",\"args\":{\"apiCallId\":" + std::to_string(event.apiCallId) + "}}";
+            writeToFile(jsonEvent.c_str(), jsonEvent.size());
+        }
+        writtenEvents++;
+    }
+    events.clear();
+}
+
+void KernelTimingTrace::writeToFile(const void *data, size_t size) {
+    if (traceFile) {
+        IoFunctions::fwritePtr(data, 1, size, traceFile);
+    }
+}
+
+void KernelTimingTrace::finalizeFile() {
+    if (!traceFile) {
+        return;
+    }
+    if (format == Format::chromeJson) {
+        const char footer[] = "\n]\n";
+        writeToFile(footer, sizeof(footer) - 1);
+    }
+    IoFunctions::fclosePtr(traceFile);
+    traceFile = nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/os_interface/os_time.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+class Device;
+class TagNodeBase;
+
+struct KernelTimingRecord {
+    TagNodeBase *timestampNode = nullptr;
+    std::string name;
+    uint64_t apiCallId = 0;
+};
+
+struct KernelTimingTraceEvent {
+    std::string name;
+    uint64_t apiCallId = 0;
+    uint64_t startNs = 0;
+    uint64_t endNs = 0;
+    uint32_t rootDeviceIndex = 0;
+    uint32_t queueId = 0;
+};
+
+struct KernelTimingDeviceClock {
+    TimeStampData anchor = {};
+    double timerResolution = 1.0;
+    uint64_t timestampMask = std::numeric_limits<uint64_t>::max();
+
+    uint64_t toHostNs(uint64_t gpuTicks) const;
+};
+
+class KernelTimingTrace : NEO::NonCopyableAndNonMovableClass {
+  public:
+    enum class Format : int32_t {
+        chromeJson = 0,
+        binary = 1
+    };
+
+    static constexpr size_t eventsFlushThreshold = 4096u;
+    static constexpr uint64_t clockReanchorIntervalNs = 1'000'000'000u;
+    static constexpr uint32_t binaryTraceMagic = 0x4b54524bu; // "KRTK"
+    static constexpr uint32_t binaryTraceVersion = 1u;
+
+    KernelTimingTrace(const std::string &fileName, Format format);
+    MOCKABLE_VIRTUAL ~KernelTimingTrace();
+
+    static bool isEnabled();
+    static std::string getDefaultFileName(Format format);
+
+    uint64_t getNextApiCallId() { return apiCallIdCounter.fetch_add(1, std::memory_order_relaxed); }
+    uint32_t getNextQueueId() { return queueIdCounter.fetch_add(1, std::memory_order_relaxed); }
+
+    void submit(Device &device, CommandStreamReceiver &csr, TaskCountType taskCount, uint32_t queueId, std::vector<KernelTimingRecord> &&records);
+    void processRecords(const KernelTimingDeviceClock &clock, uint32_t rootDeviceIndex, uint32_t queueId, std::vector<KernelTimingRecord> &records, bool gpuHangDetected);
+    void flush();
+
+  protected:
+    KernelTimingDeviceClock getDeviceClock(Device &device);
+    void writeEvents();
+    MOCKABLE_VIRTUAL void writeToFile(const void *data, size_t size);
+    void finalizeFile();
+
+    std::string fileName;
+    Format format;
+
+    std::mutex traceMtx;
+    std::vector<KernelTimingTraceEvent> events;
+    std::unordered_map<uint32_t, KernelTimingDeviceClock> deviceClocks;
+    FILE *traceFile = nullptr;
+    bool fileOpenFailed = false;
+    size_t writtenEvents = 0;
+
+    std::atomic<uint64_t> apiCallIdCounter{0};
+    std::atomic<uint32_t> queueIdCounter{0};
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<KernelTimingTrace>);
+
+} // namespace NEO
@@ -0,0 +1,34 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/source/utilities/completion_reactor.h"
+
+#include <sys/eventfd.h>
+
+namespace NEO {
+
+int CompletionReactor::createNotificationFd() {
+    auto notificationFd = SysCalls::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    return notificationFd < 0 ? CompletionWatch::invalidNotificationFd : notificationFd;
+}
+
+void CompletionReactor::signalNotificationFd(int notificationFd) {
+    uint64_t value = 1u;
+    [[maybe_unused]] auto bytesWritten = SysCalls::write(notificationFd, &value, sizeof(value));
+}
+
+int CompletionReactor::duplicateNotificationFd(int notificationFd) {
+    auto duplicatedFd = SysCalls::dup(notificationFd);
+    return duplicatedFd < 0 ? CompletionWatch::invalidNotificationFd : duplicatedFd;
+}
+
+void CompletionReactor::closeNotificationFd(int notificationFd) {
+    SysCalls::close(notificationFd);
+}
+
+} // namespace NEO
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/linux/sys_calls.h"
+#include "shared/source/utilities/local_work_size_autotuner.h"
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+
+namespace NEO {
+
+UnifiedHandle LocalWorkSizeAutotuner::lockCacheFile() {
+    auto lockFilePath = cacheFileName + ".lock";
+    int fd = SysCalls::openWithMode(lockFilePath.c_str(), O_CREAT | O_RDWR | O_CLOEXEC, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        return -1;
+    }
+    if (SysCalls::flock(fd, LOCK_EX) < 0) {
+        SysCalls::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+void LocalWorkSizeAutotuner::unlockCacheFile(UnifiedHandle lockHandle) {
+    auto fd = std::get<int>(lockHandle);
+    if (fd < 0) {
+        return;
+    }
+    SysCalls::flock(fd, LOCK_UN);
+    SysCalls::close(fd);
+}
+
+} // namespace NEO
@@ -0,0 +1,379 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/local_work_size_autotuner.h"
+
+#include "shared/source/command_stream/command_stream_receiver.h"
+#include "shared/source/compiler_interface/default_cache_config.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/execution_environment/execution_environment.h"
+#include "shared/source/execution_environment/root_device_environment.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/path.h"
+#include "shared/source/program/kernel_info.h"
+#include "shared/source/utilities/completion_reactor.h"
+#include "shared/source/utilities/io_functions.h"
+#include "shared/source/utilities/tag_allocator.h"
+
+#include <algorithm>
+#include <sstream>
+
+namespace NEO {
+
+size_t LocalWorkSizeAutotuneKeyHasher::operator()(const LocalWorkSizeAutotuneKey &key) const {
+    Hash hash;
+    hash.update(reinterpret_cast<const char *>(&key.kernelHash), sizeof(key.kernelHash));
+    hash.update(reinterpret_cast<const char *>(&key.deviceId), sizeof(key.deviceId));
+    hash.update(reinterpret_cast<const char *>(key.gws.values), sizeof(key.gws.values));
+    return static_cast<size_t>(hash.finish());
+}
+
+LocalWorkSizeAutotuner::LocalWorkSizeAutotuner(const std::string &cacheFileName, uint32_t samplesPerCandidate, uint32_t maxCandidates)
+    : cacheFileName(cacheFileName), samplesPerCandidate(std::max(samplesPerCandidate, 1u)), maxCandidates(std::max(maxCandidates, 1u)) {}
+
+bool LocalWorkSizeAutotuner::isEnabled() {
+    return debugManager.flags.EnableLocalWorkSizeAutotune.get() == 1;
+}
+
+std::string LocalWorkSizeAutotuner::getDefaultCacheFilePath() {
+    auto cacheConfig = getDefaultCompilerCacheConfig();
+    if (!cacheConfig.enabled || cacheConfig.cacheDir.empty()) {
+        return "";
+    }
+    return joinPath(cacheConfig.cacheDir, defaultCacheFileName);
+}
+
+LocalWorkSizeAutotuneKey LocalWorkSizeAutotuner::createKey(const KernelInfo &kernelInfo, const HardwareInfo &hwInfo, const Vec3<size_t> &gws) {
+    const auto &kernelName = kernelInfo.kernelDescriptor.kernelMetadata.kernelName;
+
+    Hash hash;
+    hash.update(kernelName.c_str(), kernelName.size());
+    hash.update(reinterpret_cast<const char *>(&kernelInfo.unpatchedIsaHash), sizeof(kernelInfo.unpatchedIsaHash));
+
+    LocalWorkSizeAutotuneKey key;
+    key.kernelHash = hash.finish();
+    key.deviceId = (static_cast<uint32_t>(hwInfo.platform.usDeviceID) << 16) | hwInfo.platform.usRevId;
+    key.gws = gws;
+    return key;
+}
+
+std::vector<Vec3<size_t>> LocalWorkSizeAutotuner::generateCandidates(const Vec3<size_t> &gws, const Vec3<size_t> &defaultLws, size_t maxWorkGroupSize, uint32_t simdSize, uint32_t maxCandidates) {
+    std::vector<Vec3<size_t>> candidates;
+    candidates.push_back(defaultLws);
+
+    std::vector<size_t> divisors[3];
+    for (uint32_t dim = 0; dim < 3; dim++) {
+        for (size_t value = 1; value <= maxWorkGroupSize && value <= gws[dim] && gws[dim] % value == 0; value *= 2) {
+            divisors[dim].push_back(value);
+        }
+        if (divisors[dim].empty()) {
+            return candidates;
+        }
+    }
+
+    auto totalWorkItems = gws.x * gws.y * gws.z;
+    std::vector<Vec3<size_t>> shapes;
+    for (auto x : divisors[0]) {
+        for (auto y : divisors[1]) {
+            for (auto z : divisors[2]) {
+                auto groupSize = x * y * z;
+                if (groupSize > maxWorkGroupSize) {
+                    continue;
+                }
+                if (groupSize % simdSize != 0 && groupSize != totalWorkItems) {
+                    continue;
+                }
+                shapes.push_back({x, y, z});
+            }
+        }
+    }
+
+    auto groupSizeOf = [](const Vec3<size_t> &lws) { return lws.x * lws.y * lws.z; };
+    auto largestDimOf = [](const Vec3<size_t> &lws) { return std::max({lws.x, lws.y, lws.z}); };
+
+    // for every group size from the largest one, try the shape with the widest x dimension and the most balanced one
+    std::sort(shapes.begin(), shapes.end(), [&](const Vec3<size_t> &lhs, const Vec3<size_t> &rhs) {
+        if (groupSizeOf(lhs) != groupSizeOf(rhs)) {
+            return groupSizeOf(lhs) > groupSizeOf(rhs);
+        }
+        return lhs.x != rhs.x ? lhs.x > rhs.x : lhs.y > rhs.y;
+    });
+
+    auto addCandidate = [&](const Vec3<size_t> &lws) {
+        if (candidates.size() < maxCandidates && std::find(candidates.begin(), candidates.end(), lws) == candidates.end()) {
+            candidates.push_back(lws);
+        }
+    };
+
+    for (auto groupBegin = shapes.begin(); groupBegin != shapes.end() && candidates.size() < maxCandidates;) {
+        auto groupEnd = std::find_if(groupBegin, shapes.end(), [&](const Vec3<size_t> &lws) { return groupSizeOf(lws) != groupSizeOf(*groupBegin); });
+        auto balanced = std::min_element(groupBegin, groupEnd, [&](const Vec3<size_t> &lhs, const Vec3<size_t> &rhs) { return largestDimOf(lhs) < largestDimOf(rhs); });
+        addCandidate(*groupBegin);
+        addCandidate(*balanced);
+        groupBegin = groupEnd;
+    }
+    return candidates;
+}
+
+Vec3<size_t> LocalWorkSizeAutotuner::selectLocalWorkSize(const LocalWorkSizeAutotuneKey &key, const Vec3<size_t> &defaultLws, size_t maxWorkGroupSize, uint32_t simdSize, bool &measurementRequired) {
+    measurementRequired = false;
+
+    std::lock_guard<std::mutex> lock(autotunerMtx);
+    loadCache();
+
+    auto tunedIt = tunedSizes.find(key);
+    if (tunedIt != tunedSizes.end()) {
+        return tunedIt->second;
+    }
+
+    auto stateIt = tuningStates.find(key);
+    if (stateIt == tuningStates.end()) {
+        auto candidateSizes = generateCandidates(key.gws, defaultLws, maxWorkGroupSize, simdSize, maxCandidates);
+        if (candidateSizes.size() == 1) {
+            tunedSizes.insert_or_assign(key, defaultLws);
+            return defaultLws;
+        }
+
+        TuningState state;
+        for (auto &lws : candidateSizes) {
+            Candidate candidate;
+            candidate.lws = lws;
+            state.candidates.push_back(candidate);
+        }
+        stateIt = tuningStates.emplace(key, std::move(state)).first;
+    }
+
+    // trials lost before being measured are handed out again, until too many of them are never measured
+    auto &state = stateIt->second;
+    auto unmeasuredTrials = state.handedOutTrials - std::min(state.handedOutTrials, state.measuredTrials);
+    if (unmeasuredTrials >= state.candidates.size() * samplesPerCandidate * unmeasuredTrialsLimitFactor) {
+        return settleWithoutMeasurements(stateIt);
+    }
+
+    auto selected = state.nextCandidate;
+    for (size_t i = 1; i < state.candidates.size(); i++) {
+        auto index = (state.nextCandidate + i) % state.candidates.size();
+        if (state.candidates[index].measurements < state.candidates[selected].measurements) {
+            selected = index;
+        }
+    }
+    state.nextCandidate = (selected + 1) % state.candidates.size();
+    state.handedOutTrials++;
+
+    measurementRequired = true;
+    return state.candidates[selected].lws;
+}
+
+std::optional<LocalWorkSizeAutotuneTrial> LocalWorkSizeAutotuner::getPendingTrial(const LocalWorkSizeAutotuneKey &key, const Vec3<size_t> &lws) {
+    std::lock_guard<std::mutex> lock(autotunerMtx);
+
+    auto stateIt = tuningStates.find(key);
+    if (stateIt == tuningStates.end()) {
+        return std::nullopt;
+    }
+    auto &candidates = stateIt->second.candidates;
+    if (std::none_of(candidates.begin(), candidates.end(), [&](const Candidate &candidate) { return candidate.lws == lws; })) {
+        return std::nullopt;
+    }
+    return LocalWorkSizeAutotuneTrial{key, lws};
+}
+
+Vec3<size_t> LocalWorkSizeAutotuner::settleWithoutMeasurements(TuningStates::iterator stateIt) {
+    // use the fastest candidate measured so far or the default one, result is not persisted as tuning was not completed
+    auto &candidates = stateIt->second.candidates;
+    auto settledLws = candidates[0].lws;
+    auto best = std::min_element(candidates.begin(), candidates.end(), [](const Candidate &lhs, const Candidate &rhs) { return lhs.minDurationTicks < rhs.minDurationTicks; });
+    if (best->measurements > 0) {
+        settledLws = best->lws;
+    }
+    PRINT_DEBUG_STRING(debugManager.flags.PrintLocalWorkSizeAutotune.get(), stdout,
+                       "LWS autotune: kernel %llx, GWS (%zu, %zu, %zu): too many trials not measured, using LWS (%zu, %zu, %zu)\n",
+                       static_cast<unsigned long long>(stateIt->first.kernelHash), stateIt->first.gws.x, stateIt->first.gws.y, stateIt->first.gws.z,
+                       settledLws.x, settledLws.y, settledLws.z);
+
+    tunedSizes.insert_or_assign(stateIt->first, settledLws);
+    tuningStates.erase(stateIt);
+    return settledLws;
+}
+
+void LocalWorkSizeAutotuner::reportMeasurement(const LocalWorkSizeAutotuneTrial &trial, uint64_t durationTicks) {
+    std::lock_guard<std::mutex> lock(autotunerMtx);
+
+    auto stateIt = tuningStates.find(trial.key);
+    if (stateIt == tuningStates.end()) {
+        return;
+    }
+
+    auto &candidates = stateIt->second.candidates;
+    auto candidateIt = std::find_if(candidates.begin(), candidates.end(), [&](const Candidate &candidate) { return candidate.lws == trial.lws; });
+    if (candidateIt == candidates.end()) {
+        return;
+    }
+    candidateIt->measurements++;
+    stateIt->second.measuredTrials++;
+    candidateIt->minDurationTicks = std::min(candidateIt->minDurationTicks, durationTicks);
+
+    auto tuningCompleted = std::all_of(candidates.begin(), candidates.end(), [&](const Candidate &candidate) { return candidate.measurements >= samplesPerCandidate; });
+    if (!tuningCompleted) {
+        return;
+    }
+
+    auto best = std::min_element(candidates.begin(), candidates.end(), [](const Candidate &lhs, const Candidate &rhs) { return lhs.minDurationTicks < rhs.minDurationTicks; });
+    PRINT_DEBUG_STRING(debugManager.flags.PrintLocalWorkSizeAutotune.get(), stdout,
+                       "LWS autotune: kernel %llx, GWS (%zu, %zu, %zu): selected LWS (%zu, %zu, %zu), %llu ticks, default LWS (%zu, %zu, %zu), %llu ticks\n",
+                       static_cast<unsigned long long>(trial.key.kernelHash), trial.key.gws.x, trial.key.gws.y, trial.key.gws.z,
+                       best->lws.x, best->lws.y, best->lws.z, static_cast<unsigned long long>(best->minDurationTicks),
+                       candidates[0].lws.x, candidates[0].lws.y, candidates[0].lws.z, static_cast<unsigned long long>(candidates[0].minDurationTicks));
+
+    auto bestLws = best->lws;
+    tuningStates.erase(stateIt);
+    storeResult(trial.key, bestLws);
+}
+
+void LocalWorkSizeAutotuner::submit(CommandStreamReceiver &csr, TaskCountType taskCount, std::vector<LocalWorkSizeAutotuneRecord> &&records) {
+    if (records.empty()) {
+        return;
+    }
+
+    auto timestampMask = maxNBitValue(csr.peekRootDeviceEnvironment().getHardwareInfo()->capabilityTable.kernelTimestampValidBits);
+    auto watch = CompletionReactor::createTaskCountWatch(csr, taskCount);
+    watch.callback = [this, timestampMask, records = std::move(records)](bool gpuHangDetected) mutable {
+        processRecords(records, timestampMask, gpuHangDetected);
+    };
+    csr.peekExecutionEnvironment().getCompletionReactor()->registerWatch(std::move(watch));
+}
+
+void LocalWorkSizeAutotuner::processRecords(std::vector<LocalWorkSizeAutotuneRecord> &records, uint64_t timestampMask, bool gpuHangDetected) {
+    for (auto &record : records) {
+        if (!gpuHangDetected) {
+            // global timestamps are narrower than 64 bits and may wrap between start and end
+            auto startTicks = record.timestampNode->getGlobalStartValue(0);
+            auto endTicks = record.timestampNode->getGlobalEndValue(0);
+            reportMeasurement(record.trial, (endTicks - startTicks) & timestampMask);
+        }
+        record.timestampNode->returnTag();
+    }
+    records.clear();
+}
+
+void LocalWorkSizeAutotuner::loadCache() {
+    if (cacheLoaded) {
+        return;
+    }
+    cacheLoaded = true;
+    if (cacheFileName.empty()) {
+        return;
+    }
+    readCacheEntries();
+}
+
+void LocalWorkSizeAutotuner::readCacheEntries() {
+    std::istringstream cacheStream(readCacheFile());
+    std::string line;
+    while (std::getline(cacheStream, line)) {
+        std::istringstream lineStream(line);
+        LocalWorkSizeAutotuneKey key;
+        Vec3<size_t> lws = {0, 0, 0};
+        lineStream >> std::hex >> key.kernelHash >> key.deviceId >> std::dec >> key.gws.x >> key.gws.y >> key.gws.z >> lws.x >> lws.y >> lws.z;
+        if (lineStream.fail() || lws.x == 0 || lws.y == 0 || lws.z == 0) {
+            continue;
+        }
+        tunedSizes.insert_or_assign(key, lws);
+        cacheFileKeys.push_back(key);
+    }
+}
+
+std::string LocalWorkSizeAutotuner::formatCacheEntry(const LocalWorkSizeAutotuneKey &key, const Vec3<size_t> &lws) {
+    std::ostringstream entry;
+    entry << std::hex << key.kernelHash << " " << key.deviceId << std::dec << " "
+          << key.gws.x << " " << key.gws.y << " " << key.gws.z << " "
+          << lws.x << " " << lws.y << " " << lws.z << "\n";
+    return entry.str();
+}
+
+void LocalWorkSizeAutotuner::storeResult(const LocalWorkSizeAutotuneKey &key, const Vec3<size_t> &lws) {
+    tunedSizes.insert_or_assign(key, lws);
+    if (cacheFileName.empty()) {
+        return;
+    }
+
+    // file is shared with other processes, entries appended by them are read back before it is rewritten
+    auto lockHandle = lockCacheFile();
+    if (cacheFileKeys.size() >= maxCacheFileEntries) {
+        cacheFileKeys.clear();
+        readCacheEntries();
+        tunedSizes.insert_or_assign(key, lws);
+    }
+    cacheFileKeys.push_back(key);
+    if (cacheFileKeys.size() > maxCacheFileEntries) {
+        compactCacheFile();
+    } else {
+        appendToCacheFile(formatCacheEntry(key, lws));
+    }
+    unlockCacheFile(lockHandle);
+}
+
+void LocalWorkSizeAutotuner::compactCacheFile() {
+    // keep the most recent half of unique entries, so that file is rewritten at most once per that many results
+    const auto entriesToKeep = std::max(maxCacheFileEntries / 2, static_cast<size_t>(1u));
+    std::vector<LocalWorkSizeAutotuneKey> keptKeys;
+    keptKeys.reserve(entriesToKeep);
+    for (auto keyIt = cacheFileKeys.rbegin(); keyIt != cacheFileKeys.rend() && keptKeys.size() < entriesToKeep; ++keyIt) {
+        if (std::find(keptKeys.begin(), keptKeys.end(), *keyIt) == keptKeys.end()) {
+            keptKeys.push_back(*keyIt);
+        }
+    }
+    std::reverse(keptKeys.begin(), keptKeys.end());
+
+    std::string content;
+    for (auto &key : keptKeys) {
+        content += formatCacheEntry(key, tunedSizes[key]);
+    }
+    cacheFileKeys = std::move(keptKeys);
+    writeCacheFile(content);
+}
+
+std::string LocalWorkSizeAutotuner::readCacheFile() {
+    auto cacheFile = IoFunctions::fopenPtr(cacheFileName.c_str(), "rb");
+    if (!cacheFile) {
+        return "";
+    }
+
+    IoFunctions::fseekPtr(cacheFile, 0, SEEK_END);
+    auto fileSize = IoFunctions::ftellPtr(cacheFile);
+    IoFunctions::rewindPtr(cacheFile);
+
+    std::string content;
+    if (fileSize > 0) {
+        content.resize(static_cast<size_t>(fileSize));
+        content.resize(IoFunctions::freadPtr(content.data(), 1, content.size(), cacheFile));
+    }
+    IoFunctions::fclosePtr(cacheFile);
+    return content;
+}
+
+void LocalWorkSizeAutotuner::appendToCacheFile(const std::string &entry) {
+    auto cacheFile = IoFunctions::fopenPtr(cacheFileName.c_str(), "ab");
+    if (!cacheFile) {
+        return;
+    }
+    IoFunctions::fwritePtr(entry.c_str(), 1, entry.size(), cacheFile);
+    IoFunctions::fclosePtr(cacheFile);
+}
+
+void LocalWorkSizeAutotuner::writeCacheFile(const std::string &content) {
+    auto cacheFile = IoFunctions::fopenPtr(cacheFileName.c_str(), "wb");
+    if (!cacheFile) {
+        return;
+    }
+    IoFunctions::fwritePtr(content.c_str(), 1, content.size(), cacheFile);
+    IoFunctions::fclosePtr(cacheFile);
+}
+
+} // namespace NEO
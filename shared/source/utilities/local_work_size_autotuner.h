@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+
+#include "shared/source/command_stream/task_count_helper.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/helpers/vec.h"
+#include "shared/source/os_interface/os_handle.h"
+
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class CommandStreamReceiver;
+class TagNodeBase;
+struct HardwareInfo;
+struct KernelInfo;
+
+struct LocalWorkSizeAutotuneKey {
+    uint64_t kernelHash = 0;
+    uint32_t deviceId = 0;
+    Vec3<size_t> gws = {0, 0, 0};
+
+    bool operator==(const LocalWorkSizeAutotuneKey &other) const {
+        return kernelHash == other.kernelHash && deviceId == other.deviceId && gws == other.gws;
+    }
+};
+
+struct LocalWorkSizeAutotuneKeyHasher {
+    size_t operator()(const LocalWorkSizeAutotuneKey &key) const;
+};
+
+struct LocalWorkSizeAutotuneTrial {
+    LocalWorkSizeAutotuneKey key;
+    Vec3<size_t> lws = {0, 0, 0};
+};
+
+struct LocalWorkSizeAutotuneRecord {
+    TagNodeBase *timestampNode = nullptr;
+    LocalWorkSizeAutotuneTrial trial;
+};
+
+// Tunes local work sizes of launches without application provided group size.
+// Candidate shapes are handed out round robin until each one is measured the requested number of times,
+// the fastest one is used for all later launches and persisted in the cache file.
+// When too many handed out trials are never measured, the fastest shape measured so far or the default one is used without persisting it.
+// Cache file is locked against other processes while it is updated and is rewritten with the most recent results once it grows over the entries limit.
+class LocalWorkSizeAutotuner : NEO::NonCopyableAndNonMovableClass {
+  public:
+    static constexpr const char *defaultCacheFileName = "lws_autotune.cache";
+    static constexpr uint32_t defaultSamplesPerCandidate = 3u;
+    static constexpr uint32_t defaultMaxCandidates = 8u;
+    static constexpr size_t defaultMaxCacheFileEntries = 4096u;
+    static constexpr size_t unmeasuredTrialsLimitFactor = 4u;
+
+    LocalWorkSizeAutotuner(const std::string &cacheFileName, uint32_t samplesPerCandidate, uint32_t maxCandidates);
+    MOCKABLE_VIRTUAL ~LocalWorkSizeAutotuner() = default;
+
+    static bool isEnabled();
+    static std::string getDefaultCacheFilePath();
+    static LocalWorkSizeAutotuneKey createKey(const KernelInfo &kernelInfo, const HardwareInfo &hwInfo, const Vec3<size_t> &gws);
+    static std::vector<Vec3<size_t>> generateCandidates(const Vec3<size_t> &gws, const Vec3<size_t> &defaultLws, size_t maxWorkGroupSize, uint32_t simdSize, uint32_t maxCandidates);
+
+    Vec3<size_t> selectLocalWorkSize(const LocalWorkSizeAutotuneKey &key, const Vec3<size_t> &defaultLws, size_t maxWorkGroupSize, uint32_t simdSize, bool &measurementRequired);
+    std::optional<LocalWorkSizeAutotuneTrial> getPendingTrial(const LocalWorkSizeAutotuneKey &key, const Vec3<size_t> &lws);
+    void reportMeasurement(const LocalWorkSizeAutotuneTrial &trial, uint64_t durationTicks);
+    void submit(CommandStreamReceiver &csr, TaskCountType taskCount, std::vector<LocalWorkSizeAutotuneRecord> &&records);
+    void processRecords(std::vector<LocalWorkSizeAutotuneRecord> &records, uint64_t timestampMask, bool gpuHangDetected);
+
+  protected:
+    struct Candidate {
+        Vec3<size_t> lws = {0, 0, 0};
+        uint32_t measurements = 0;
+        uint64_t minDurationTicks = std::numeric_limits<uint64_t>::max();
+    };
+
+    struct TuningState {
+        std::vector<Candidate> candidates;
+        size_t nextCandidate = 0;
+        size_t handedOutTrials = 0;
+        size_t measuredTrials = 0;
+    };
+    using TuningStates = std::unordered_map<LocalWorkSizeAutotuneKey, TuningState, LocalWorkSizeAutotuneKeyHasher>;
+
+    Vec3<size_t> settleWithoutMeasurements(TuningStates::iterator stateIt);
+    static std::string formatCacheEntry(const LocalWorkSizeAutotuneKey &key, const Vec3<size_t> &lws);
+    void loadCache();
+    void readCacheEntries();
+    void storeResult(const LocalWorkSizeAutotuneKey &key, const Vec3<size_t> &lws);
+    void compactCacheFile();
+    MOCKABLE_VIRTUAL std::string readCacheFile();
+    MOCKABLE_VIRTUAL void appendToCacheFile(const std::string &entry);
+    MOCKABLE_VIRTUAL void writeCacheFile(const std::string &content);
+    MOCKABLE_VIRTUAL UnifiedHandle lockCacheFile();
+    MOCKABLE_VIRTUAL void unlockCacheFile(UnifiedHandle lockHandle);
+
+    std::string cacheFileName;
+    uint32_t samplesPerCandidate;
+    uint32_t maxCandidates;
+
+    std::mutex autotunerMtx;
+    std::unordered_map<LocalWorkSizeAutotuneKey, Vec3<size_t>, LocalWorkSizeAutotuneKeyHasher> tunedSizes;
+    TuningStates tuningStates;
+    std::vector<LocalWorkSizeAutotuneKey> cacheFileKeys;
+    size_t maxCacheFileEntries = defaultMaxCacheFileEntries;
+    bool cacheLoaded = false;
+};
+
+static_assert(NEO::NonCopyableAndNonMovable<LocalWorkSizeAutotuner>);
+
+} // namespace NEO
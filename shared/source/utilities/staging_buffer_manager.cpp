@@ -13,6 +13,7 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/strided_copy.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_interface.h"
@@ -73,7 +74,7 @@ StagingTransferStatus StagingBufferManager::performChunkTransfer(size_t chunkTra
 
     auto stagingBuffer = addrToPtr(tracker.chunkAddress);
     if (!isRead) {
-        memcpy(stagingBuffer, userData.ptr, userData.size);
+        StridedCopy::copy(stagingBuffer, userData.ptr, userData.size);
     }
 
     result.chunkCopyStatus = func(stagingBuffer, args...);
@@ -272,16 +273,19 @@ void StagingBufferManager::copyImageToHost(void *dst, const void *stagingBuffer,
     auto sliceSize = imageData.rowSize * imageData.rowsInChunk;
 
     if (imageData.rowSize < imageData.rowPitch || (sliceSize < imageData.slicePitch && imageData.slicesInChunk > 1)) {
-        for (auto sliceId = 0u; sliceId < imageData.slicesInChunk; sliceId++) {
-            auto sliceOffset = sliceId * imageData.slicePitch;
-            for (auto rowId = 0u; rowId < imageData.rowsInChunk; rowId++) {
-                auto rowOffset = rowId * imageData.rowPitch;
-                auto offset = sliceOffset + rowOffset;
-                memcpy(ptrOffset(dst, offset), ptrOffset(stagingBuffer, offset), imageData.rowSize);
-            }
-        }
+        StridedCopyRegion region{};
+        region.dst = dst;
+        region.dstRowPitch = imageData.rowPitch;
+        region.dstSlicePitch = imageData.slicePitch;
+        region.src = stagingBuffer;
+        region.srcRowPitch = imageData.rowPitch;
+        region.srcSlicePitch = imageData.slicePitch;
+        region.rowSize = imageData.rowSize;
+        region.rowCount = imageData.rowsInChunk;
+        region.sliceCount = imageData.slicesInChunk;
+        StridedCopy::copyRegion(region);
     } else {
-        memcpy(dst, stagingBuffer, size);
+        StridedCopy::copy(dst, stagingBuffer, size);
     }
 }
 
@@ -305,7 +309,7 @@ WaitStatus StagingBufferManager::copyStagingToHost(const std::pair<UserData, Sta
         return WaitStatus::ready;
     }
 
-    memcpy(userDst, stagingBuffer, userData.size);
+    StridedCopy::copy(userDst, stagingBuffer, userData.size);
     return WaitStatus::ready;
 }
 
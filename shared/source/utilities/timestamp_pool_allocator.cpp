@@ -14,15 +14,15 @@
 #include "shared/source/utilities/buffer_pool_allocator.inl"
 
 namespace NEO {
-TimestampPool::TimestampPool(Device *device, size_t poolSize)
+TimestampPool::TimestampPool(Device *device, size_t poolSize, bool hostMemory)
     : BaseType(device->getMemoryManager(), nullptr), device(device) {
     DEBUG_BREAK_IF(device->getProductHelper().is2MBLocalMemAlignmentEnabled() &&
                    !isAligned(poolSize, MemoryConstants::pageSize2M));
 
     AllocationProperties properties{device->getRootDeviceIndex(),
                                     poolSize,
-                                    AllocationType::gpuTimestampDeviceBuffer,
-                                    device->getDeviceBitfield()};
+                                    hostMemory ? AllocationType::timestampPacketTagBuffer : AllocationType::gpuTimestampDeviceBuffer,
+                                    hostMemory ? systemMemoryBitfield : device->getDeviceBitfield()};
     auto graphicsAllocation = memoryManager->allocateGraphicsMemoryWithProperties(properties);
 
     this->mainStorage.reset(graphicsAllocation);
@@ -44,6 +44,9 @@ TimestampPool::~TimestampPool() {
 }
 
 SharedTimestampAllocation *TimestampPool::allocate(size_t size) {
+    if (!this->mainStorage) {
+        return nullptr;
+    }
     auto offset = static_cast<size_t>(this->chunkAllocator->allocate(size));
     if (offset == 0) {
         return nullptr;
@@ -55,7 +58,7 @@ const StackVec<GraphicsAllocation *, 1> &TimestampPool::getAllocationsVector() {
     return stackVec;
 }
 
-TimestampPoolAllocator::TimestampPoolAllocator(Device *device) : device(device) {}
+TimestampPoolAllocator::TimestampPoolAllocator(Device *device, bool hostMemory) : device(device), hostMemory(hostMemory) {}
 
 bool TimestampPoolAllocator::isEnabled() const {
     if (NEO::debugManager.flags.EnableTimestampPoolAllocator.get() != -1) {
@@ -73,7 +76,7 @@ SharedTimestampAllocation *TimestampPoolAllocator::requestGraphicsAllocationForT
     std::lock_guard<std::mutex> lock(allocatorMtx);
 
     if (bufferPools.empty()) {
-        addNewBufferPool(TimestampPool(device, alignToPoolSize(defaultPoolSize)));
+        addNewBufferPool(TimestampPool(device, alignToPoolSize(defaultPoolSize), hostMemory));
     }
 
     auto allocFromPool = allocateFromPools(size);
@@ -88,7 +91,7 @@ SharedTimestampAllocation *TimestampPoolAllocator::requestGraphicsAllocationForT
         return allocFromPool;
     }
 
-    addNewBufferPool(TimestampPool(device, alignToPoolSize(defaultPoolSize)));
+    addNewBufferPool(TimestampPool(device, alignToPoolSize(defaultPoolSize), hostMemory));
     return allocateFromPools(size);
 }
 
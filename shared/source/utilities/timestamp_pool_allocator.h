@@ -25,7 +25,7 @@ class TimestampPool : public AbstractBuffersPool<TimestampPool, GraphicsAllocati
     using BaseType = AbstractBuffersPool<TimestampPool, GraphicsAllocation>;
 
   public:
-    TimestampPool(Device *device, size_t poolSize);
+    TimestampPool(Device *device, size_t poolSize, bool hostMemory);
 
     TimestampPool(const TimestampPool &) = delete;
     TimestampPool &operator=(const TimestampPool &) = delete;
@@ -46,7 +46,7 @@ class TimestampPool : public AbstractBuffersPool<TimestampPool, GraphicsAllocati
 
 class TimestampPoolAllocator : public AbstractBuffersAllocator<TimestampPool, GraphicsAllocation> {
   public:
-    TimestampPoolAllocator(Device *device);
+    TimestampPoolAllocator(Device *device, bool hostMemory);
 
     bool isEnabled() const;
 
@@ -54,6 +54,7 @@ class TimestampPoolAllocator : public AbstractBuffersAllocator<TimestampPool, Gr
     void freeSharedTimestampAllocation(SharedTimestampAllocation *sharedTimestampAllocation);
 
     size_t getDefaultPoolSize() const { return defaultPoolSize; }
+    bool isHostMemory() const { return hostMemory; }
 
   private:
     SharedTimestampAllocation *allocateFromPools(size_t size);
@@ -64,6 +65,7 @@ class TimestampPoolAllocator : public AbstractBuffersAllocator<TimestampPool, Gr
     const size_t poolAlignment = MemoryConstants::pageSize2M;
 
     Device *device;
+    bool hostMemory = false;
     std::mutex allocatorMtx;
 };
 
@@ -9,8 +9,13 @@
 
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/sleep.h"
 #include "shared/source/utilities/cpu_info.h"
 
+#include <algorithm>
+#include <bit>
+#include <chrono>
+
 namespace NEO {
 
 namespace WaitUtils {
@@ -79,6 +84,126 @@ void adjustWaitpkgParamsForUllsLight() {
     overrideWaitpkgParams();
 }
 
+uint32_t AdaptiveWaitPolicy::getBucketIndex(int64_t timeInMicroSeconds) {
+    if (timeInMicroSeconds <= 0) {
+        return 0u;
+    }
+    // bucket 0 holds [0, 2) us, bucket n holds [2^n, 2^(n+1)) us
+    auto bucketIndex = static_cast<uint32_t>(std::bit_width(static_cast<uint64_t>(timeInMicroSeconds))) - 1u;
+    return std::min(bucketIndex, histogramBucketCount - 1u);
+}
+
+int64_t AdaptiveWaitPolicy::getBucketRepresentativeTime(uint32_t bucketIndex) {
+    if (bucketIndex == 0u) {
+        return 1;
+    }
+    return static_cast<int64_t>(3ull << (bucketIndex - 1u));
+}
+
+WaitPhase AdaptiveWaitPolicy::selectWaitPhase(int64_t predictedRemainingTime) {
+    if (predictedRemainingTime <= spinPhaseThresholdInMicroSeconds) {
+        return WaitPhase::spin;
+    }
+    if (predictedRemainingTime <= monitorWaitPhaseThresholdInMicroSeconds) {
+        return WaitPhase::monitorWait;
+    }
+    return WaitPhase::sleep;
+}
+
+void AdaptiveWaitPolicy::recordCompletion(int64_t waitTimeInMicroSeconds) {
+    completedWaits.fetch_add(1, std::memory_order_relaxed);
+    histogram[getBucketIndex(waitTimeInMicroSeconds)].fetch_add(1, std::memory_order_relaxed);
+
+    if (sampleCount.fetch_add(1, std::memory_order_relaxed) + 1 < maxSamplesBeforeDecay) {
+        return;
+    }
+
+    // Halve history so that workload changes are picked up
+    uint64_t remainingSamples = 0;
+    for (auto &bucket : histogram) {
+        auto value = bucket.load(std::memory_order_relaxed) / 2;
+        bucket.store(value, std::memory_order_relaxed);
+        remainingSamples += value;
+    }
+    sampleCount.store(remainingSamples, std::memory_order_relaxed);
+}
+
+int64_t AdaptiveWaitPolicy::predictRemainingTime(int64_t timeElapsedSinceWaitStarted) const {
+    if (getSampleCount() < minSamplesForPrediction) {
+        return unknownRemainingTime;
+    }
+
+    // Only waits which lasted at least as long as the current one are relevant
+    auto firstBucket = getBucketIndex(timeElapsedSinceWaitStarted);
+    uint64_t pendingSamples = 0;
+    for (auto i = firstBucket; i < histogramBucketCount; i++) {
+        pendingSamples += histogram[i].load(std::memory_order_relaxed);
+    }
+
+    if (pendingSamples == 0) {
+        // Longer than anything observed, assume it may take as long again
+        return std::max(timeElapsedSinceWaitStarted, int64_t{0});
+    }
+
+    uint64_t medianSamples = (pendingSamples + 1) / 2;
+    uint64_t accumulatedSamples = 0;
+    auto medianBucket = firstBucket;
+    for (; medianBucket < histogramBucketCount - 1u; medianBucket++) {
+        accumulatedSamples += histogram[medianBucket].load(std::memory_order_relaxed);
+        if (accumulatedSamples >= medianSamples) {
+            break;
+        }
+    }
+
+    auto predictedWaitTime = getBucketRepresentativeTime(medianBucket);
+    if (predictedWaitTime <= timeElapsedSinceWaitStarted) {
+        // Already past bucket midpoint, expect completion halfway to bucket end
+        auto bucketEndTime = static_cast<int64_t>(2ull << medianBucket);
+        predictedWaitTime = (timeElapsedSinceWaitStarted + bucketEndTime) / 2;
+    }
+    return std::max(predictedWaitTime - timeElapsedSinceWaitStarted, int64_t{0});
+}
+
+bool AdaptiveWaitPolicy::wait(volatile TagAddressType *pollAddress, TaskCountType expectedValue, int64_t timeElapsedSinceWaitStarted) {
+    auto predictedRemainingTime = predictRemainingTime(timeElapsedSinceWaitStarted);
+    auto waitPhase = predictedRemainingTime == unknownRemainingTime ? WaitPhase::spin : selectWaitPhase(predictedRemainingTime);
+    auto waitStartCycles = CpuIntrinsics::rdtsc();
+
+    if (predictedRemainingTime == unknownRemainingTime) {
+        waitFunction(pollAddress, expectedValue, timeElapsedSinceWaitStarted);
+    } else if (waitPhase == WaitPhase::spin) {
+        CpuIntrinsics::pause();
+    } else if (waitPhase == WaitPhase::monitorWait) {
+        if (waitpkgUse == WaitpkgUse::umonitorAndUmwait) {
+            monitorWait(pollAddress);
+        } else if (waitpkgUse == WaitpkgUse::tpause) {
+            tpause();
+        } else {
+            CpuIntrinsics::pause();
+            std::this_thread::yield();
+        }
+    } else {
+        auto sleepTime = std::clamp(predictedRemainingTime / 2, int64_t{1}, maxSleepInMicroSeconds);
+        NEO::sleep(std::chrono::microseconds(sleepTime));
+    }
+
+    auto phaseIndex = static_cast<uint32_t>(waitPhase);
+    waitIterations[phaseIndex].fetch_add(1, std::memory_order_relaxed);
+    waitCycles[phaseIndex].fetch_add(CpuIntrinsics::rdtsc() - waitStartCycles, std::memory_order_relaxed);
+
+    return *pollAddress >= expectedValue;
+}
+
+WaitStatistics AdaptiveWaitPolicy::getWaitStatistics() const {
+    WaitStatistics statistics;
+    for (uint32_t i = 0; i < static_cast<uint32_t>(WaitPhase::count); i++) {
+        statistics.waitIterations[i] = waitIterations[i].load(std::memory_order_relaxed);
+        statistics.waitCycles[i] = waitCycles[i].load(std::memory_order_relaxed);
+    }
+    statistics.completedWaits = completedWaits.load(std::memory_order_relaxed);
+    return statistics;
+}
+
 } // namespace WaitUtils
 
 } // namespace NEO
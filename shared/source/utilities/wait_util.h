@@ -9,6 +9,8 @@
 #include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/utilities/cpuintrinsics.h"
 
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <functional>
 #include <thread>
@@ -83,6 +85,49 @@ inline bool waitFunction(volatile TagAddressType *pollAddress, TaskCountType exp
     return waitFunctionWithPredicate<TaskCountType>(pollAddress, expectedValue, std::greater_equal<TaskCountType>(), timeElapsedSinceWaitStarted);
 }
 
+enum class WaitPhase : uint32_t {
+    spin = 0,
+    monitorWait,
+    sleep,
+    count
+};
+
+struct WaitStatistics {
+    std::array<uint64_t, static_cast<uint32_t>(WaitPhase::count)> waitIterations{};
+    std::array<uint64_t, static_cast<uint32_t>(WaitPhase::count)> waitCycles{};
+    uint64_t completedWaits = 0;
+};
+
+// Learns completion latency of a single engine and picks the cheapest wait phase for predicted remaining time
+class AdaptiveWaitPolicy {
+  public:
+    static constexpr uint32_t histogramBucketCount = 24u;
+    static constexpr uint64_t minSamplesForPrediction = 8u;
+    static constexpr uint64_t maxSamplesBeforeDecay = 1024u;
+    static constexpr int64_t unknownRemainingTime = -1;
+    static constexpr int64_t spinPhaseThresholdInMicroSeconds = 10;
+    static constexpr int64_t monitorWaitPhaseThresholdInMicroSeconds = 200;
+    static constexpr int64_t maxSleepInMicroSeconds = 1000;
+
+    static uint32_t getBucketIndex(int64_t timeInMicroSeconds);
+    static int64_t getBucketRepresentativeTime(uint32_t bucketIndex);
+    static WaitPhase selectWaitPhase(int64_t predictedRemainingTime);
+
+    void recordCompletion(int64_t waitTimeInMicroSeconds);
+    int64_t predictRemainingTime(int64_t timeElapsedSinceWaitStarted) const;
+    bool wait(volatile TagAddressType *pollAddress, TaskCountType expectedValue, int64_t timeElapsedSinceWaitStarted);
+
+    uint64_t getSampleCount() const { return sampleCount.load(std::memory_order_relaxed); }
+    WaitStatistics getWaitStatistics() const;
+
+  protected:
+    std::array<std::atomic<uint64_t>, histogramBucketCount> histogram{};
+    std::array<std::atomic<uint64_t>, static_cast<uint32_t>(WaitPhase::count)> waitIterations{};
+    std::array<std::atomic<uint64_t>, static_cast<uint32_t>(WaitPhase::count)> waitCycles{};
+    std::atomic<uint64_t> sampleCount{0};
+    std::atomic<uint64_t> completedWaits{0};
+};
+
 void init(WaitpkgUse inputWaitpkgUse, const HardwareInfo &hwInfo);
 void overrideWaitpkgParams();
 void adjustWaitpkgParamsForUllsLight();
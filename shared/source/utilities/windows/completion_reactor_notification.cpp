@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/completion_reactor.h"
+
+namespace NEO {
+
+int CompletionReactor::createNotificationFd() {
+    return CompletionWatch::invalidNotificationFd;
+}
+
+void CompletionReactor::signalNotificationFd(int notificationFd) {
+}
+
+int CompletionReactor::duplicateNotificationFd(int notificationFd) {
+    return CompletionWatch::invalidNotificationFd;
+}
+
+void CompletionReactor::closeNotificationFd(int notificationFd) {
+}
+
+} // namespace NEO
@@ -0,0 +1,37 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/os_interface/windows/sys_calls.h"
+#include "shared/source/utilities/local_work_size_autotuner.h"
+
+namespace NEO {
+
+UnifiedHandle LocalWorkSizeAutotuner::lockCacheFile() {
+    auto lockFilePath = cacheFileName + ".lock";
+    auto handle = SysCalls::createFileA(lockFilePath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return static_cast<void *>(INVALID_HANDLE_VALUE);
+    }
+    OVERLAPPED overlapped = {0};
+    if (!SysCalls::lockFileEx(handle, LOCKFILE_EXCLUSIVE_LOCK, 0, MAXDWORD, MAXDWORD, &overlapped)) {
+        SysCalls::closeHandle(handle);
+        return static_cast<void *>(INVALID_HANDLE_VALUE);
+    }
+    return static_cast<void *>(handle);
+}
+
+void LocalWorkSizeAutotuner::unlockCacheFile(UnifiedHandle lockHandle) {
+    auto handle = std::get<void *>(lockHandle);
+    if (handle == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    OVERLAPPED overlapped = {0};
+    SysCalls::unlockFileEx(handle, 0, MAXDWORD, MAXDWORD, &overlapped);
+    SysCalls::closeHandle(handle);
+}
+
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2025 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -22,6 +22,7 @@ template <>
 struct WhiteBox<NEO::LinkerInput> : NEO::LinkerInput {
     using BaseClass = NEO::LinkerInput;
 
+    using BaseClass::addExtFuncSymbol;
     using BaseClass::dataRelocations;
     using BaseClass::exportedFunctionsSegmentId;
     using BaseClass::extFuncSymbols;
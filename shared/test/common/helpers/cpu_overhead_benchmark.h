@@ -0,0 +1,67 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/test/common/helpers/memory_management.h"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace NEO {
+
+struct CpuOverheadResult {
+    uint64_t nsPerCall = 0;
+    double allocationsPerCall = 0.0;
+    double csrOwnershipsPerCall = 0.0;
+};
+
+// Measures CPU cost of a single API sequence executed on top of ULT mocks.
+// Results are attached to the current test as properties, so they are part of --gtest_output=json reports.
+// Only ownerships of command stream receivers reported by the caller are counted; other driver mutexes
+// (e.g. SVM and host pointer managers, builtins, programs) are not instrumented.
+class CpuOverheadBenchmark {
+  public:
+    static constexpr uint32_t defaultWarmupIterations = 16u;
+    static constexpr uint32_t defaultIterations = 1000u;
+
+    template <typename OwnershipsCountT, typename SequenceT>
+    static CpuOverheadResult measure(OwnershipsCountT &&getCsrOwnershipsCount, SequenceT &&sequence, uint32_t iterations = defaultIterations) {
+        for (uint32_t i = 0; i < defaultWarmupIterations; i++) {
+            sequence();
+        }
+
+        const uint64_t ownershipsBefore = getCsrOwnershipsCount();
+        MemoryManagement::allocationsCount = 0;
+        MemoryManagement::countAllocations = true;
+        const auto start = std::chrono::steady_clock::now();
+
+        for (uint32_t i = 0; i < iterations; i++) {
+            sequence();
+        }
+
+        const auto end = std::chrono::steady_clock::now();
+        MemoryManagement::countAllocations = false;
+        const uint64_t ownershipsAfter = getCsrOwnershipsCount();
+
+        CpuOverheadResult result{};
+        result.nsPerCall = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()) / iterations;
+        result.allocationsPerCall = static_cast<double>(MemoryManagement::allocationsCount.load()) / iterations;
+        result.csrOwnershipsPerCall = static_cast<double>(ownershipsAfter - ownershipsBefore) / iterations;
+        return result;
+    }
+
+    static void record(const CpuOverheadResult &result) {
+        ::testing::Test::RecordProperty("nsPerCall", std::to_string(result.nsPerCall));
+        ::testing::Test::RecordProperty("allocationsPerCall", std::to_string(result.allocationsPerCall));
+        ::testing::Test::RecordProperty("csrOwnershipsPerCall", std::to_string(result.csrOwnershipsPerCall));
+    }
+};
+
+} // namespace NEO
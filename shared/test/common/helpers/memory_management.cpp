@@ -44,6 +44,8 @@ std::atomic<size_t> indexAllocation(0);
 std::atomic<size_t> indexDeallocation(0);
 bool logTraces = false;
 bool fastLeakDetectionEnabled = false;
+bool countAllocations = false;
+std::atomic<size_t> allocationsCount(0);
 
 AllocationEvent eventsAllocated[maxEvents];
 AllocationEvent eventsDeallocated[maxEvents];
@@ -92,6 +94,10 @@ template <AllocationEvent::EventType typeValid, AllocationEvent::EventType typeF
 static void *allocate(size_t size) {
     onAllocationEvent();
 
+    if (countAllocations) {
+        allocationsCount++;
+    }
+
     if (size > maxAllowedAllocationSize) {
         return nullptr;
     }
@@ -145,6 +151,10 @@ template <AllocationEvent::EventType typeValid, AllocationEvent::EventType typeF
 static void *allocate(size_t size, const std::nothrow_t &) {
     onAllocationEvent();
 
+    if (countAllocations) {
+        allocationsCount++;
+    }
+
     if (size > maxAllowedAllocationSize) {
         return nullptr;
     }
@@ -73,6 +73,8 @@ extern size_t breakOnDeallocationEvent;
 extern bool logTraces;
 extern bool detailedAllocationLoggingActive;
 extern bool fastLeakDetectionEnabled;
+extern bool countAllocations;
+extern std::atomic<size_t> allocationsCount;
 extern void (*deleteCallback)(void *);
 
 inline constexpr auto nonfailingAllocation = static_cast<size_t>(-1);
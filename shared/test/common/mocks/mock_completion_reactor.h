@@ -0,0 +1,35 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/utilities/completion_reactor.h"
+
+namespace NEO {
+class MockCompletionReactor : public CompletionReactor {
+  public:
+    using CompletionReactor::drainTimeout;
+    using CompletionReactor::gpuHangCheckPeriod;
+    using CompletionReactor::idleIterations;
+    using CompletionReactor::pollingBackoff;
+    using CompletionReactor::processWatches;
+    using CompletionReactor::registerList;
+    using CompletionReactor::thread;
+    using CompletionReactor::transferRegisterList;
+    using CompletionReactor::waitForProgress;
+    using CompletionReactor::watches;
+
+    void openThread() override {
+        openThreadCalled++;
+        if (callBaseOpenThread) {
+            CompletionReactor::openThread();
+        }
+    }
+
+    uint32_t openThreadCalled = 0;
+    bool callBaseOpenThread = false;
+};
+} // namespace NEO
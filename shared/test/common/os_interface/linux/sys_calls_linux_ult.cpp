@@ -68,6 +68,8 @@ int readdirCalled = 0;
 int closedirCalled = 0;
 int pidfdopenCalled = 0;
 int pidfdgetfdCalled = 0;
+int eventfdCalled = 0;
+int dupCalled = 0;
 int fsyncCalled = 0;
 int fsyncArgPassed = 0;
 int fsyncRetVal = 0;
@@ -116,6 +118,8 @@ int (*sysCallsClosedir)(DIR *dir) = nullptr;
 int (*sysCallsGetDevicePath)(int deviceFd, char *buf, size_t &bufSize) = nullptr;
 int (*sysCallsPidfdOpen)(pid_t pid, unsigned int flags) = nullptr;
 int (*sysCallsPidfdGetfd)(int pidfd, int fd, unsigned int flags) = nullptr;
+int (*sysCallsEventfd)(unsigned int initval, int flags) = nullptr;
+int (*sysCallsDup)(int oldfd) = nullptr;
 off_t lseekReturn = 4096u;
 std::atomic<int> lseekCalledCount(0);
 long sysconfReturn = 1ull << 30;
@@ -556,5 +560,21 @@ int pidfdgetfd(int pid, int targetfd, unsigned int flags) {
     return 0;
 }
 
+int eventfd(unsigned int initval, int flags) {
+    eventfdCalled++;
+    if (sysCallsEventfd != nullptr) {
+        return sysCallsEventfd(initval, flags);
+    }
+    return -1;
+}
+
+int dup(int oldfd) {
+    dupCalled++;
+    if (sysCallsDup != nullptr) {
+        return sysCallsDup(oldfd);
+    }
+    return -1;
+}
+
 } // namespace SysCalls
 } // namespace NEO
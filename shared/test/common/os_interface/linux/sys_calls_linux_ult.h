@@ -52,6 +52,8 @@ extern int (*sysCallsGetDevicePath)(int deviceFd, char *buf, size_t &bufSize);
 extern int (*sysCallsClose)(int fileDescriptor);
 extern int (*sysCallsPidfdOpen)(pid_t pid, unsigned int flags);
 extern int (*sysCallsPidfdGetfd)(int pidfd, int fd, unsigned int flags);
+extern int (*sysCallsEventfd)(unsigned int initval, int flags);
+extern int (*sysCallsDup)(int oldfd);
 
 extern bool allowFakeDevicePath;
 extern int flockRetVal;
@@ -88,6 +90,8 @@ extern bool failAccess;
 extern int setErrno;
 extern int pidfdopenCalled;
 extern int pidfdgetfdCalled;
+extern int eventfdCalled;
+extern int dupCalled;
 
 extern std::vector<void *> mmapVector;
 extern std::vector<void *> mmapCapturedExtendedPointers;
@@ -311,6 +311,68 @@ HWTEST_F(CommandEncoderTests, givenInOrderExecutionInfoWhenSetLastCounterValueIs
     EXPECT_FALSE(inOrderExecInfo->isCounterAlreadyDone(1));
 }
 
+HWTEST_F(CommandEncoderTests, givenInOrderExecInfoWhenCounterIsReinitializedThenNewTimelineIdIsAssigned) {
+    MockDevice mockDevice;
+
+    MockTagAllocator<DeviceAllocNodeType<true>> tagAllocator(0, mockDevice.getMemoryManager());
+    auto node = tagAllocator.getTag();
+
+    auto inOrderExecInfo = std::make_unique<InOrderExecInfo>(node, nullptr, mockDevice, 1, false, false);
+    auto timelineId = inOrderExecInfo->getTimelineId();
+    EXPECT_NE(0u, timelineId);
+
+    inOrderExecInfo->addCounterValue(1);
+    EXPECT_EQ(timelineId, inOrderExecInfo->getTimelineId());
+
+    inOrderExecInfo->reset();
+    EXPECT_NE(timelineId, inOrderExecInfo->getTimelineId());
+    timelineId = inOrderExecInfo->getTimelineId();
+
+    inOrderExecInfo->initializeAllocationsFromHost();
+    EXPECT_NE(timelineId, inOrderExecInfo->getTimelineId());
+}
+
+TEST(InOrderSatisfiedCountersTest, givenMarkedCounterWhenCheckingIfWaitIsSatisfiedThenOnlyLowerOrEqualValuesOnSameTimelineAndOffsetAreSatisfied) {
+    InOrderSatisfiedCounters satisfiedCounters;
+    EXPECT_FALSE(satisfiedCounters.isSatisfied(1u, 0u, 1u));
+
+    satisfiedCounters.markSatisfied(1u, 0u, 5u);
+    satisfiedCounters.markSatisfied(1u, 0u, 3u);
+
+    EXPECT_TRUE(satisfiedCounters.isSatisfied(1u, 0u, 5u));
+    EXPECT_TRUE(satisfiedCounters.isSatisfied(1u, 0u, 2u));
+    EXPECT_FALSE(satisfiedCounters.isSatisfied(1u, 0u, 6u));
+    EXPECT_FALSE(satisfiedCounters.isSatisfied(1u, 8u, 1u));
+    EXPECT_FALSE(satisfiedCounters.isSatisfied(2u, 0u, 1u));
+    EXPECT_EQ(2u, satisfiedCounters.getElidedWaitsCount());
+}
+
+TEST(InOrderSatisfiedCountersTest, givenMaxEntriesMarkedWhenMarkingNewTimelineThenOldestEntryIsEvicted) {
+    InOrderSatisfiedCounters satisfiedCounters;
+
+    for (uint64_t timelineId = 1; timelineId <= InOrderSatisfiedCounters::maxEntries + 1; timelineId++) {
+        satisfiedCounters.markSatisfied(timelineId, 0u, 1u);
+    }
+
+    EXPECT_FALSE(satisfiedCounters.isSatisfied(1u, 0u, 1u));
+    EXPECT_TRUE(satisfiedCounters.isSatisfied(2u, 0u, 1u));
+    EXPECT_TRUE(satisfiedCounters.isSatisfied(InOrderSatisfiedCounters::maxEntries + 1, 0u, 1u));
+}
+
+TEST(InOrderSatisfiedCountersTest, givenInOrderSemaphoreWaitElisionFlagWhenCreatingCsrThenSatisfiedCountersAreCreatedOnlyWhenEnabled) {
+    DebugManagerStateRestore restorer;
+    {
+        MockDevice mockDevice;
+        EXPECT_EQ(nullptr, mockDevice.getDefaultEngine().commandStreamReceiver->getInOrderSatisfiedCounters());
+    }
+
+    debugManager.flags.EnableInOrderSemaphoreWaitElision.set(1);
+    {
+        MockDevice mockDevice;
+        EXPECT_NE(nullptr, mockDevice.getDefaultEngine().commandStreamReceiver->getInOrderSatisfiedCounters());
+    }
+}
+
 HWTEST_F(CommandEncoderTests, givenInOrderExecutionInfoWhenResetCalledThenUploadToTbx) {
     MockDevice mockDevice;
     auto &csr = mockDevice.getUltCommandStreamReceiver<FamilyType>();
@@ -30,6 +30,7 @@
 #include "shared/source/os_interface/os_thread.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/utilities/tag_allocator.h"
+#include "shared/source/utilities/wait_util.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
 #include "shared/test/common/cmd_parse/hw_parse.h"
 #include "shared/test/common/fixtures/command_stream_receiver_fixture.inl"
@@ -2586,6 +2587,24 @@ HWTEST_F(CommandStreamReceiverTest, givenAubCsrWhenLogWaitingForCompletionEnable
     EXPECT_EQ(std::string::npos, output.find(notExpectedOutput));
 }
 
+TEST_F(CommandStreamReceiverTest, givenAdaptiveWaitPolicyDisabledWhenCreatingCsrThenPolicyIsNotCreated) {
+    EXPECT_EQ(nullptr, commandStreamReceiver->getAdaptiveWaitPolicy());
+}
+
+TEST_F(CommandStreamReceiverTest, givenAdaptiveWaitPolicyEnabledWhenWaitIsCompletedThenCompletionLatencyIsRecorded) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableAdaptiveWaitPolicy.set(1);
+
+    MockCommandStreamReceiver csr(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    auto waitPolicy = csr.getAdaptiveWaitPolicy();
+    ASSERT_NE(nullptr, waitPolicy);
+    EXPECT_EQ(0u, waitPolicy->getSampleCount());
+
+    EXPECT_EQ(WaitStatus::ready, csr.baseWaitFunction(csr.getTagAddress(), WaitParams{false, false, false, 0}, 0));
+    EXPECT_EQ(1u, waitPolicy->getSampleCount());
+    EXPECT_EQ(1u, waitPolicy->getWaitStatistics().completedWaits);
+}
+
 TEST_F(CommandStreamReceiverTest, givenPreambleFlagIsSetWhenGettingFlagStateThenExpectCorrectState) {
     EXPECT_FALSE(commandStreamReceiver->getPreambleSetFlag());
     commandStreamReceiver->setPreambleSetFlag(true);
@@ -57,6 +57,21 @@ TEST(LinearStreamSimpleTest, givenLinearStreamWithGraphicsAllocationWhenGettingG
     EXPECT_EQ(canonizedGpuAddress, linearStream.getGpuBase());
 }
 
+TEST(LinearStreamSimpleTest, givenLinearStreamsWhenReplacingBufferThenBufferIdIsUnique) {
+    uint32_t pCmdBuffer[1024]{};
+    LinearStream linearStream(pCmdBuffer, 1000);
+    LinearStream otherLinearStream(pCmdBuffer, 1000);
+    EXPECT_NE(linearStream.getBufferId(), otherLinearStream.getBufferId());
+
+    auto bufferId = linearStream.getBufferId();
+    linearStream.getSpace(4);
+    EXPECT_EQ(bufferId, linearStream.getBufferId());
+
+    linearStream.replaceBuffer(pCmdBuffer, 1000);
+    EXPECT_NE(bufferId, linearStream.getBufferId());
+    EXPECT_NE(otherLinearStream.getBufferId(), linearStream.getBufferId());
+}
+
 TEST_F(LinearStreamTest, GivenSizeZeroWhenGettingSpaceUsedThenNonNullPointerIsReturned) {
     EXPECT_NE(nullptr, linearStream.getSpace(0));
 }
@@ -722,12 +722,10 @@ TEST_F(LinkerTests, GivenRelocationToInstructionSegmentWithLocalUndefinedSymbolW
 TEST(LinkerInputTests, GivenInvalidFunctionsSymbolsUsedInFunctionsRelocationsWhenParsingRelocationsForExtFuncUsageThenDoNotAddDependency) {
     WhiteBox<NEO::LinkerInput> mockLinkerInput;
 
-    auto &extFuncSymbols = mockLinkerInput.extFuncSymbols;
-    extFuncSymbols.resize(1);
-    auto &funSym = extFuncSymbols[0];
-    funSym.first = "fun";
-    funSym.second.offset = 4U;
-    funSym.second.size = 4U;
+    NEO::SymbolInfo funSym;
+    funSym.offset = 4U;
+    funSym.size = 4U;
+    mockLinkerInput.addExtFuncSymbol("fun", funSym);
 
     NEO::LinkerInput::RelocationInfo relocInfo;
     relocInfo.symbolName = "fun";
@@ -741,6 +739,58 @@ TEST(LinkerInputTests, GivenInvalidFunctionsSymbolsUsedInFunctionsRelocationsWhe
     EXPECT_TRUE(mockLinkerInput.extFunDependencies.empty());
 }
 
+TEST(LinkerInputTests, GivenManyFunctionsSymbolsWhenParsingRelocationsForExtFuncUsageThenCallerIsFoundByOffset) {
+    WhiteBox<NEO::LinkerInput> mockLinkerInput;
+
+    constexpr uint32_t numFunctions = 64U;
+    for (uint32_t i = numFunctions; i > 0; i--) {
+        NEO::SymbolInfo funSym;
+        funSym.offset = (i - 1) * 0x10U;
+        funSym.size = 0x10U;
+        mockLinkerInput.addExtFuncSymbol("fun" + std::to_string(i - 1), funSym);
+    }
+    NEO::SymbolInfo emptySym;
+    emptySym.offset = 0x20U;
+    emptySym.size = 0U;
+    mockLinkerInput.addExtFuncSymbol("empty", emptySym);
+
+    NEO::LinkerInput::RelocationInfo relocInfo;
+    relocInfo.symbolName = "fun7";
+    relocInfo.offset = 0x28U;
+    mockLinkerInput.parseRelocationForExtFuncUsage(relocInfo, NEO::Zebin::Elf::SectionNames::externalFunctions.str());
+    ASSERT_EQ(1U, mockLinkerInput.extFunDependencies.size());
+    EXPECT_EQ("fun7", mockLinkerInput.extFunDependencies[0].usedFuncName);
+    EXPECT_EQ("fun2", mockLinkerInput.extFunDependencies[0].callerFuncName);
+
+    relocInfo.offset = numFunctions * 0x10U;
+    mockLinkerInput.parseRelocationForExtFuncUsage(relocInfo, NEO::Zebin::Elf::SectionNames::externalFunctions.str());
+    EXPECT_EQ(1U, mockLinkerInput.extFunDependencies.size());
+
+    relocInfo.symbolName = "notAFunction";
+    relocInfo.offset = 0x28U;
+    mockLinkerInput.parseRelocationForExtFuncUsage(relocInfo, NEO::Zebin::Elf::SectionNames::externalFunctions.str());
+    mockLinkerInput.parseRelocationForExtFuncUsage(relocInfo, "kernel");
+    EXPECT_EQ(1U, mockLinkerInput.extFunDependencies.size());
+    EXPECT_TRUE(mockLinkerInput.kernelDependencies.empty());
+
+    relocInfo.symbolName = "fun0";
+    mockLinkerInput.parseRelocationForExtFuncUsage(relocInfo, "kernel");
+    ASSERT_EQ(1U, mockLinkerInput.kernelDependencies.size());
+    EXPECT_EQ("fun0", mockLinkerInput.kernelDependencies[0].usedFuncName);
+    EXPECT_EQ("kernel", mockLinkerInput.kernelDependencies[0].kernelName);
+}
+
+TEST(LinkerInputTests, GivenTextRelocationsWhenCheckingForRelocationsInInstructionSegmentThenReturnTrueOnlyForSegmentsWithRelocations) {
+    WhiteBox<NEO::LinkerInput> mockLinkerInput;
+    EXPECT_FALSE(mockLinkerInput.hasRelocationsInInstructionSegment(0U));
+
+    mockLinkerInput.textRelocations.resize(2);
+    mockLinkerInput.textRelocations[1].push_back({"A", 8U, NEO::LinkerInput::RelocationInfo::Type::address});
+    EXPECT_FALSE(mockLinkerInput.hasRelocationsInInstructionSegment(0U));
+    EXPECT_TRUE(mockLinkerInput.hasRelocationsInInstructionSegment(1U));
+    EXPECT_FALSE(mockLinkerInput.hasRelocationsInInstructionSegment(2U));
+}
+
 HWTEST_F(LinkerTests, givenEmptyLinkerInputThenLinkerOutputIsEmpty) {
     NEO::LinkerInput linkerInput;
     NEO::Linker linker(linkerInput);
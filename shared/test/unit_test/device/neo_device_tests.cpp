@@ -2465,3 +2465,113 @@ TEST(GroupDevicesTest, givenNullInputInDeviceVectorWhenGroupDevicesThenEmptyVect
 
     EXPECT_TRUE(groupedDevices.empty());
 }
+
+TEST_F(DeviceTests, givenLazyDeviceInitializationAndMidThreadPreemptionWhenDeviceIsCreatedThenSipKernelIsInitializedAndPreemptionAllocationSizeIsNotChanged) {
+    VariableBackup<bool> mockSipBackup(&MockSipData::useMockSip, true);
+    VariableBackup<bool> mockSipCalledBackup(&MockSipData::called, false);
+    VariableBackup<SipClassType> sipClassTypeBackup(&SipKernel::classType);
+    DebugManagerStateRestore dbgRestorer;
+    debugManager.flags.ForcePreemptionMode.set(static_cast<int32_t>(PreemptionMode::MidThread));
+    debugManager.flags.ForceSipClass.set(static_cast<int32_t>(SipClassType::builtins));
+
+    debugManager.flags.EnableLazyDeviceInitialization.set(0);
+    auto eagerDevice = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    if (!eagerDevice->isStateSipRequired()) {
+        GTEST_SKIP();
+    }
+    auto eagerPreemptionAllocation = eagerDevice->getDefaultEngine().commandStreamReceiver->getPreemptionAllocation();
+    ASSERT_NE(nullptr, eagerPreemptionAllocation);
+
+    MockSipData::called = false;
+    debugManager.flags.EnableLazyDeviceInitialization.set(1);
+    auto lazyDevice = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    EXPECT_TRUE(MockSipData::called);
+
+    auto lazyPreemptionAllocation = lazyDevice->getDefaultEngine().commandStreamReceiver->getPreemptionAllocation();
+    ASSERT_NE(nullptr, lazyPreemptionAllocation);
+    EXPECT_EQ(eagerPreemptionAllocation->getUnderlyingBufferSize(), lazyPreemptionAllocation->getUnderlyingBufferSize());
+}
+
+HWTEST_F(DeviceTests, givenLazyDeviceInitializationAndContextGroupWhenDeviceIsCreatedThenOnlyDefaultEngineIsInitialized) {
+    DebugManagerStateRestore dbgRestorer;
+    debugManager.flags.ContextGroupSize.set(8);
+    debugManager.flags.EnableLazyDeviceInitialization.set(1);
+
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.featureTable.flags.ftrCCSNode = true;
+    hwInfo.featureTable.ftrBcsInfo = 0;
+    hwInfo.capabilityTable.defaultEngineType = aub_stream::ENGINE_CCS;
+    hwInfo.gtSystemInfo.CCSInfo.NumberOfCCSEnabled = 4;
+
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo));
+
+    uint32_t deferredEnginesCount = 0;
+    for (auto &engine : device->getAllEngines()) {
+        if (engine.osContext->getIsDefaultEngine() || !engine.osContext->isPartOfContextGroup()) {
+            continue;
+        }
+        auto csr = static_cast<UltCommandStreamReceiver<FamilyType> *>(engine.commandStreamReceiver);
+        EXPECT_FALSE(csr->isInitialized());
+        EXPECT_EQ(0u, csr->initializeDeviceWithFirstSubmissionCalled);
+        deferredEnginesCount++;
+    }
+    if (deferredEnginesCount == 0) {
+        GTEST_SKIP();
+    }
+    EXPECT_TRUE(device->getDefaultEngine().commandStreamReceiver->isInitialized());
+}
+
+HWTEST_F(DeviceTests, givenLazyDeviceInitializationWhenSecondaryEngineIsRequestedThenItsPrimaryEngineIsInitializedFirst) {
+    DebugManagerStateRestore dbgRestorer;
+    debugManager.flags.ContextGroupSize.set(8);
+    debugManager.flags.EnableLazyDeviceInitialization.set(1);
+
+    HardwareInfo hwInfo = *defaultHwInfo;
+    hwInfo.featureTable.flags.ftrCCSNode = true;
+    hwInfo.featureTable.ftrBcsInfo = 0;
+    hwInfo.capabilityTable.defaultEngineType = aub_stream::ENGINE_CCS;
+    hwInfo.gtSystemInfo.CCSInfo.NumberOfCCSEnabled = 2;
+
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(&hwInfo));
+    if (device->secondaryEngines.find(aub_stream::ENGINE_CCS1) == device->secondaryEngines.end()) {
+        GTEST_SKIP();
+    }
+
+    auto primaryCsr = device->secondaryEngines[aub_stream::ENGINE_CCS1].engines[0].commandStreamReceiver;
+    EXPECT_FALSE(primaryCsr->isInitialized());
+
+    auto secondaryEngine = device->getSecondaryEngineCsr({aub_stream::ENGINE_CCS1, EngineUsage::highPriority}, false);
+    ASSERT_NE(nullptr, secondaryEngine);
+    EXPECT_NE(primaryCsr, secondaryEngine->commandStreamReceiver);
+    EXPECT_EQ(primaryCsr, secondaryEngine->commandStreamReceiver->getPrimaryCsr());
+    EXPECT_TRUE(primaryCsr->isInitialized());
+    EXPECT_TRUE(secondaryEngine->commandStreamReceiver->isInitialized());
+}
+
+TEST_F(DeviceTests, givenLazyDeviceInitializationWhenCheckingStateInitSubmissionThenItIsDeferred) {
+    DebugManagerStateRestore dbgRestorer;
+    EXPECT_FALSE(Device::isStateInitSubmissionDeferred());
+
+    debugManager.flags.EnableLazyDeviceInitialization.set(1);
+    EXPECT_TRUE(Device::isLazyInitializationEnabled());
+    EXPECT_TRUE(Device::isStateInitSubmissionDeferred());
+
+    debugManager.flags.EnableLazyDeviceInitialization.set(0);
+    debugManager.flags.DeferStateInitSubmissionToFirstRegularUsage.set(1);
+    EXPECT_FALSE(Device::isLazyInitializationEnabled());
+    EXPECT_TRUE(Device::isStateInitSubmissionDeferred());
+}
+
+TEST_F(DeviceTests, givenPrintDeviceInitializationTimesWhenDeviceIsCreatedThenTimeOfEachPhaseIsPrinted) {
+    DebugManagerStateRestore dbgRestorer;
+    debugManager.flags.PrintDeviceInitializationTimes.set(true);
+
+    testing::internal::CaptureStdout();
+    auto device = std::unique_ptr<MockDevice>(MockDevice::createWithNewExecutionEnvironment<MockDevice>(defaultHwInfo.get()));
+    auto output = testing::internal::GetCapturedStdout();
+
+    EXPECT_NE(std::string::npos, output.find("Device initialization, root device 0"));
+    EXPECT_NE(std::string::npos, output.find("common resources"));
+    EXPECT_NE(std::string::npos, output.find("engines creation"));
+    EXPECT_NE(std::string::npos, output.find("engines initialization"));
+}
@@ -0,0 +1,264 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/strided_copy.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/variable_backup.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+uint32_t nonTemporalRowCopiesCount = 0;
+
+void countingCopyRowNonTemporal(void *dst, const void *src, size_t size) {
+    nonTemporalRowCopiesCount++;
+    memcpy(dst, src, size);
+}
+
+std::vector<uint8_t> createPattern(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t i = 0; i < size; i++) {
+        data[i] = static_cast<uint8_t>(i * 7 + i / 251);
+    }
+    return data;
+}
+} // namespace
+
+TEST(StridedCopyTest, givenVariousRegionsWhenCheckingIsContiguousThenOnlyRegionsWithoutGapsAreContiguous) {
+    StridedCopyRegion region{};
+    region.rowSize = 16;
+    region.dstRowPitch = 32;
+    region.srcRowPitch = 64;
+    EXPECT_TRUE(StridedCopy::isContiguous(region));
+
+    region.rowCount = 4;
+    EXPECT_FALSE(StridedCopy::isContiguous(region));
+
+    region.dstRowPitch = 16;
+    region.srcRowPitch = 16;
+    EXPECT_TRUE(StridedCopy::isContiguous(region));
+
+    region.sliceCount = 2;
+    region.dstSlicePitch = 64;
+    region.srcSlicePitch = 128;
+    EXPECT_FALSE(StridedCopy::isContiguous(region));
+
+    region.srcSlicePitch = 64;
+    EXPECT_TRUE(StridedCopy::isContiguous(region));
+}
+
+TEST(StridedCopyTest, givenCopySizeWhenGettingWorkersCountThenItIsLimitedBySizeAndMaxWorkersCount) {
+    DebugManagerStateRestore restorer;
+    auto maxWorkersCount = std::min(StridedCopy::defaultMaxWorkersCount, std::max(1u, std::thread::hardware_concurrency()));
+
+    EXPECT_EQ(1u, StridedCopy::getWorkersCount(0));
+    EXPECT_EQ(1u, StridedCopy::getWorkersCount(StridedCopy::minSizePerWorker));
+    EXPECT_EQ(std::min(2u, maxWorkersCount), StridedCopy::getWorkersCount(2 * StridedCopy::minSizePerWorker));
+    EXPECT_EQ(maxWorkersCount, StridedCopy::getWorkersCount(100 * StridedCopy::minSizePerWorker));
+
+    debugManager.flags.CpuCopyMaxWorkersCount.set(1);
+    EXPECT_EQ(1u, StridedCopy::getWorkersCount(100 * StridedCopy::minSizePerWorker));
+
+    debugManager.flags.CpuCopyMaxWorkersCount.set(0);
+    EXPECT_EQ(1u, StridedCopy::getWorkersCount(100 * StridedCopy::minSizePerWorker));
+}
+
+TEST(StridedCopyTest, givenNonTemporalThresholdDebugFlagWhenGettingThresholdThenFlagValueIsReturned) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(StridedCopy::defaultNonTemporalThreshold, StridedCopy::getNonTemporalThreshold());
+
+    debugManager.flags.CpuCopyNonTemporalThreshold.set(0);
+    EXPECT_EQ(0u, StridedCopy::getNonTemporalThreshold());
+
+    debugManager.flags.CpuCopyNonTemporalThreshold.set(1024);
+    EXPECT_EQ(1024u, StridedCopy::getNonTemporalThreshold());
+}
+
+TEST(StridedCopyTest, givenStridedRegionWhenCopyingThenOnlyRowsAreCopiedAndPaddingIsNotModified) {
+    constexpr size_t rowSize = 24;
+    constexpr size_t srcRowPitch = 40;
+    constexpr size_t dstRowPitch = 32;
+    constexpr size_t rowCount = 3;
+    constexpr size_t sliceCount = 2;
+    constexpr size_t srcSlicePitch = srcRowPitch * rowCount + 8;
+    constexpr size_t dstSlicePitch = dstRowPitch * rowCount;
+
+    auto src = createPattern(srcSlicePitch * sliceCount);
+    std::vector<uint8_t> dst(dstSlicePitch * sliceCount, 0xCD);
+
+    StridedCopyRegion region{};
+    region.dst = dst.data();
+    region.dstRowPitch = dstRowPitch;
+    region.dstSlicePitch = dstSlicePitch;
+    region.src = src.data();
+    region.srcRowPitch = srcRowPitch;
+    region.srcSlicePitch = srcSlicePitch;
+    region.rowSize = rowSize;
+    region.rowCount = rowCount;
+    region.sliceCount = sliceCount;
+    StridedCopy::copyRegion(region);
+
+    for (size_t slice = 0; slice < sliceCount; slice++) {
+        for (size_t row = 0; row < rowCount; row++) {
+            auto dstRow = dst.data() + slice * dstSlicePitch + row * dstRowPitch;
+            auto srcRow = src.data() + slice * srcSlicePitch + row * srcRowPitch;
+            EXPECT_EQ(0, memcmp(dstRow, srcRow, rowSize));
+            for (size_t i = rowSize; i < dstRowPitch; i++) {
+                EXPECT_EQ(0xCD, dstRow[i]);
+            }
+        }
+    }
+}
+
+TEST(StridedCopyTest, givenNonTemporalThresholdWhenCopyingThenNonTemporalRowCopyIsUsedOnlyAboveThreshold) {
+    DebugManagerStateRestore restorer;
+    VariableBackup<decltype(StridedCopy::copyRowNonTemporal)> backupCopyRow(&StridedCopy::copyRowNonTemporal, countingCopyRowNonTemporal);
+    VariableBackup<uint32_t> backupCount(&nonTemporalRowCopiesCount, 0u);
+    debugManager.flags.CpuCopyMaxWorkersCount.set(1);
+
+    auto src = createPattern(256);
+    std::vector<uint8_t> dst(256, 0);
+
+    StridedCopyRegion region{};
+    region.dst = dst.data();
+    region.dstRowPitch = 64;
+    region.src = src.data();
+    region.srcRowPitch = 64;
+    region.rowSize = 32;
+    region.rowCount = 4;
+
+    debugManager.flags.CpuCopyNonTemporalThreshold.set(0);
+    StridedCopy::copyRegion(region);
+    EXPECT_EQ(0u, nonTemporalRowCopiesCount);
+
+    debugManager.flags.CpuCopyNonTemporalThreshold.set(129);
+    StridedCopy::copyRegion(region);
+    EXPECT_EQ(0u, nonTemporalRowCopiesCount);
+
+    debugManager.flags.CpuCopyNonTemporalThreshold.set(128);
+    StridedCopy::copyRegion(region);
+    EXPECT_EQ(4u, nonTemporalRowCopiesCount);
+
+    nonTemporalRowCopiesCount = 0;
+    StridedCopy::copy(dst.data(), src.data(), 256);
+    EXPECT_EQ(1u, nonTemporalRowCopiesCount);
+    EXPECT_EQ(0, memcmp(dst.data(), src.data(), 256));
+}
+
+TEST(StridedCopyTest, givenUnalignedDestinationWhenCopyingRowWithSimdNonTemporalCopyThenAllBytesAreCopied) {
+    auto src = createPattern(1024);
+    std::vector<uint8_t> dst(1024 + 64, 0);
+
+    for (size_t dstOffset : {0u, 1u, 17u, 31u}) {
+        for (size_t size : {0u, 5u, 32u, 127u, 1000u}) {
+            std::fill(dst.begin(), dst.end(), 0);
+            copyRowNonTemporalSimd(dst.data() + dstOffset, src.data() + 3, size);
+
+            EXPECT_EQ(0, memcmp(dst.data() + dstOffset, src.data() + 3, size));
+            EXPECT_TRUE(std::all_of(dst.begin(), dst.begin() + dstOffset, [](uint8_t value) { return value == 0; }));
+            EXPECT_TRUE(std::all_of(dst.begin() + dstOffset + size, dst.end(), [](uint8_t value) { return value == 0; }));
+        }
+    }
+}
+
+TEST(StridedCopyTest, givenLargeRegionAndMultipleWorkersWhenCopyingThenWholeRegionIsCopied) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.CpuCopyMaxWorkersCount.set(3);
+
+    const size_t size = 3 * StridedCopy::minSizePerWorker + 100;
+    auto src = createPattern(size);
+    std::vector<uint8_t> dst(size, 0);
+
+    StridedCopy::copy(dst.data(), src.data(), size);
+    EXPECT_EQ(src, dst);
+
+    std::fill(dst.begin(), dst.end(), 0);
+    StridedCopyRegion region{};
+    region.dst = dst.data();
+    region.dstRowPitch = MemoryConstants::pageSize;
+    region.src = src.data();
+    region.srcRowPitch = MemoryConstants::pageSize;
+    region.rowSize = MemoryConstants::pageSize - 100;
+    region.rowCount = size / MemoryConstants::pageSize;
+    StridedCopy::copyRegion(region);
+
+    for (size_t row = 0; row < region.rowCount; row++) {
+        auto offset = row * MemoryConstants::pageSize;
+        EXPECT_EQ(0, memcmp(dst.data() + offset, src.data() + offset, region.rowSize));
+        EXPECT_EQ(0u, dst[offset + region.rowSize]);
+    }
+}
+
+namespace {
+std::mutex copyingThreadsMtx;
+std::set<std::thread::id> copyingThreads;
+
+void threadRecordingCopyRowNonTemporal(void *dst, const void *src, size_t size) {
+    {
+        std::lock_guard<std::mutex> lock(copyingThreadsMtx);
+        copyingThreads.insert(std::this_thread::get_id());
+    }
+    memcpy(dst, src, size);
+}
+} // namespace
+
+TEST(StridedCopyTest, givenMultipleWorkersWhenCopyingRepeatedlyThenSameWorkerThreadsAreReused) {
+    DebugManagerStateRestore restorer;
+    VariableBackup<decltype(StridedCopy::copyRowNonTemporal)> backupCopyRow(&StridedCopy::copyRowNonTemporal, threadRecordingCopyRowNonTemporal);
+    debugManager.flags.CpuCopyMaxWorkersCount.set(3);
+    debugManager.flags.CpuCopyNonTemporalThreshold.set(1);
+
+    const size_t size = 3 * StridedCopy::minSizePerWorker;
+    const auto workersCount = StridedCopy::getWorkersCount(size);
+    auto src = createPattern(size);
+    std::vector<uint8_t> dst(size, 0);
+    copyingThreads.clear();
+
+    for (uint32_t i = 0; i < 4; i++) {
+        std::fill(dst.begin(), dst.end(), 0);
+        StridedCopy::copy(dst.data(), src.data(), size);
+        EXPECT_EQ(src, dst);
+    }
+
+    EXPECT_EQ(workersCount, copyingThreads.size());
+    EXPECT_EQ(1u, copyingThreads.count(std::this_thread::get_id()));
+}
+
+TEST(StridedCopyTest, givenWorkersShutDownWhenCopyingAgainThenNewWorkerThreadsAreUsed) {
+    DebugManagerStateRestore restorer;
+    VariableBackup<decltype(StridedCopy::copyRowNonTemporal)> backupCopyRow(&StridedCopy::copyRowNonTemporal, threadRecordingCopyRowNonTemporal);
+    debugManager.flags.CpuCopyMaxWorkersCount.set(3);
+    debugManager.flags.CpuCopyNonTemporalThreshold.set(1);
+
+    const size_t size = 3 * StridedCopy::minSizePerWorker;
+    const auto workersCount = StridedCopy::getWorkersCount(size);
+    auto src = createPattern(size);
+    std::vector<uint8_t> dst(size, 0);
+
+    StridedCopy::copy(dst.data(), src.data(), size);
+    EXPECT_EQ(src, dst);
+
+    StridedCopy::shutdownWorkers();
+    StridedCopy::shutdownWorkers();
+
+    copyingThreads.clear();
+    std::fill(dst.begin(), dst.end(), 0);
+    StridedCopy::copy(dst.data(), src.data(), size);
+    EXPECT_EQ(src, dst);
+    EXPECT_EQ(workersCount, copyingThreads.size());
+
+    StridedCopy::shutdownWorkers();
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/wait_list_compaction.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+TEST(WaitListCompactorTest, givenWaitsOnSameTimelineWhenCompactingThenOnlyHighestValueIsRequired) {
+    int owner = 0;
+    WaitListCompactor compactor(4);
+    compactor.addTimelineWait(0, {&owner, 0u}, 5u);
+    compactor.addTimelineWait(1, {&owner, 0u}, 9u);
+    compactor.addTimelineWait(2, {&owner, 0u}, 7u);
+    compactor.compact();
+
+    EXPECT_FALSE(compactor.isRequired(0));
+    EXPECT_TRUE(compactor.isRequired(1));
+    EXPECT_FALSE(compactor.isRequired(2));
+    EXPECT_TRUE(compactor.isRequired(3));
+
+    EXPECT_EQ(4u, compactor.getStats().waits);
+    EXPECT_EQ(2u, compactor.getStats().elidedSuperseded);
+    EXPECT_EQ(0u, compactor.getStats().elidedCompleted);
+}
+
+TEST(WaitListCompactorTest, givenWaitsWithEqualHighestValueWhenCompactingThenAllOfThemAreRequired) {
+    int owner = 0;
+    WaitListCompactor compactor(3);
+    compactor.addTimelineWait(0, {&owner, 0u}, 3u);
+    compactor.addTimelineWait(1, {&owner, 0u}, 3u);
+    compactor.addTimelineWait(2, {&owner, 0u}, 1u);
+    compactor.compact();
+
+    EXPECT_TRUE(compactor.isRequired(0));
+    EXPECT_TRUE(compactor.isRequired(1));
+    EXPECT_FALSE(compactor.isRequired(2));
+    EXPECT_EQ(1u, compactor.getStats().getElided());
+}
+
+TEST(WaitListCompactorTest, givenWaitsOnDifferentTimelinesWhenCompactingThenEachTimelineKeepsItsHighestValue) {
+    int owner0 = 0;
+    int owner1 = 0;
+    WaitListCompactor compactor(4);
+    compactor.addTimelineWait(0, {&owner0, 0u}, 2u);
+    compactor.addTimelineWait(1, {&owner0, 1u}, 1u);
+    compactor.addTimelineWait(2, {&owner1, 0u}, 1u);
+    compactor.addTimelineWait(3, {&owner0, 0u}, 1u);
+    compactor.compact();
+
+    EXPECT_TRUE(compactor.isRequired(0));
+    EXPECT_TRUE(compactor.isRequired(1));
+    EXPECT_TRUE(compactor.isRequired(2));
+    EXPECT_FALSE(compactor.isRequired(3));
+}
+
+TEST(WaitListCompactorTest, givenCompletedWaitWhenCompactingThenItIsNotRequired) {
+    WaitListCompactor compactor(2);
+    compactor.addCompletedWait(1);
+    compactor.compact();
+
+    EXPECT_TRUE(compactor.isRequired(0));
+    EXPECT_FALSE(compactor.isRequired(1));
+    EXPECT_EQ(1u, compactor.getStats().elidedCompleted);
+}
+
+TEST(WaitListCompactorTest, givenPrintWaitListCompactionWhenWaitsAreElidedThenStatsArePrinted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PrintWaitListCompaction.set(true);
+
+    int owner = 0;
+    WaitListCompactor compactor(3);
+    compactor.addCompletedWait(0);
+    compactor.addTimelineWait(1, {&owner, 0u}, 1u);
+    compactor.addTimelineWait(2, {&owner, 0u}, 2u);
+    compactor.compact();
+
+    testing::internal::CaptureStdout();
+    compactor.printStats("test");
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_STREQ("test: wait list 3, elided 2 (completed 1, superseded 1)\n", output.c_str());
+}
+
+TEST(WaitListCompactorTest, givenPrintWaitListCompactionWhenNothingIsElidedThenNothingIsPrinted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.PrintWaitListCompaction.set(true);
+
+    WaitListCompactor compactor(2);
+    compactor.compact();
+
+    testing::internal::CaptureStdout();
+    compactor.printStats("test");
+    auto output = testing::internal::GetCapturedStdout();
+    EXPECT_TRUE(output.empty());
+}
+
+TEST(WaitListCompactorTest, givenEnableWaitListCompactionFlagWhenCheckingIfEnabledThenOnlyExplicitlyEnabledValueEnablesCompaction) {
+    DebugManagerStateRestore restorer;
+
+    debugManager.flags.EnableWaitListCompaction.set(-1);
+    EXPECT_FALSE(WaitListCompactor::isEnabled());
+
+    debugManager.flags.EnableWaitListCompaction.set(0);
+    EXPECT_FALSE(WaitListCompactor::isEnabled());
+
+    debugManager.flags.EnableWaitListCompaction.set(1);
+    EXPECT_TRUE(WaitListCompactor::isEnabled());
+}
@@ -283,3 +283,96 @@ TEST(AllocateGlobalSurfaceTest, whenAllocatingGlobalSurfaceWithZeroInitSizeGreat
 
     device.getMemoryManager()->freeGraphicsMemory(alloc);
 }
+
+TEST(AllocateGlobalSurfaceTest, givenPendingInitTransfersWhenAllocatingGlobalsSurfacesThenInitDataIsQueuedAndTransferredInSingleBatch) {
+    MockDevice device{};
+    device.injectMemoryManager(new MockMemoryManager());
+
+    std::vector<uint8_t> constantsInitData(64, 7u);
+    std::vector<uint8_t> variablesInitData(32, 9u);
+
+    MemoryTransfers pendingInitTransfers;
+    auto constantsAlloc = allocateGlobalsSurface(nullptr, device, constantsInitData.size(), 0u, true, nullptr, constantsInitData.data(), &pendingInitTransfers);
+    ASSERT_NE(nullptr, constantsAlloc);
+    auto variablesAlloc = allocateGlobalsSurface(nullptr, device, variablesInitData.size(), 0u, false, nullptr, variablesInitData.data(), &pendingInitTransfers);
+    ASSERT_NE(nullptr, variablesAlloc);
+
+    ASSERT_EQ(2u, pendingInitTransfers.size());
+    EXPECT_EQ(constantsAlloc, pendingInitTransfers[0].dstAllocation);
+    EXPECT_EQ(constantsInitData.data(), pendingInitTransfers[0].srcMemory);
+    EXPECT_EQ(constantsInitData.size(), pendingInitTransfers[0].srcSize);
+    EXPECT_EQ(variablesAlloc, pendingInitTransfers[1].dstAllocation);
+    EXPECT_EQ(variablesInitData.data(), pendingInitTransfers[1].srcMemory);
+    EXPECT_EQ(variablesInitData.size(), pendingInitTransfers[1].srcSize);
+
+    EXPECT_TRUE(MemoryTransferHelper::transferMemoryToAllocations(device, pendingInitTransfers));
+    EXPECT_EQ(0, memcmp(constantsAlloc->getUnderlyingBuffer(), constantsInitData.data(), constantsInitData.size()));
+    EXPECT_EQ(0, memcmp(variablesAlloc->getUnderlyingBuffer(), variablesInitData.data(), variablesInitData.size()));
+
+    device.getMemoryManager()->freeGraphicsMemory(constantsAlloc);
+    device.getMemoryManager()->freeGraphicsMemory(variablesAlloc);
+}
+
+TEST(MemoryTransferHelperTest, givenMultipleTransfersRequiringBlitterWhenTransferringThenSingleBatchedBlitIsUsed) {
+    MockDevice device{};
+
+    uint32_t singleBlitsCounter = 0;
+    uint32_t batchedBlitsCounter = 0;
+    size_t batchedTransfersCount = 0;
+    VariableBackup<BlitHelperFunctions::BlitMemoryToAllocationFunc> blitMemoryToAllocationFuncBackup{
+        &BlitHelperFunctions::blitMemoryToAllocation, [&](const Device &device, GraphicsAllocation *memory, size_t offset, const void *hostPtr, Vec3<size_t> size) -> BlitOperationResult {
+            singleBlitsCounter++;
+            return BlitOperationResult::success;
+        }};
+    VariableBackup<BlitHelperFunctions::BlitMemoryToAllocationsFunc> blitMemoryToAllocationsFuncBackup{
+        &BlitHelperFunctions::blitMemoryToAllocations, [&](const Device &device, const BlitMemoryToAllocationTransfers &transfers) -> BlitOperationResult {
+            batchedBlitsCounter++;
+            batchedTransfersCount = transfers.size();
+            return BlitOperationResult::success;
+        }};
+
+    uint8_t constantsBuffer[64] = {};
+    uint8_t variablesBuffer[64] = {};
+    MockGraphicsAllocation constantsAlloc(constantsBuffer, sizeof(constantsBuffer));
+    MockGraphicsAllocation variablesAlloc(variablesBuffer, sizeof(variablesBuffer));
+    std::vector<uint8_t> initData(64, 7u);
+
+    MemoryTransfers transfers;
+    transfers.push_back({&constantsAlloc, 0, initData.data(), initData.size(), true});
+    transfers.push_back({&variablesAlloc, 0, initData.data(), initData.size(), true});
+
+    EXPECT_TRUE(MemoryTransferHelper::transferMemoryToAllocations(device, transfers));
+    EXPECT_EQ(0u, singleBlitsCounter);
+    EXPECT_EQ(1u, batchedBlitsCounter);
+    EXPECT_EQ(2u, batchedTransfersCount);
+    EXPECT_NE(0, memcmp(constantsBuffer, initData.data(), initData.size()));
+    EXPECT_NE(0, memcmp(variablesBuffer, initData.data(), initData.size()));
+
+    transfers.pop_back();
+    EXPECT_TRUE(MemoryTransferHelper::transferMemoryToAllocations(device, transfers));
+    EXPECT_EQ(1u, singleBlitsCounter);
+    EXPECT_EQ(1u, batchedBlitsCounter);
+}
+
+TEST(MemoryTransferHelperTest, givenBatchedBlitFailureWhenTransferringThenAllTransfersFallBackToCpuCopy) {
+    MockDevice device{};
+
+    VariableBackup<BlitHelperFunctions::BlitMemoryToAllocationsFunc> blitMemoryToAllocationsFuncBackup{
+        &BlitHelperFunctions::blitMemoryToAllocations, [](const Device &device, const BlitMemoryToAllocationTransfers &transfers) -> BlitOperationResult {
+            return BlitOperationResult::unsupported;
+        }};
+
+    uint8_t constantsBuffer[64] = {};
+    uint8_t variablesBuffer[64] = {};
+    MockGraphicsAllocation constantsAlloc(constantsBuffer, sizeof(constantsBuffer));
+    MockGraphicsAllocation variablesAlloc(variablesBuffer, sizeof(variablesBuffer));
+    std::vector<uint8_t> initData(64, 7u);
+
+    MemoryTransfers transfers;
+    transfers.push_back({&constantsAlloc, 0, initData.data(), initData.size(), true});
+    transfers.push_back({&variablesAlloc, 0, initData.data(), initData.size(), true});
+
+    EXPECT_TRUE(MemoryTransferHelper::transferMemoryToAllocations(device, transfers));
+    EXPECT_EQ(0, memcmp(constantsBuffer, initData.data(), initData.size()));
+    EXPECT_EQ(0, memcmp(variablesBuffer, initData.data(), initData.size()));
+}
@@ -0,0 +1,322 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/completion_reactor.h"
+#include "shared/test/common/mocks/mock_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_completion_reactor.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace NEO;
+
+namespace {
+class UserFenceCommandStreamReceiver : public MockCommandStreamReceiver {
+  public:
+    using MockCommandStreamReceiver::MockCommandStreamReceiver;
+
+    bool waitUserFenceSupported() override { return true; }
+
+    bool waitUserFence(TaskCountType waitValue, uint64_t hostAddress, int64_t timeout, bool userInterrupt, uint32_t externalInterruptId, GraphicsAllocation *allocForInterruptWait) override {
+        waitUserFenceCalled++;
+        waitUserFenceValue = waitValue;
+        waitUserFenceAddress = hostAddress;
+        return false;
+    }
+
+    uint32_t waitUserFenceCalled = 0;
+    TaskCountType waitUserFenceValue = 0;
+    uint64_t waitUserFenceAddress = 0;
+};
+
+struct CompletionReactorTest : public ::testing::Test {
+    void SetUp() override {
+        csr = std::make_unique<MockCommandStreamReceiver>(executionEnvironment, 0, 1);
+        csr->isGpuHangDetectedReturnValue = false;
+        *csr->getTagAddress() = 0;
+    }
+
+    MockExecutionEnvironment executionEnvironment;
+    std::unique_ptr<MockCommandStreamReceiver> csr;
+    MockCompletionReactor reactor;
+};
+} // namespace
+
+TEST_F(CompletionReactorTest, givenTaskCountWatchWhenTagIsNotUpdatedThenWatchIsNotCompleted) {
+    uint32_t callbackCalled = 0;
+    auto watch = CompletionReactor::createTaskCountWatch(*csr, 5u);
+    watch.callback = [&callbackCalled](bool gpuHangDetected) { callbackCalled++; };
+    reactor.registerWatch(std::move(watch));
+    EXPECT_EQ(1u, reactor.openThreadCalled);
+
+    reactor.transferRegisterList();
+    *csr->getTagAddress() = 4u;
+    EXPECT_FALSE(reactor.processWatches());
+    EXPECT_EQ(0u, callbackCalled);
+    EXPECT_EQ(1u, reactor.watches.size());
+
+    *csr->getTagAddress() = 5u;
+    EXPECT_TRUE(reactor.processWatches());
+    EXPECT_EQ(1u, callbackCalled);
+    EXPECT_TRUE(reactor.watches.empty());
+}
+
+TEST_F(CompletionReactorTest, givenMultiplePartitionsWhenOnlySomeOfThemAreCompletedThenWatchIsNotCompleted) {
+    TagAddressType counters[4] = {};
+    bool callbackCalled = false;
+
+    CompletionWatch watch;
+    watch.csr = csr.get();
+    watch.pollAddress = &counters[0];
+    watch.waitValue = 3u;
+    watch.partitionCount = 2u;
+    watch.partitionOffset = 2 * sizeof(TagAddressType);
+    watch.callback = [&callbackCalled](bool gpuHangDetected) { callbackCalled = true; };
+    reactor.registerWatch(std::move(watch));
+    reactor.transferRegisterList();
+
+    counters[0] = 3u;
+    counters[1] = 3u;
+    EXPECT_FALSE(reactor.processWatches());
+    EXPECT_FALSE(callbackCalled);
+
+    counters[2] = 3u;
+    EXPECT_TRUE(reactor.processWatches());
+    EXPECT_TRUE(callbackCalled);
+}
+
+TEST_F(CompletionReactorTest, givenWatchWithCompletionCheckWhenProcessingThenCompletionCheckIsUsed) {
+    bool completed = false;
+    uint32_t callbackCalled = 0;
+
+    CompletionWatch watch;
+    watch.csr = csr.get();
+    watch.completionCheck = [&completed]() { return completed; };
+    watch.callback = [&callbackCalled](bool gpuHangDetected) {
+        EXPECT_FALSE(gpuHangDetected);
+        callbackCalled++;
+    };
+    reactor.registerWatch(std::move(watch));
+    reactor.transferRegisterList();
+
+    EXPECT_FALSE(reactor.processWatches());
+    completed = true;
+    EXPECT_TRUE(reactor.processWatches());
+    EXPECT_FALSE(reactor.processWatches());
+    EXPECT_EQ(1u, callbackCalled);
+}
+
+TEST_F(CompletionReactorTest, givenGpuHangWhenProcessingWatchesThenWatchesOfHungCsrAreCompletedWithHangStatus) {
+    auto otherCsr = std::make_unique<MockCommandStreamReceiver>(executionEnvironment, 0, 1);
+    otherCsr->isGpuHangDetectedReturnValue = false;
+    csr->isGpuHangDetectedReturnValue = true;
+    reactor.gpuHangCheckPeriod = std::chrono::microseconds(0);
+
+    bool hungCallbackStatus = false;
+    uint32_t otherCallbackCalled = 0;
+
+    auto hungWatch = CompletionReactor::createTaskCountWatch(*csr, 10u);
+    hungWatch.callback = [&hungCallbackStatus](bool gpuHangDetected) { hungCallbackStatus = gpuHangDetected; };
+    reactor.registerWatch(std::move(hungWatch));
+
+    CompletionWatch otherWatch;
+    otherWatch.csr = otherCsr.get();
+    otherWatch.completionCheck = []() { return false; };
+    otherWatch.callback = [&otherCallbackCalled](bool gpuHangDetected) { otherCallbackCalled++; };
+    reactor.registerWatch(std::move(otherWatch));
+    reactor.transferRegisterList();
+
+    EXPECT_TRUE(reactor.processWatches());
+    EXPECT_TRUE(hungCallbackStatus);
+    EXPECT_EQ(0u, otherCallbackCalled);
+    EXPECT_EQ(1u, reactor.watches.size());
+}
+
+TEST_F(CompletionReactorTest, givenAllWatchesOnCsrWithUserFenceSupportWhenWaitingForProgressThenUserFenceIsWaitedForEarliestValue) {
+    auto userFenceCsr = std::make_unique<UserFenceCommandStreamReceiver>(executionEnvironment, 0, 1);
+    TagAddressType counter = 0;
+
+    for (auto waitValue : {7u, 3u, 5u}) {
+        CompletionWatch watch;
+        watch.csr = userFenceCsr.get();
+        watch.pollAddress = &counter;
+        watch.waitValue = waitValue;
+        reactor.registerWatch(std::move(watch));
+    }
+    reactor.transferRegisterList();
+
+    reactor.waitForProgress();
+    EXPECT_EQ(1u, userFenceCsr->waitUserFenceCalled);
+    EXPECT_EQ(3u, userFenceCsr->waitUserFenceValue);
+    EXPECT_EQ(castToUint64(&counter), userFenceCsr->waitUserFenceAddress);
+    EXPECT_EQ(0u, reactor.idleIterations);
+}
+
+TEST_F(CompletionReactorTest, givenNoUserFenceSupportWhenWaitingForProgressThenSpinningIsFollowedByIncreasingBackoff) {
+    auto watch = CompletionReactor::createTaskCountWatch(*csr, 1u);
+    reactor.registerWatch(std::move(watch));
+    reactor.transferRegisterList();
+
+    for (size_t i = 0; i < CompletionReactor::spinIterationsBeforeBackoff; i++) {
+        reactor.waitForProgress();
+    }
+    EXPECT_EQ(0, reactor.pollingBackoff.count());
+
+    reactor.waitForProgress();
+    EXPECT_EQ(1, reactor.pollingBackoff.count());
+    reactor.waitForProgress();
+    EXPECT_EQ(2, reactor.pollingBackoff.count());
+
+    reactor.pollingBackoff = CompletionReactor::maxPollingBackoff;
+    reactor.waitForProgress();
+    EXPECT_EQ(CompletionReactor::maxPollingBackoff, reactor.pollingBackoff);
+}
+
+TEST_F(CompletionReactorTest, givenReactorThreadWhenWatchIsCompletedThenCallbackIsCalledFromReactorThread) {
+    reactor.callBaseOpenThread = true;
+    std::atomic<bool> callbackCalled = false;
+
+    auto watch = CompletionReactor::createTaskCountWatch(*csr, 1u);
+    watch.callback = [&callbackCalled](bool gpuHangDetected) { callbackCalled = true; };
+    *csr->getTagAddress() = 1u;
+    reactor.registerWatch(std::move(watch));
+    EXPECT_NE(nullptr, reactor.thread.get());
+
+    while (!callbackCalled) {
+        std::this_thread::yield();
+    }
+
+    reactor.closeThread();
+    EXPECT_EQ(nullptr, reactor.thread.get());
+}
+
+TEST_F(CompletionReactorTest, givenCancelledTokenWhenProcessingWatchThenWatchIsDroppedWithoutCallback) {
+    auto token = std::make_shared<CompletionWatchToken>();
+    uint32_t callbackCalled = 0;
+    uint32_t completionCheckCalled = 0;
+
+    CompletionWatch watch;
+    watch.csr = csr.get();
+    watch.completionCheck = [&completionCheckCalled]() {
+        completionCheckCalled++;
+        return false;
+    };
+    watch.callback = [&callbackCalled](bool gpuHangDetected) { callbackCalled++; };
+    watch.cancellationToken = token;
+    reactor.registerWatch(std::move(watch));
+    reactor.transferRegisterList();
+
+    EXPECT_FALSE(reactor.processWatches());
+    EXPECT_EQ(1u, completionCheckCalled);
+
+    token->cancel();
+    EXPECT_TRUE(reactor.processWatches());
+    EXPECT_EQ(1u, completionCheckCalled);
+    EXPECT_EQ(0u, callbackCalled);
+    EXPECT_TRUE(reactor.watches.empty());
+}
+
+TEST_F(CompletionReactorTest, givenPendingWatchesWhenClosingThreadThenCompletedWatchesAreFlushedAndOthersFailAfterTimeout) {
+    reactor.drainTimeout = std::chrono::milliseconds(0);
+    TagAddressType counter = 0;
+    auto token = std::make_shared<CompletionWatchToken>();
+
+    std::vector<int> callbackStatuses;
+    auto createCounterWatch = [&](uint64_t waitValue, int id) {
+        CompletionWatch watch;
+        watch.csr = csr.get();
+        watch.pollAddress = &counter;
+        watch.waitValue = waitValue;
+        watch.callback = [&callbackStatuses, id](bool gpuHangDetected) { callbackStatuses.push_back(gpuHangDetected ? -id : id); };
+        return watch;
+    };
+
+    reactor.registerWatch(createCounterWatch(1u, 1));
+    reactor.transferRegisterList();
+    reactor.registerWatch(createCounterWatch(2u, 2));
+    auto cancelledWatch = createCounterWatch(2u, 3);
+    cancelledWatch.cancellationToken = token;
+    reactor.registerWatch(std::move(cancelledWatch));
+    token->cancel();
+
+    counter = 1u;
+    reactor.closeThread();
+
+    EXPECT_TRUE(reactor.watches.empty());
+    EXPECT_TRUE(reactor.registerList.empty());
+    ASSERT_EQ(2u, callbackStatuses.size());
+    EXPECT_EQ(1, callbackStatuses[0]);
+    EXPECT_EQ(-2, callbackStatuses[1]);
+}
+
+TEST_F(CompletionReactorTest, givenReactorThreadWhenClosingThreadFromCallbackThenReactorThreadIsNotJoinedBySelf) {
+    reactor.callBaseOpenThread = true;
+    std::atomic<bool> callbackCalled = false;
+
+    auto watch = CompletionReactor::createTaskCountWatch(*csr, 1u);
+    watch.callback = [this, &callbackCalled](bool gpuHangDetected) {
+        reactor.closeThread();
+        callbackCalled = true;
+    };
+    *csr->getTagAddress() = 1u;
+    reactor.registerWatch(std::move(watch));
+
+    while (!callbackCalled) {
+        std::this_thread::yield();
+    }
+
+    reactor.closeThread();
+    EXPECT_EQ(nullptr, reactor.thread.get());
+}
+
+TEST_F(CompletionReactorTest, givenWatchCallbackWhenCheckingIfWatchesCanBeCompletedAsyncThenReactorThreadAndDrainingReactorCannot) {
+    reactor.callBaseOpenThread = true;
+    EXPECT_FALSE(reactor.isReactorThread());
+    EXPECT_TRUE(reactor.canCompleteWatchesAsync());
+
+    std::atomic<bool> callbackCalled = false;
+    std::atomic<bool> callbackOnReactorThread = false;
+    std::atomic<bool> asyncCompletionInCallback = true;
+    auto watch = CompletionReactor::createTaskCountWatch(*csr, 1u);
+    watch.callback = [&](bool gpuHangDetected) {
+        callbackOnReactorThread = reactor.isReactorThread();
+        asyncCompletionInCallback = reactor.canCompleteWatchesAsync();
+        callbackCalled = true;
+    };
+    *csr->getTagAddress() = 1u;
+    reactor.registerWatch(std::move(watch));
+
+    while (!callbackCalled) {
+        std::this_thread::yield();
+    }
+    EXPECT_TRUE(callbackOnReactorThread);
+    EXPECT_FALSE(asyncCompletionInCallback);
+    reactor.closeThread();
+
+    reactor.callBaseOpenThread = false;
+    reactor.drainTimeout = std::chrono::milliseconds(0);
+    asyncCompletionInCallback = true;
+    watch = CompletionReactor::createTaskCountWatch(*csr, 2u);
+    watch.callback = [&](bool gpuHangDetected) { asyncCompletionInCallback = reactor.canCompleteWatchesAsync(); };
+    reactor.registerWatch(std::move(watch));
+    reactor.closeThread();
+    EXPECT_FALSE(asyncCompletionInCallback);
+    EXPECT_TRUE(reactor.canCompleteWatchesAsync());
+}
+
+TEST(CompletionReactorExecutionEnvironmentTest, whenGettingCompletionReactorThenItIsCreatedOnce) {
+    MockExecutionEnvironment executionEnvironment;
+    EXPECT_EQ(nullptr, executionEnvironment.completionReactor.get());
+
+    auto completionReactor = executionEnvironment.getCompletionReactor();
+    EXPECT_NE(nullptr, completionReactor);
+    EXPECT_EQ(completionReactor, executionEnvironment.getCompletionReactor());
+}
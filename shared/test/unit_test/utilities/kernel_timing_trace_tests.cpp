@@ -0,0 +1,245 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/kernel_timing_trace.h"
+#include "shared/source/utilities/tag_allocator.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_io_functions.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_timestamp_container.h"
+#include "shared/test/common/mocks/mock_timestamp_packet.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+using namespace NEO;
+
+namespace {
+class MockKernelTimingTrace : public KernelTimingTrace {
+  public:
+    using KernelTimingTrace::deviceClocks;
+    using KernelTimingTrace::events;
+    using KernelTimingTrace::finalizeFile;
+    using KernelTimingTrace::traceFile;
+    using KernelTimingTrace::writtenEvents;
+
+    MockKernelTimingTrace(Format format) : KernelTimingTrace("trace_file", format) {}
+
+    void writeToFile(const void *data, size_t size) override {
+        output.append(static_cast<const char *>(data), size);
+    }
+
+    std::string output;
+};
+
+struct KernelTimingTraceTest : public ::testing::Test {
+    using MockNode = TagNode<MockTimestampPackets32>;
+
+    void SetUp() override {
+        executionEnvironment = std::make_unique<MockExecutionEnvironment>(defaultHwInfo.get());
+        memoryManager = std::make_unique<MockMemoryManager>(*executionEnvironment);
+        allocator = std::make_unique<MockTagAllocator<MockTimestampPackets32>>(0, memoryManager.get(), 4);
+        clock.anchor.gpuTimeStamp = 100u;
+        clock.anchor.cpuTimeinNS = 5000u;
+        clock.timerResolution = 2.0;
+    }
+
+    KernelTimingRecord createRecord(const std::string &name, uint64_t apiCallId, uint32_t globalStart, uint32_t globalEnd) {
+        auto node = static_cast<MockNode *>(allocator->getTag());
+        for (auto &packet : node->tagForCpuAccess->packets) {
+            packet.globalStart = globalStart;
+            packet.globalEnd = globalEnd;
+        }
+        return {node, name, apiCallId};
+    }
+
+    std::unique_ptr<MockExecutionEnvironment> executionEnvironment;
+    std::unique_ptr<MockMemoryManager> memoryManager;
+    std::unique_ptr<MockTagAllocator<MockTimestampPackets32>> allocator;
+    KernelTimingDeviceClock clock;
+};
+} // namespace
+
+TEST(KernelTimingDeviceClockTest, givenGpuTicksWhenConvertingToHostTimeThenTimerResolutionAndTimestampMaskAreApplied) {
+    KernelTimingDeviceClock clock;
+    clock.anchor.gpuTimeStamp = 0xF0u;
+    clock.anchor.cpuTimeinNS = 1000u;
+    clock.timerResolution = 10.0;
+    clock.timestampMask = 0xFFu;
+
+    EXPECT_EQ(1000u, clock.toHostNs(0xF0u));
+    EXPECT_EQ(1050u, clock.toHostNs(0xF5u));
+    EXPECT_EQ(1200u, clock.toHostNs(0x104u));
+}
+
+TEST_F(KernelTimingTraceTest, givenCompletedRecordsWhenProcessingThenEventsAreCreatedAndTagsAreReturned) {
+    MockKernelTimingTrace trace(KernelTimingTrace::Format::chromeJson);
+
+    std::vector<KernelTimingRecord> records;
+    records.push_back(createRecord("kernelA", 3u, 110u, 160u));
+    records.push_back(createRecord("kernelB", 4u, 200u, 201u));
+    EXPECT_FALSE(allocator->usedTags.peekIsEmpty());
+
+    trace.processRecords(clock, 1u, 7u, records, false);
+
+    EXPECT_TRUE(records.empty());
+    EXPECT_TRUE(allocator->usedTags.peekIsEmpty());
+    ASSERT_EQ(2u, trace.events.size());
+
+    EXPECT_EQ("kernelA", trace.events[0].name);
+    EXPECT_EQ(3u, trace.events[0].apiCallId);
+    EXPECT_EQ(5020u, trace.events[0].startNs);
+    EXPECT_EQ(5120u, trace.events[0].endNs);
+    EXPECT_EQ(1u, trace.events[0].rootDeviceIndex);
+    EXPECT_EQ(7u, trace.events[0].queueId);
+
+    EXPECT_EQ("kernelB", trace.events[1].name);
+    EXPECT_EQ(5200u, trace.events[1].startNs);
+    EXPECT_EQ(5202u, trace.events[1].endNs);
+}
+
+TEST_F(KernelTimingTraceTest, givenRecordWithMultiplePacketsUsedWhenProcessingThenEarliestStartAndLatestEndAreUsed) {
+    MockKernelTimingTrace trace(KernelTimingTrace::Format::chromeJson);
+
+    std::vector<KernelTimingRecord> records;
+    records.push_back(createRecord("kernel", 0u, 110u, 160u));
+    auto node = static_cast<MockNode *>(records[0].timestampNode);
+    node->setPacketsUsed(2u);
+    node->tagForCpuAccess->packets[1].globalStart = 105u;
+    node->tagForCpuAccess->packets[1].globalEnd = 180u;
+    node->tagForCpuAccess->packets[2].globalStart = 100u;
+    node->tagForCpuAccess->packets[2].globalEnd = 300u;
+
+    trace.processRecords(clock, 0u, 0u, records, false);
+
+    ASSERT_EQ(1u, trace.events.size());
+    EXPECT_EQ(5010u, trace.events[0].startNs);
+    EXPECT_EQ(5160u, trace.events[0].endNs);
+}
+
+TEST_F(KernelTimingTraceTest, givenCachedDeviceClockWhenFlushingThenClockIsDroppedToBeReanchoredOnNextSubmit) {
+    MockKernelTimingTrace trace(KernelTimingTrace::Format::chromeJson);
+    trace.deviceClocks[0] = clock;
+
+    trace.flush();
+
+    EXPECT_TRUE(trace.deviceClocks.empty());
+}
+
+TEST_F(KernelTimingTraceTest, givenGpuHangWhenProcessingRecordsThenTagsAreReturnedWithoutCreatingEvents) {
+    MockKernelTimingTrace trace(KernelTimingTrace::Format::chromeJson);
+
+    std::vector<KernelTimingRecord> records;
+    records.push_back(createRecord("kernel", 0u, 110u, 160u));
+
+    trace.processRecords(clock, 0u, 0u, records, true);
+
+    EXPECT_TRUE(records.empty());
+    EXPECT_TRUE(trace.events.empty());
+    EXPECT_TRUE(allocator->usedTags.peekIsEmpty());
+}
+
+TEST_F(KernelTimingTraceTest, givenChromeJsonFormatWhenFlushingThenTraceEventsArrayIsWritten) {
+    MockKernelTimingTrace trace(KernelTimingTrace::Format::chromeJson);
+
+    std::vector<KernelTimingRecord> records;
+    records.push_back(createRecord("kernel\"A", 3u, 110u, 160u));
+    trace.processRecords(clock, 1u, 7u, records, false);
+    trace.flush();
+
+    records.push_back(createRecord("kernelB", 4u, 600u, 601u));
+    trace.processRecords(clock, 1u, 7u, records, false);
+    trace.flush();
+    EXPECT_EQ(2u, trace.writtenEvents);
+    EXPECT_TRUE(trace.events.empty());
+
+    trace.finalizeFile();
+    EXPECT_EQ(nullptr, trace.traceFile);
+
+    std::string expected = "[\n"
+                           "{\"name\":\"kernel\\\"A\",\"cat\":\"kernel\",\"ph\":\"X\",\"ts\":5.020,\"dur\":0.100,\"pid\":1,\"tid\":7,\"args\":{\"apiCallId\":3}},\n"
+                           "{\"name\":\"kernelB\",\"cat\":\"kernel\",\"ph\":\"X\",\"ts\":6.000,\"dur\":0.002,\"pid\":1,\"tid\":7,\"args\":{\"apiCallId\":4}}"
+                           "\n]\n";
+    EXPECT_EQ(expected, trace.output);
+}
+
+TEST_F(KernelTimingTraceTest, givenBinaryFormatWhenFlushingThenHeaderAndRecordsAreWritten) {
+    MockKernelTimingTrace trace(KernelTimingTrace::Format::binary);
+
+    std::vector<KernelTimingRecord> records;
+    records.push_back(createRecord("kernel", 9u, 110u, 160u));
+    trace.processRecords(clock, 2u, 5u, records, false);
+    trace.flush();
+
+    size_t expectedSize = 2 * sizeof(uint32_t) + 3 * sizeof(uint64_t) + 3 * sizeof(uint32_t) + strlen("kernel");
+    ASSERT_EQ(expectedSize, trace.output.size());
+
+    auto data = trace.output.data();
+    uint32_t header[2] = {};
+    memcpy(header, data, sizeof(header));
+    EXPECT_EQ(KernelTimingTrace::binaryTraceMagic, header[0]);
+    EXPECT_EQ(KernelTimingTrace::binaryTraceVersion, header[1]);
+    data += sizeof(header);
+
+    uint64_t values64[3] = {};
+    memcpy(values64, data, sizeof(values64));
+    EXPECT_EQ(9u, values64[0]);
+    EXPECT_EQ(5020u, values64[1]);
+    EXPECT_EQ(5120u, values64[2]);
+    data += sizeof(values64);
+
+    uint32_t values32[3] = {};
+    memcpy(values32, data, sizeof(values32));
+    EXPECT_EQ(2u, values32[0]);
+    EXPECT_EQ(5u, values32[1]);
+    EXPECT_EQ(6u, values32[2]);
+    data += sizeof(values32);
+
+    EXPECT_EQ("kernel", std::string(data, 6));
+}
+
+TEST_F(KernelTimingTraceTest, givenTraceFileCannotBeOpenedWhenFlushingThenEventsAreDroppedAndOpenIsNotRetried) {
+    VariableBackup<FILE *> backupFopenReturned(&IoFunctions::mockFopenReturned, nullptr);
+    VariableBackup<uint32_t> backupFopenCalled(&IoFunctions::mockFopenCalled, 0u);
+    MockKernelTimingTrace trace(KernelTimingTrace::Format::chromeJson);
+
+    for (uint32_t i = 0; i < 2; i++) {
+        std::vector<KernelTimingRecord> records;
+        records.push_back(createRecord("kernel", i, 110u, 160u));
+        trace.processRecords(clock, 0u, 0u, records, false);
+        trace.flush();
+    }
+
+    EXPECT_EQ(1u, IoFunctions::mockFopenCalled);
+    EXPECT_EQ(nullptr, trace.traceFile);
+    EXPECT_TRUE(trace.events.empty());
+    EXPECT_TRUE(trace.output.empty());
+}
+
+TEST(KernelTimingTraceExecutionEnvironmentTest, givenKernelTimingTraceDisabledWhenGettingTraceThenNullptrIsReturned) {
+    DebugManagerStateRestore restorer;
+    MockExecutionEnvironment executionEnvironment;
+
+    EXPECT_EQ(nullptr, executionEnvironment.getKernelTimingTrace());
+}
+
+TEST(KernelTimingTraceExecutionEnvironmentTest, givenKernelTimingTraceEnabledWhenGettingTraceThenItIsCreatedOnce) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableKernelTimingTrace.set(1);
+    MockExecutionEnvironment executionEnvironment;
+
+    auto trace = executionEnvironment.getKernelTimingTrace();
+    EXPECT_NE(nullptr, trace);
+    EXPECT_EQ(trace, executionEnvironment.getKernelTimingTrace());
+    EXPECT_EQ(0u, trace->getNextQueueId());
+    EXPECT_EQ(1u, trace->getNextQueueId());
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/test/common/helpers/variable_backup.h"
+#include "shared/test/common/mocks/mock_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_completion_reactor.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/os_interface/linux/sys_calls_linux_ult.h"
+
+#include "gtest/gtest.h"
+
+#include <sys/eventfd.h>
+
+using namespace NEO;
+
+namespace {
+int writtenFd = -1;
+uint64_t writtenValue = 0;
+
+struct CompletionReactorLinuxTest : public ::testing::Test {
+    void SetUp() override {
+        csr = std::make_unique<MockCommandStreamReceiver>(executionEnvironment, 0, 1);
+        csr->isGpuHangDetectedReturnValue = false;
+        *csr->getTagAddress() = 0;
+        writtenFd = -1;
+        writtenValue = 0;
+    }
+
+    VariableBackup<decltype(SysCalls::sysCallsDup)> dupBackup{&SysCalls::sysCallsDup, [](int oldfd) -> int { return oldfd + 10; }};
+    VariableBackup<decltype(SysCalls::sysCallsWrite)> writeBackup{&SysCalls::sysCallsWrite, [](int fd, const void *buf, size_t count) -> ssize_t {
+                                                                      writtenFd = fd;
+                                                                      writtenValue = *reinterpret_cast<const uint64_t *>(buf);
+                                                                      return static_cast<ssize_t>(count);
+                                                                  }};
+    VariableBackup<decltype(SysCalls::closeFuncCalled)> closeCalledBackup{&SysCalls::closeFuncCalled, 0u};
+    VariableBackup<decltype(SysCalls::closeFuncArgPassed)> closeArgBackup{&SysCalls::closeFuncArgPassed, 0};
+
+    MockExecutionEnvironment executionEnvironment;
+    std::unique_ptr<MockCommandStreamReceiver> csr;
+    MockCompletionReactor reactor;
+};
+} // namespace
+
+TEST_F(CompletionReactorLinuxTest, givenEventfdAvailableWhenCreatingNotificationFdThenNonBlockingEventfdIsReturned) {
+    VariableBackup<decltype(SysCalls::sysCallsEventfd)> eventfdBackup{&SysCalls::sysCallsEventfd, [](unsigned int initval, int flags) -> int {
+                                                                          EXPECT_EQ(0u, initval);
+                                                                          EXPECT_NE(0, flags & EFD_NONBLOCK);
+                                                                          return 7;
+                                                                      }};
+    EXPECT_EQ(7, CompletionReactor::createNotificationFd());
+
+    eventfdBackup = [](unsigned int initval, int flags) -> int { return -1; };
+    EXPECT_EQ(CompletionWatch::invalidNotificationFd, CompletionReactor::createNotificationFd());
+}
+
+TEST_F(CompletionReactorLinuxTest, givenWatchWithNotificationFdWhenCompletedThenDuplicatedFdIsSignaledAndClosed) {
+    auto watch = CompletionReactor::createTaskCountWatch(*csr, 1u);
+    watch.notificationFd = 5;
+    reactor.registerWatch(std::move(watch));
+    reactor.transferRegisterList();
+    ASSERT_EQ(1u, reactor.watches.size());
+    EXPECT_EQ(15, reactor.watches[0].notificationFd);
+
+    *csr->getTagAddress() = 1u;
+    EXPECT_TRUE(reactor.processWatches());
+    EXPECT_EQ(15, writtenFd);
+    EXPECT_EQ(1u, writtenValue);
+    EXPECT_EQ(1u, SysCalls::closeFuncCalled);
+    EXPECT_EQ(15, SysCalls::closeFuncArgPassed);
+}
+
+TEST_F(CompletionReactorLinuxTest, givenCancelledWatchWithNotificationFdWhenProcessedThenDuplicatedFdIsClosedWithoutSignaling) {
+    auto token = std::make_shared<CompletionWatchToken>();
+    auto watch = CompletionReactor::createTaskCountWatch(*csr, 1u);
+    watch.notificationFd = 5;
+    watch.cancellationToken = token;
+    reactor.registerWatch(std::move(watch));
+    reactor.transferRegisterList();
+
+    token->cancel();
+    EXPECT_TRUE(reactor.processWatches());
+    EXPECT_EQ(-1, writtenFd);
+    EXPECT_EQ(1u, SysCalls::closeFuncCalled);
+    EXPECT_EQ(15, SysCalls::closeFuncArgPassed);
+}
@@ -0,0 +1,432 @@
+/*
+ * Copyright (C) 2025 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/program/kernel_info.h"
+#include "shared/source/utilities/local_work_size_autotuner.h"
+#include "shared/source/utilities/tag_allocator.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/helpers/default_hw_info.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+#include "shared/test/common/mocks/mock_memory_manager.h"
+#include "shared/test/common/mocks/mock_timestamp_container.h"
+#include "shared/test/common/mocks/mock_timestamp_packet.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace NEO;
+
+namespace {
+class MockLocalWorkSizeAutotuner : public LocalWorkSizeAutotuner {
+  public:
+    using LocalWorkSizeAutotuner::cacheFileKeys;
+    using LocalWorkSizeAutotuner::maxCacheFileEntries;
+    using LocalWorkSizeAutotuner::tunedSizes;
+    using LocalWorkSizeAutotuner::tuningStates;
+
+    MockLocalWorkSizeAutotuner(const std::string &cacheFileName, uint32_t samplesPerCandidate, uint32_t maxCandidates)
+        : LocalWorkSizeAutotuner(cacheFileName, samplesPerCandidate, maxCandidates) {}
+
+    std::string readCacheFile() override {
+        readCacheFileCalled++;
+        return cacheFileContent;
+    }
+
+    void appendToCacheFile(const std::string &entry) override {
+        EXPECT_TRUE(cacheFileLocked);
+        cacheFileContent += entry;
+    }
+
+    void writeCacheFile(const std::string &content) override {
+        EXPECT_TRUE(cacheFileLocked);
+        writeCacheFileCalled++;
+        cacheFileContent = content;
+    }
+
+    UnifiedHandle lockCacheFile() override {
+        EXPECT_FALSE(cacheFileLocked);
+        cacheFileLocked = true;
+        lockCacheFileCalled++;
+        return 0;
+    }
+
+    void unlockCacheFile(UnifiedHandle lockHandle) override {
+        EXPECT_TRUE(cacheFileLocked);
+        cacheFileLocked = false;
+    }
+
+    std::string cacheFileContent;
+    uint32_t readCacheFileCalled = 0;
+    uint32_t writeCacheFileCalled = 0;
+    uint32_t lockCacheFileCalled = 0;
+    bool cacheFileLocked = false;
+};
+
+LocalWorkSizeAutotuneKey createTestKey(const Vec3<size_t> &gws) {
+    LocalWorkSizeAutotuneKey key;
+    key.kernelHash = 0x1234abcdu;
+    key.deviceId = 0x56780001u;
+    key.gws = gws;
+    return key;
+}
+} // namespace
+
+TEST(LocalWorkSizeAutotunerTest, givenGlobalSizeWhenGeneratingCandidatesThenDefaultIsFirstAndOthersDivideGlobalSizeAndAreSimdAligned) {
+    Vec3<size_t> gws = {1024, 64, 1};
+    Vec3<size_t> defaultLws = {64, 4, 1};
+
+    auto candidates = LocalWorkSizeAutotuner::generateCandidates(gws, defaultLws, 256, 16, 8);
+
+    ASSERT_EQ(8u, candidates.size());
+    EXPECT_EQ(defaultLws, candidates[0]);
+    EXPECT_EQ(Vec3<size_t>(256, 1, 1), candidates[1]);
+    EXPECT_EQ(Vec3<size_t>(16, 16, 1), candidates[2]);
+    for (auto &lws : candidates) {
+        auto groupSize = lws.x * lws.y * lws.z;
+        EXPECT_GE(256u, groupSize);
+        EXPECT_EQ(0u, groupSize % 16);
+        EXPECT_EQ(0u, gws.x % lws.x);
+        EXPECT_EQ(0u, gws.y % lws.y);
+        EXPECT_EQ(0u, gws.z % lws.z);
+        EXPECT_EQ(1u, static_cast<size_t>(std::count(candidates.begin(), candidates.end(), lws)));
+    }
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenGlobalSizeSmallerThanSimdWhenGeneratingCandidatesThenWholeRangeIsSingleCandidate) {
+    Vec3<size_t> gws = {6, 1, 1};
+
+    auto candidates = LocalWorkSizeAutotuner::generateCandidates(gws, {6, 1, 1}, 256, 16, 8);
+
+    ASSERT_EQ(1u, candidates.size());
+    EXPECT_EQ(Vec3<size_t>(6, 1, 1), candidates[0]);
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenAllCandidatesMeasuredWhenSelectingLocalWorkSizeThenFastestCandidateIsReturnedAndPersisted) {
+    MockLocalWorkSizeAutotuner autotuner("lws_cache", 2u, 3u);
+    auto key = createTestKey({512, 1, 1});
+    Vec3<size_t> defaultLws = {128, 1, 1};
+
+    std::vector<Vec3<size_t>> handedOut;
+    for (uint32_t i = 0; i < 6; i++) {
+        bool measurementRequired = false;
+        auto lws = autotuner.selectLocalWorkSize(key, defaultLws, 512, 32, measurementRequired);
+        EXPECT_TRUE(measurementRequired);
+        handedOut.push_back(lws);
+    }
+    EXPECT_EQ(defaultLws, handedOut[0]);
+    EXPECT_EQ(handedOut[0], handedOut[3]);
+    EXPECT_EQ(handedOut[1], handedOut[4]);
+    EXPECT_EQ(handedOut[2], handedOut[5]);
+
+    auto fastestLws = handedOut[2];
+    for (auto &lws : handedOut) {
+        autotuner.reportMeasurement({key, lws}, lws == fastestLws ? 100u : 200u);
+    }
+
+    EXPECT_TRUE(autotuner.tuningStates.empty());
+
+    bool measurementRequired = true;
+    EXPECT_EQ(fastestLws, autotuner.selectLocalWorkSize(key, defaultLws, 512, 32, measurementRequired));
+    EXPECT_FALSE(measurementRequired);
+
+    std::string expectedEntry = "1234abcd 56780001 512 1 1 " + std::to_string(fastestLws.x) + " 1 1\n";
+    EXPECT_EQ(expectedEntry, autotuner.cacheFileContent);
+    EXPECT_EQ(1u, autotuner.lockCacheFileCalled);
+    EXPECT_FALSE(autotuner.cacheFileLocked);
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenTrialsNeverMeasuredWhenSelectingLocalWorkSizeThenDefaultSizeIsSettledWithoutPersisting) {
+    MockLocalWorkSizeAutotuner autotuner("lws_cache", 2u, 2u);
+    auto key = createTestKey({256, 1, 1});
+    Vec3<size_t> defaultLws = {64, 1, 1};
+
+    const size_t trialsLimit = 2u * 2u * LocalWorkSizeAutotuner::unmeasuredTrialsLimitFactor;
+    bool measurementRequired = false;
+    for (size_t i = 0; i < trialsLimit; i++) {
+        autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired);
+        EXPECT_TRUE(measurementRequired);
+    }
+
+    EXPECT_EQ(defaultLws, autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired));
+    EXPECT_FALSE(measurementRequired);
+    EXPECT_TRUE(autotuner.tuningStates.empty());
+    EXPECT_FALSE(autotuner.getPendingTrial(key, defaultLws).has_value());
+    EXPECT_TRUE(autotuner.cacheFileContent.empty());
+    EXPECT_EQ(0u, autotuner.lockCacheFileCalled);
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenSomeTrialsMeasuredAndMostLostWhenSelectingLocalWorkSizeThenFastestMeasuredSizeIsSettled) {
+    MockLocalWorkSizeAutotuner autotuner("", 2u, 2u);
+    auto key = createTestKey({256, 1, 1});
+    Vec3<size_t> defaultLws = {64, 1, 1};
+
+    bool measurementRequired = false;
+    autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired);
+    auto measuredLws = autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired);
+    EXPECT_NE(defaultLws, measuredLws);
+    autotuner.reportMeasurement({key, measuredLws}, 100u);
+
+    const size_t trialsLimit = 2u * 2u * LocalWorkSizeAutotuner::unmeasuredTrialsLimitFactor;
+    for (size_t i = 0; i < trialsLimit - 1; i++) {
+        autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired);
+        EXPECT_TRUE(measurementRequired);
+    }
+
+    EXPECT_EQ(measuredLws, autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired));
+    EXPECT_FALSE(measurementRequired);
+    EXPECT_TRUE(autotuner.tuningStates.empty());
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenCandidateBeingTunedWhenGettingPendingTrialThenOnlyCandidateSizesMatch) {
+    MockLocalWorkSizeAutotuner autotuner("", 1u, 2u);
+    auto key = createTestKey({256, 1, 1});
+    Vec3<size_t> defaultLws = {64, 1, 1};
+
+    EXPECT_FALSE(autotuner.getPendingTrial(key, defaultLws).has_value());
+
+    bool measurementRequired = false;
+    auto lws = autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired);
+    auto trial = autotuner.getPendingTrial(key, lws);
+    ASSERT_TRUE(trial.has_value());
+    EXPECT_EQ(lws, trial->lws);
+    EXPECT_EQ(key, trial->key);
+
+    EXPECT_FALSE(autotuner.getPendingTrial(key, {3, 1, 1}).has_value());
+    EXPECT_FALSE(autotuner.getPendingTrial(createTestKey({512, 1, 1}), lws).has_value());
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenMeasurementLostWhenSelectingLocalWorkSizeThenUnmeasuredCandidateIsHandedOutAgain) {
+    MockLocalWorkSizeAutotuner autotuner("", 1u, 2u);
+    auto key = createTestKey({256, 1, 1});
+    Vec3<size_t> defaultLws = {64, 1, 1};
+
+    bool measurementRequired = false;
+    auto first = autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired);
+    auto second = autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired);
+    EXPECT_NE(first, second);
+
+    autotuner.reportMeasurement({key, first}, 100u);
+
+    EXPECT_EQ(second, autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired));
+    EXPECT_TRUE(measurementRequired);
+    EXPECT_EQ(second, autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired));
+
+    autotuner.reportMeasurement({key, second}, 300u);
+    EXPECT_EQ(first, autotuner.selectLocalWorkSize(key, defaultLws, 256, 32, measurementRequired));
+    EXPECT_FALSE(measurementRequired);
+    EXPECT_TRUE(autotuner.cacheFileContent.empty());
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenCacheFileWithEntriesWhenSelectingLocalWorkSizeThenCachedSizeIsReturnedAndMalformedLinesAreSkipped) {
+    MockLocalWorkSizeAutotuner autotuner("lws_cache", 3u, 8u);
+    autotuner.cacheFileContent = "garbage\n"
+                                 "1234abcd 56780001 512 1 1 0 1 1\n"
+                                 "1234abcd 56780001 1024 2 1 32 2 1\n";
+
+    bool measurementRequired = true;
+    auto lws = autotuner.selectLocalWorkSize(createTestKey({1024, 2, 1}), {64, 1, 1}, 256, 32, measurementRequired);
+    EXPECT_EQ(Vec3<size_t>(32, 2, 1), lws);
+    EXPECT_FALSE(measurementRequired);
+
+    autotuner.selectLocalWorkSize(createTestKey({512, 1, 1}), {64, 1, 1}, 256, 32, measurementRequired);
+    EXPECT_TRUE(measurementRequired);
+    EXPECT_EQ(1u, autotuner.readCacheFileCalled);
+    EXPECT_EQ(1u, autotuner.tunedSizes.size());
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenCacheFileOverEntriesLimitWhenStoringResultThenFileIsReadAgainAndRewrittenWithMostRecentUniqueEntries) {
+    MockLocalWorkSizeAutotuner autotuner("lws_cache", 1u, 2u);
+    autotuner.maxCacheFileEntries = 4u;
+    autotuner.cacheFileContent = "1234abcd 56780001 64 1 1 32 1 1\n"
+                                 "1234abcd 56780001 128 1 1 32 1 1\n"
+                                 "1234abcd 56780001 64 1 1 64 1 1\n"
+                                 "1234abcd 56780001 256 1 1 32 1 1\n";
+
+    auto tune = [&](const Vec3<size_t> &gws, const std::string &entryAppendedByOtherProcess) {
+        auto key = createTestKey(gws);
+        bool measurementRequired = false;
+        auto first = autotuner.selectLocalWorkSize(key, {32, 1, 1}, 256, 32, measurementRequired);
+        auto second = autotuner.selectLocalWorkSize(key, {32, 1, 1}, 256, 32, measurementRequired);
+        autotuner.cacheFileContent += entryAppendedByOtherProcess;
+        autotuner.reportMeasurement({key, first}, 100u);
+        autotuner.reportMeasurement({key, second}, 200u);
+    };
+
+    tune({512, 1, 1}, "1234abcd 56780001 2048 1 1 32 1 1\n");
+    EXPECT_EQ(2u, autotuner.readCacheFileCalled);
+    EXPECT_EQ(1u, autotuner.writeCacheFileCalled);
+    EXPECT_EQ(2u, autotuner.cacheFileKeys.size());
+    EXPECT_EQ("1234abcd 56780001 2048 1 1 32 1 1\n"
+              "1234abcd 56780001 512 1 1 32 1 1\n",
+              autotuner.cacheFileContent);
+    EXPECT_EQ(5u, autotuner.tunedSizes.size());
+
+    tune({1024, 1, 1}, "");
+    EXPECT_EQ(2u, autotuner.readCacheFileCalled);
+    EXPECT_EQ(1u, autotuner.writeCacheFileCalled);
+    EXPECT_EQ(3u, autotuner.cacheFileKeys.size());
+    EXPECT_EQ("1234abcd 56780001 2048 1 1 32 1 1\n"
+              "1234abcd 56780001 512 1 1 32 1 1\n"
+              "1234abcd 56780001 1024 1 1 32 1 1\n",
+              autotuner.cacheFileContent);
+    EXPECT_EQ(2u, autotuner.lockCacheFileCalled);
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenDifferentKernelsWhenCreatingKeysThenKernelHashesDiffer) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableLocalWorkSizeAutotune.set(1);
+    KernelInfo kernelInfoA;
+    KernelInfo kernelInfoB;
+    const char isaA[] = "isaA";
+    const char isaB[] = "isaB";
+    kernelInfoA.kernelDescriptor.kernelMetadata.kernelName = "kernel";
+    kernelInfoA.heapInfo.pKernelHeap = isaA;
+    kernelInfoA.heapInfo.kernelHeapSize = sizeof(isaA);
+    kernelInfoA.storeUnpatchedIsaHash();
+    kernelInfoB.kernelDescriptor.kernelMetadata.kernelName = "kernel";
+    kernelInfoB.heapInfo.pKernelHeap = isaB;
+    kernelInfoB.heapInfo.kernelHeapSize = sizeof(isaB);
+    kernelInfoB.storeUnpatchedIsaHash();
+
+    auto keyA = LocalWorkSizeAutotuner::createKey(kernelInfoA, *defaultHwInfo, {64, 1, 1});
+    auto keyB = LocalWorkSizeAutotuner::createKey(kernelInfoB, *defaultHwInfo, {64, 1, 1});
+
+    EXPECT_NE(keyA.kernelHash, keyB.kernelHash);
+    EXPECT_EQ(keyA.deviceId, keyB.deviceId);
+    EXPECT_EQ(keyA, LocalWorkSizeAutotuner::createKey(kernelInfoA, *defaultHwInfo, {64, 1, 1}));
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenIsaPatchedAfterDecodingWhenCreatingKeyThenKernelHashIsNotChanged) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableLocalWorkSizeAutotune.set(1);
+    KernelInfo kernelInfo;
+    char isa[] = "isa with relocation";
+    kernelInfo.kernelDescriptor.kernelMetadata.kernelName = "kernel";
+    kernelInfo.heapInfo.pKernelHeap = isa;
+    kernelInfo.heapInfo.kernelHeapSize = sizeof(isa);
+    kernelInfo.storeUnpatchedIsaHash();
+    EXPECT_NE(0u, kernelInfo.unpatchedIsaHash);
+
+    auto key = LocalWorkSizeAutotuner::createKey(kernelInfo, *defaultHwInfo, {64, 1, 1});
+    isa[0] = 'X';
+    EXPECT_EQ(key, LocalWorkSizeAutotuner::createKey(kernelInfo, *defaultHwInfo, {64, 1, 1}));
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenAutotuneDisabledWhenStoringUnpatchedIsaHashThenIsaIsNotHashed) {
+    KernelInfo kernelInfo;
+    const char isa[] = "isa";
+    kernelInfo.heapInfo.pKernelHeap = isa;
+    kernelInfo.heapInfo.kernelHeapSize = sizeof(isa);
+    kernelInfo.storeUnpatchedIsaHash();
+    EXPECT_EQ(0u, kernelInfo.unpatchedIsaHash);
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenRecordsWhenProcessingThenDurationsAreReportedAndTagsAreReturned) {
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(executionEnvironment);
+    MockTagAllocator<MockTimestampPackets32> allocator(0, &memoryManager, 4);
+
+    MockLocalWorkSizeAutotuner autotuner("", 1u, 2u);
+    auto key = createTestKey({256, 1, 1});
+    bool measurementRequired = false;
+    auto first = autotuner.selectLocalWorkSize(key, {64, 1, 1}, 256, 32, measurementRequired);
+    auto second = autotuner.selectLocalWorkSize(key, {64, 1, 1}, 256, 32, measurementRequired);
+
+    std::vector<LocalWorkSizeAutotuneRecord> records;
+    uint32_t durations[] = {500u, 50u};
+    Vec3<size_t> sizes[] = {first, second};
+    for (uint32_t i = 0; i < 2; i++) {
+        auto node = static_cast<TagNode<MockTimestampPackets32> *>(allocator.getTag());
+        for (auto &packet : node->tagForCpuAccess->packets) {
+            packet.globalStart = 1000u;
+            packet.globalEnd = 1000u + durations[i];
+        }
+        records.push_back({node, {key, sizes[i]}});
+    }
+
+    autotuner.processRecords(records, std::numeric_limits<uint64_t>::max(), false);
+
+    EXPECT_TRUE(records.empty());
+    EXPECT_TRUE(allocator.usedTags.peekIsEmpty());
+    EXPECT_EQ(second, autotuner.selectLocalWorkSize(key, {64, 1, 1}, 256, 32, measurementRequired));
+    EXPECT_FALSE(measurementRequired);
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenTimestampWrappedBetweenStartAndEndWhenProcessingRecordsThenDurationIsMasked) {
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(executionEnvironment);
+    MockTagAllocator<MockTimestampPackets32> allocator(0, &memoryManager, 4);
+
+    MockLocalWorkSizeAutotuner autotuner("", 1u, 2u);
+    auto key = createTestKey({256, 1, 1});
+    bool measurementRequired = false;
+    auto first = autotuner.selectLocalWorkSize(key, {64, 1, 1}, 256, 32, measurementRequired);
+    auto second = autotuner.selectLocalWorkSize(key, {64, 1, 1}, 256, 32, measurementRequired);
+
+    // first candidate wraps around 32 bit timestamp after 0x20 ticks, second one takes 0x100 ticks
+    uint32_t starts[] = {0xfffffff0u, 0x1000u};
+    uint32_t ends[] = {0x10u, 0x1100u};
+    Vec3<size_t> sizes[] = {first, second};
+    std::vector<LocalWorkSizeAutotuneRecord> records;
+    for (uint32_t i = 0; i < 2; i++) {
+        auto node = static_cast<TagNode<MockTimestampPackets32> *>(allocator.getTag());
+        for (auto &packet : node->tagForCpuAccess->packets) {
+            packet.globalStart = starts[i];
+            packet.globalEnd = ends[i];
+        }
+        records.push_back({node, {key, sizes[i]}});
+    }
+
+    autotuner.processRecords(records, maxNBitValue(32), false);
+
+    EXPECT_EQ(first, autotuner.selectLocalWorkSize(key, {64, 1, 1}, 256, 32, measurementRequired));
+    EXPECT_FALSE(measurementRequired);
+}
+
+TEST(LocalWorkSizeAutotunerTest, givenGpuHangWhenProcessingRecordsThenTagsAreReturnedWithoutMeasurements) {
+    MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
+    MockMemoryManager memoryManager(executionEnvironment);
+    MockTagAllocator<MockTimestampPackets32> allocator(0, &memoryManager, 4);
+
+    MockLocalWorkSizeAutotuner autotuner("", 1u, 2u);
+    auto key = createTestKey({256, 1, 1});
+    bool measurementRequired = false;
+    auto lws = autotuner.selectLocalWorkSize(key, {64, 1, 1}, 256, 32, measurementRequired);
+
+    std::vector<LocalWorkSizeAutotuneRecord> records;
+    records.push_back({allocator.getTag(), {key, lws}});
+    autotuner.processRecords(records, std::numeric_limits<uint64_t>::max(), true);
+
+    EXPECT_TRUE(records.empty());
+    EXPECT_TRUE(allocator.usedTags.peekIsEmpty());
+    ASSERT_EQ(1u, autotuner.tuningStates.size());
+    for (auto &candidate : autotuner.tuningStates.begin()->second.candidates) {
+        EXPECT_EQ(0u, candidate.measurements);
+    }
+}
+
+TEST(LocalWorkSizeAutotunerExecutionEnvironmentTest, givenAutotuneDisabledWhenGettingAutotunerThenNullptrIsReturned) {
+    DebugManagerStateRestore restorer;
+    MockExecutionEnvironment executionEnvironment;
+
+    EXPECT_EQ(nullptr, executionEnvironment.getLocalWorkSizeAutotuner());
+}
+
+TEST(LocalWorkSizeAutotunerExecutionEnvironmentTest, givenAutotuneEnabledWhenGettingAutotunerThenItIsCreatedOnce) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableLocalWorkSizeAutotune.set(1);
+    debugManager.flags.LocalWorkSizeAutotuneCacheFile.set("");
+    MockExecutionEnvironment executionEnvironment;
+
+    auto autotuner = executionEnvironment.getLocalWorkSizeAutotuner();
+    EXPECT_NE(nullptr, autotuner);
+    EXPECT_EQ(autotuner, executionEnvironment.getLocalWorkSizeAutotuner());
+}
@@ -40,6 +40,25 @@ TEST_F(TimestampPoolAllocatorTest, givenTimestampPoolAllocatorWhenNoAllocationsT
     timestampAllocator.freeSharedTimestampAllocation(allocation);
 }
 
+TEST_F(TimestampPoolAllocatorTest, givenHostTimestampPoolAllocatorWhenRequestingAllocationsThenHostMemoryPoolIsSharedBetweenRequests) {
+    auto &timestampAllocator = pDevice->getHostTimestampPoolAllocator();
+    EXPECT_TRUE(timestampAllocator.isHostMemory());
+    EXPECT_FALSE(pDevice->getDeviceTimestampPoolAllocator().isHostMemory());
+    constexpr size_t requestAllocationSize = MemoryConstants::pageSize;
+
+    auto allocation1 = timestampAllocator.requestGraphicsAllocationForTimestamp(requestAllocationSize);
+    auto allocation2 = timestampAllocator.requestGraphicsAllocationForTimestamp(requestAllocationSize);
+    verifySharedTimestampAllocation(allocation1, 0ul, requestAllocationSize);
+    verifySharedTimestampAllocation(allocation2, requestAllocationSize, requestAllocationSize);
+    EXPECT_EQ(allocation1->getGraphicsAllocation(), allocation2->getGraphicsAllocation());
+    EXPECT_EQ(AllocationType::timestampPacketTagBuffer, allocation1->getGraphicsAllocation()->getAllocationType());
+    EXPECT_TRUE(timestampAllocator.isPoolBuffer(allocation1->getGraphicsAllocation()));
+    EXPECT_FALSE(pDevice->getDeviceTimestampPoolAllocator().isPoolBuffer(allocation1->getGraphicsAllocation()));
+
+    timestampAllocator.freeSharedTimestampAllocation(allocation1);
+    timestampAllocator.freeSharedTimestampAllocation(allocation2);
+}
+
 TEST_F(TimestampPoolAllocatorTest, givenTimestampPoolAllocatorWhenAllocationsExistThenReuseAllocation) {
     auto &timestampAllocator = pDevice->getDeviceTimestampPoolAllocator();
     constexpr size_t requestAllocationSize = MemoryConstants::pageSize;
@@ -13,6 +13,10 @@
 
 #include "gtest/gtest.h"
 
+#include <cmath>
+#include <limits>
+#include <random>
+
 using namespace NEO;
 
 namespace CpuIntrinsicsTests {
@@ -99,3 +103,179 @@ TEST_F(WaitPredicateOnlyTest, givenDebugFlagSetZeroWhenPollAddressProvidedMeetsC
     EXPECT_TRUE(ret);
     EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
 }
+
+struct AdaptiveWaitPolicyTest : public ::testing::Test {
+    void SetUp() override {
+        backupWaitpkgUse = std::make_unique<VariableBackup<WaitUtils::WaitpkgUse>>(&WaitUtils::waitpkgUse, WaitUtils::WaitpkgUse::noUse);
+    }
+
+    template <typename DistributionT>
+    void train(DistributionT &distribution, uint32_t samples) {
+        for (uint32_t i = 0; i < samples; i++) {
+            policy.recordCompletion(static_cast<int64_t>(distribution(generator)));
+        }
+    }
+
+    struct SimulationResult {
+        int64_t busyTime = 0;
+        int64_t oversleepTime = 0;
+        int64_t totalTime = 0;
+        uint32_t sleepIterations = 0;
+    };
+
+    // Replays synthetic completion times against the policy, modelling cost of each wait phase
+    template <typename DistributionT>
+    SimulationResult simulate(DistributionT &distribution, uint32_t waits) {
+        constexpr int64_t spinIterationTime = 1;
+        constexpr int64_t monitorWaitIterationTime = 10;
+
+        SimulationResult result;
+        for (uint32_t i = 0; i < waits; i++) {
+            auto completionTime = static_cast<int64_t>(distribution(generator));
+            int64_t elapsed = 0;
+            while (elapsed < completionTime) {
+                auto remaining = policy.predictRemainingTime(elapsed);
+                switch (WaitUtils::AdaptiveWaitPolicy::selectWaitPhase(remaining)) {
+                case WaitUtils::WaitPhase::spin:
+                    elapsed += spinIterationTime;
+                    result.busyTime += spinIterationTime;
+                    break;
+                case WaitUtils::WaitPhase::monitorWait:
+                    elapsed += monitorWaitIterationTime;
+                    result.busyTime += 1;
+                    break;
+                default:
+                    result.sleepIterations++;
+                    elapsed += std::clamp(remaining / 2, int64_t{1}, WaitUtils::AdaptiveWaitPolicy::maxSleepInMicroSeconds);
+                    break;
+                }
+            }
+            result.oversleepTime += elapsed - completionTime;
+            result.totalTime += completionTime;
+        }
+        return result;
+    }
+
+    std::unique_ptr<VariableBackup<WaitUtils::WaitpkgUse>> backupWaitpkgUse;
+    std::mt19937 generator{0u};
+    WaitUtils::AdaptiveWaitPolicy policy;
+};
+
+TEST_F(AdaptiveWaitPolicyTest, whenGettingBucketIndexThenLog2OfTimeIsReturnedAndClampedToLastBucket) {
+    EXPECT_EQ(0u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(-5));
+    EXPECT_EQ(0u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(0));
+    EXPECT_EQ(0u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(1));
+    EXPECT_EQ(1u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(2));
+    EXPECT_EQ(1u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(3));
+    EXPECT_EQ(10u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(1500));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::histogramBucketCount - 1u, WaitUtils::AdaptiveWaitPolicy::getBucketIndex(std::numeric_limits<int64_t>::max()));
+}
+
+TEST_F(AdaptiveWaitPolicyTest, givenPredictedRemainingTimeWhenSelectingWaitPhaseThenPhaseMatchesThresholds) {
+    EXPECT_EQ(WaitUtils::WaitPhase::spin, WaitUtils::AdaptiveWaitPolicy::selectWaitPhase(0));
+    EXPECT_EQ(WaitUtils::WaitPhase::spin, WaitUtils::AdaptiveWaitPolicy::selectWaitPhase(WaitUtils::AdaptiveWaitPolicy::spinPhaseThresholdInMicroSeconds));
+    EXPECT_EQ(WaitUtils::WaitPhase::monitorWait, WaitUtils::AdaptiveWaitPolicy::selectWaitPhase(WaitUtils::AdaptiveWaitPolicy::spinPhaseThresholdInMicroSeconds + 1));
+    EXPECT_EQ(WaitUtils::WaitPhase::monitorWait, WaitUtils::AdaptiveWaitPolicy::selectWaitPhase(WaitUtils::AdaptiveWaitPolicy::monitorWaitPhaseThresholdInMicroSeconds));
+    EXPECT_EQ(WaitUtils::WaitPhase::sleep, WaitUtils::AdaptiveWaitPolicy::selectWaitPhase(WaitUtils::AdaptiveWaitPolicy::monitorWaitPhaseThresholdInMicroSeconds + 1));
+}
+
+TEST_F(AdaptiveWaitPolicyTest, givenNotEnoughSamplesWhenPredictingRemainingTimeThenUnknownIsReturned) {
+    for (uint64_t i = 0; i < WaitUtils::AdaptiveWaitPolicy::minSamplesForPrediction - 1; i++) {
+        policy.recordCompletion(100);
+    }
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::unknownRemainingTime, policy.predictRemainingTime(0));
+
+    policy.recordCompletion(100);
+    EXPECT_NE(WaitUtils::AdaptiveWaitPolicy::unknownRemainingTime, policy.predictRemainingTime(0));
+}
+
+TEST_F(AdaptiveWaitPolicyTest, givenBimodalHistoryWhenPredictingRemainingTimeThenOnlyWaitsLongerThanElapsedTimeAreConsidered) {
+    for (uint32_t i = 0; i < 16; i++) {
+        policy.recordCompletion(4);
+    }
+    for (uint32_t i = 0; i < 8; i++) {
+        policy.recordCompletion(5000);
+    }
+
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::getBucketRepresentativeTime(2), policy.predictRemainingTime(0));
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::getBucketRepresentativeTime(12) - 100, policy.predictRemainingTime(100));
+    EXPECT_EQ(20000, policy.predictRemainingTime(20000));
+}
+
+TEST_F(AdaptiveWaitPolicyTest, givenMaxSamplesRecordedWhenRecordingCompletionThenHistoryIsDecayed) {
+    for (uint64_t i = 0; i < WaitUtils::AdaptiveWaitPolicy::maxSamplesBeforeDecay - 1; i++) {
+        policy.recordCompletion(4);
+    }
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::maxSamplesBeforeDecay - 1, policy.getSampleCount());
+
+    policy.recordCompletion(4);
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::maxSamplesBeforeDecay / 2, policy.getSampleCount());
+    EXPECT_EQ(WaitUtils::AdaptiveWaitPolicy::maxSamplesBeforeDecay, policy.getWaitStatistics().completedWaits);
+}
+
+TEST_F(AdaptiveWaitPolicyTest, givenNoHistoryWhenWaitingThenDefaultWaitFunctionIsUsed) {
+    volatile TagAddressType pollValue = 1u;
+
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    EXPECT_FALSE(policy.wait(&pollValue, 3u, 0));
+    EXPECT_EQ(oldCount + WaitUtils::waitCount, CpuIntrinsicsTests::pauseCounter);
+
+    pollValue = 3u;
+    EXPECT_TRUE(policy.wait(&pollValue, 3u, 0));
+    EXPECT_EQ(2u, policy.getWaitStatistics().waitIterations[static_cast<uint32_t>(WaitUtils::WaitPhase::spin)]);
+}
+
+TEST_F(AdaptiveWaitPolicyTest, givenHistoryWhenWaitingThenWaitIterationsAreCountedPerPhase) {
+    for (uint32_t i = 0; i < 8; i++) {
+        policy.recordCompletion(4);
+        policy.recordCompletion(4);
+        policy.recordCompletion(4);
+        policy.recordCompletion(4);
+        policy.recordCompletion(100);
+        policy.recordCompletion(50000);
+    }
+    volatile TagAddressType pollValue = 1u;
+
+    uint32_t oldCount = CpuIntrinsicsTests::pauseCounter.load();
+    EXPECT_FALSE(policy.wait(&pollValue, 3u, 0));
+    EXPECT_EQ(oldCount + 1, CpuIntrinsicsTests::pauseCounter);
+
+    EXPECT_FALSE(policy.wait(&pollValue, 3u, 30));
+    EXPECT_FALSE(policy.wait(&pollValue, 3u, 500));
+
+    auto statistics = policy.getWaitStatistics();
+    EXPECT_EQ(1u, statistics.waitIterations[static_cast<uint32_t>(WaitUtils::WaitPhase::spin)]);
+    EXPECT_EQ(1u, statistics.waitIterations[static_cast<uint32_t>(WaitUtils::WaitPhase::monitorWait)]);
+    EXPECT_EQ(1u, statistics.waitIterations[static_cast<uint32_t>(WaitUtils::WaitPhase::sleep)]);
+}
+
+TEST_F(AdaptiveWaitPolicyTest, givenShortCompletionTimesWhenSimulatingWaitsThenPolicySpinsWithoutOversleeping) {
+    std::exponential_distribution<double> distribution(1.0 / 5.0);
+    train(distribution, 512);
+
+    auto result = simulate(distribution, 256);
+    EXPECT_EQ(0u, result.sleepIterations);
+    EXPECT_LT(result.oversleepTime * 10, result.totalTime);
+}
+
+TEST_F(AdaptiveWaitPolicyTest, givenLongCompletionTimesWhenSimulatingWaitsThenPolicyMostlySleeps) {
+    std::lognormal_distribution<double> distribution(std::log(50000.0), 0.25);
+    train(distribution, 512);
+
+    auto result = simulate(distribution, 64);
+    EXPECT_LT(result.busyTime * 100, result.totalTime);
+    EXPECT_LT(result.oversleepTime * 10, result.totalTime);
+}
+
+TEST_F(AdaptiveWaitPolicyTest, givenBimodalCompletionTimesWhenSimulatingWaitsThenPolicyAdaptsToBothModes) {
+    std::exponential_distribution<double> shortWaits(1.0 / 5.0);
+    std::lognormal_distribution<double> longWaits(std::log(50000.0), 0.25);
+    auto bimodal = [&](std::mt19937 &generator) {
+        return (generator() % 2) ? shortWaits(generator) : longWaits(generator);
+    };
+
+    train(bimodal, 512);
+    auto result = simulate(bimodal, 128);
+    EXPECT_LT(result.busyTime * 20, result.totalTime);
+    EXPECT_LT(result.oversleepTime * 10, result.totalTime);
+}